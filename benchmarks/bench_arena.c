@@ -0,0 +1,177 @@
+#include <linux/perf_event.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "common/bench_common.h"
+#include "zk/zklib.h"
+
+/*
+ * TLB cost of traversing large lists. The same list is built twice: once from malloc() on a scattered heap, once from
+ * a zk_arena backed by huge pages, with every payload allocated right after its node. Both lists are then linked in
+ * the same random order, so the difference comes from the pages the nodes live in rather than from their order.
+ *
+ * dTLB load misses are read from perf_event_open(2) when the kernel allows it (perf_event_paranoid, containers and
+ * virtual machines often do not), and reported as n/a otherwise.
+ */
+
+#define BENCH_DEFAULT_N (1u << 21)
+
+struct payload {
+	long value;
+};
+
+static void sum_values(void *data, void *user_data)
+{
+	*(long *)user_data += ((struct payload *)data)->value;
+}
+
+static int compare_value(const void *const a, const void *const b)
+{
+	long const va = ((const struct payload *)a)->value;
+	long const vb = *(const long *)b;
+	return (va > vb) - (va < vb);
+}
+
+static int tlb_open(void)
+{
+	struct perf_event_attr attr = { 0 };
+	attr.size = sizeof(attr);
+	attr.type = PERF_TYPE_HW_CACHE;
+	attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+	              (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+	attr.disabled = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+static void tlb_start(int const fd)
+{
+	if (fd >= 0) {
+		ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+		ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+	}
+}
+
+static void tlb_report(int const fd, size_t const n)
+{
+	long long misses = 0;
+	if (fd >= 0) {
+		ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+		if (read(fd, &misses, sizeof(misses)) == sizeof(misses)) {
+			printf("%-40s %.3f per node\n", "  dTLB load misses", (double)misses / (double)n);
+			return;
+		}
+	}
+	printf("%-40s n/a\n", "  dTLB load misses");
+}
+
+// Links the nodes in a random order, the same for every list of the same size.
+static zk_slist *shuffle(zk_slist **nodes, size_t const n)
+{
+	for (size_t i = n - 1; i > 0; i--) {
+		size_t const j = bench_rand() % (i + 1);
+		zk_slist *node = nodes[i];
+		nodes[i] = nodes[j];
+		nodes[j] = node;
+	}
+	for (size_t i = 0; i + 1 < n; i++)
+		nodes[i]->next = nodes[i + 1];
+	nodes[n - 1]->next = NULL;
+	return nodes[0];
+}
+
+static void traverse(const char *const name, zk_slist *list, size_t const n, int const fd)
+{
+	char row[64];
+	long sum = 0;
+
+	bench_flush_caches();
+	tlb_start(fd);
+	uint64_t start = bench_now_ns();
+	zk_slist_for_each(list, NULL, sum_values, &sum);
+	uint64_t const ns = bench_now_ns() - start;
+	snprintf(row, sizeof(row), "zk_slist_for_each (%s)", name);
+	bench_report(row, n, ns);
+	tlb_report(fd, n);
+
+	long const missing = -1;
+	bench_flush_caches();
+	tlb_start(fd);
+	start = bench_now_ns();
+	zk_slist *found = zk_slist_find(list, &missing, compare_value);
+	uint64_t const find_ns = bench_now_ns() - start;
+	snprintf(row, sizeof(row), "zk_slist_find miss (%s)", name);
+	bench_report(row, n, find_ns);
+	tlb_report(fd, n);
+
+	if (found != NULL || sum != (long)n * (long)(n - 1) / 2)
+		fprintf(stderr, "unexpected result\n");
+}
+
+static void bench_malloc(zk_slist **nodes, size_t const n, int const fd)
+{
+	void *scatter = bench_scatter_heap(sizeof(zk_slist), 2 * n);
+	for (size_t i = 0; i < n; i++) {
+		struct payload *payload = malloc(sizeof(struct payload));
+		nodes[i] = zk_slist_new_node(payload);
+		if (payload == NULL || nodes[i] == NULL) {
+			fprintf(stderr, "out of memory\n");
+			exit(1);
+		}
+		payload->value = (long)i;
+	}
+	zk_slist *list = shuffle(nodes, n);
+
+	traverse("malloc", list, n, fd);
+
+	uint64_t const start = bench_now_ns();
+	zk_slist_free(&list, free);
+	bench_report("zk_slist_free (malloc)", n, bench_now_ns() - start);
+	bench_scatter_release(scatter, 2 * n);
+}
+
+static void bench_arena(zk_slist **nodes, size_t const n, int const fd)
+{
+	zk_arena *arena = NULL;
+	if (zk_arena_new(&arena, n * (sizeof(zk_slist) + sizeof(struct payload) + _Alignof(max_align_t))) != ZK_OK) {
+		fprintf(stderr, "out of memory\n");
+		exit(1);
+	}
+
+	for (size_t i = 0; i < n; i++) {
+		nodes[i] = zk_slist_new_node_arena(NULL, arena);
+		struct payload *payload = zk_arena_alloc(arena, sizeof(struct payload));
+		payload->value = (long)i;
+		nodes[i]->data = payload;
+	}
+	zk_slist *list = shuffle(nodes, n);
+
+	static const char *const pages[] = { "hugetlb", "transparent huge pages", "default pages" };
+	printf("arena pages: %s\n", pages[zk_arena_get_pages(arena)]);
+	traverse("arena", list, n, fd);
+
+	uint64_t const start = bench_now_ns();
+	zk_slist_free_arena(&list, NULL, &arena);
+	bench_report("zk_slist_free_arena", n, bench_now_ns() - start);
+}
+
+int main(int argc, char *argv[])
+{
+	size_t const n = argc > 1 ? strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_N;
+	zk_slist **nodes = malloc(n * sizeof(zk_slist *));
+	if (n < 2 || nodes == NULL)
+		return 1;
+
+	int const fd = tlb_open();
+	bench_malloc(nodes, n, fd);
+	bench_arena(nodes, n, fd);
+
+	if (fd >= 0)
+		close(fd);
+	free(nodes);
+	return 0;
+}
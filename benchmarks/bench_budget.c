@@ -0,0 +1,94 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common/bench_common.h"
+#include "zk/zklib.h"
+
+/*
+ * Longest stall of an event loop that frees or scans a large list: the one-shot calls block for the whole list, the
+ * budgeted calls for about one budget each. The total rows show what the slicing costs overall.
+ */
+
+#define BENCH_DEFAULT_N      (1u << 22)
+#define BENCH_DEFAULT_BUDGET 100000
+
+static void sum_values(void *data, void *user_data)
+{
+	*(long *)user_data += *(long *)data;
+}
+
+static zk_slist *new_list(size_t const n)
+{
+	zk_slist *list = NULL;
+	for (size_t i = 0; i < n; i++) {
+		long *payload = malloc(sizeof(long));
+		if (payload == NULL) {
+			fprintf(stderr, "out of memory\n");
+			exit(1);
+		}
+		*payload = (long)i;
+		list = zk_slist_push_front(list, payload);
+	}
+	return list;
+}
+
+static int compare_u64(const void *a, const void *b)
+{
+	uint64_t const x = *(const uint64_t *)a;
+	uint64_t const y = *(const uint64_t *)b;
+	return (x > y) - (x < y);
+}
+
+// Reports the 99th percentile and the longest call, the latter includes the preemptions of the benchmark thread.
+static void report_calls(const char *const name, uint64_t *const call_ns, size_t const calls)
+{
+	qsort(call_ns, calls, sizeof(uint64_t), compare_u64);
+	printf("%-40s calls=%-10zu p99 %" PRIu64 " us, max %" PRIu64 " us\n", name, calls,
+	       call_ns[calls * 99 / 100] / 1000, call_ns[calls - 1] / 1000);
+}
+
+int main(int argc, char *argv[])
+{
+	size_t const n = argc > 1 ? strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_N;
+	zk_budget const budget = { .ns = argc > 2 ? strtoull(argv[2], NULL, 10) : BENCH_DEFAULT_BUDGET };
+	long sum = 0;
+
+	zk_slist *list = new_list(n);
+	uint64_t start = bench_now_ns();
+	zk_slist_for_each(list, NULL, sum_values, &sum);
+	bench_report("zk_slist_for_each", n, bench_now_ns() - start);
+
+	// every call processes at least one node
+	uint64_t *call_ns = malloc(n * sizeof(uint64_t));
+	if (call_ns == NULL)
+		return 1;
+	size_t calls = 0;
+	zk_iter cursor = zk_iter_begin(list);
+	start = bench_now_ns();
+	for (bool done = false; !done; calls++) {
+		uint64_t const call = bench_now_ns();
+		done = zk_iter_for_each_budget(&cursor, sum_values, &sum, budget);
+		call_ns[calls] = bench_now_ns() - call;
+	}
+	bench_report("zk_iter_for_each_budget total", n, bench_now_ns() - start);
+	report_calls("zk_iter_for_each_budget", call_ns, calls);
+
+	start = bench_now_ns();
+	zk_slist_free(&list, free);
+	bench_report("zk_slist_free", n, bench_now_ns() - start);
+
+	list = new_list(n);
+	calls = 0;
+	start = bench_now_ns();
+	for (bool done = false; !done; calls++) {
+		uint64_t const call = bench_now_ns();
+		done = zk_slist_free_budget(&list, free, budget);
+		call_ns[calls] = bench_now_ns() - call;
+	}
+	bench_report("zk_slist_free_budget total", n, bench_now_ns() - start);
+	report_calls("zk_slist_free_budget", call_ns, calls);
+	free(call_ns);
+
+	return sum == 0;
+}
@@ -0,0 +1,77 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common/bench_common.h"
+#include "zk/zklib.h"
+#include "zk_lf_queue/zk_lf_queue.h"
+
+/*
+ * Shared FIFO scaling from 1 to 64 threads: every thread pushes an element and pops one, on the lock-free queue and
+ * on a zk_c_slist behind a mutex, the setup it replaces. Each thread performs the same number of operations whatever
+ * the thread count, so the total work grows with the threads.
+ */
+
+#define BENCH_DEFAULT_OPS (1u << 18)
+#define BENCH_MAX_THREADS 64
+
+struct bench_queue {
+	zk_lf_queue *lf_queue;
+	zk_c_slist *list;
+	pthread_mutex_t mutex;
+	size_t ops;
+};
+
+static void run_lf_queue(size_t const thread, void *const arg)
+{
+	struct bench_queue *bench = arg;
+	void *data = NULL;
+
+	for (size_t i = 0; i < bench->ops / 2; i++) {
+		if (zk_lf_queue_push(bench->lf_queue, (void *)(thread + 1)) != ZK_OK)
+			abort();
+		zk_lf_queue_pop(bench->lf_queue, &data);
+	}
+}
+
+static void run_mutex_c_slist(size_t const thread, void *const arg)
+{
+	struct bench_queue *bench = arg;
+
+	for (size_t i = 0; i < bench->ops / 2; i++) {
+		pthread_mutex_lock(&bench->mutex);
+		zk_status const status = zk_c_slist_push_back(&bench->list, (void *)(thread + 1));
+		pthread_mutex_unlock(&bench->mutex);
+		if (status != ZK_OK)
+			abort();
+
+		pthread_mutex_lock(&bench->mutex);
+		zk_c_slist_pop_front(&bench->list, NULL);
+		pthread_mutex_unlock(&bench->mutex);
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	size_t const ops = argc > 1 ? strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_OPS;
+	size_t const max_threads = argc > 2 ? strtoul(argv[2], NULL, 10) : BENCH_MAX_THREADS;
+
+	for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+		struct bench_queue bench = { .ops = ops };
+		pthread_mutex_init(&bench.mutex, NULL);
+		if (zk_lf_queue_new(&bench.lf_queue) != ZK_OK)
+			return 1;
+
+		uint64_t ns = bench_run_threads(threads, run_lf_queue, &bench);
+		bench_report_throughput("zk_lf_queue push/pop", threads, threads * ops, ns);
+
+		ns = bench_run_threads(threads, run_mutex_c_slist, &bench);
+		bench_report_throughput("zk_c_slist push/pop + mutex", threads, threads * ops, ns);
+
+		zk_lf_queue_free(&bench.lf_queue, NULL);
+		zk_c_slist_free(&bench.list, NULL);
+		pthread_mutex_destroy(&bench.mutex);
+	}
+
+	return 0;
+}
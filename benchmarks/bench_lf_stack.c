@@ -0,0 +1,74 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common/bench_common.h"
+#include "zk_lf_stack/zk_lf_stack.h"
+
+/*
+ * Shared LIFO throughput: every thread repeatedly pushes an element and pops one, on the lock-free stack and on a
+ * zk_slist behind a mutex, the setup it replaces. Each thread performs the same number of operations whatever the
+ * thread count, so the total work grows with the threads.
+ */
+
+#define BENCH_DEFAULT_OPS (1u << 20)
+#define BENCH_MAX_THREADS 64
+
+struct bench_stack {
+	zk_lf_stack *lf_stack;
+	zk_slist *list;
+	pthread_mutex_t mutex;
+	size_t ops;
+};
+
+static void run_lf_stack(size_t const thread, void *const arg)
+{
+	struct bench_stack *bench = arg;
+	void *data = NULL;
+
+	for (size_t i = 0; i < bench->ops / 2; i++) {
+		if (zk_lf_stack_push(bench->lf_stack, (void *)(thread + 1)) != ZK_OK)
+			abort();
+		zk_lf_stack_pop(bench->lf_stack, &data);
+	}
+}
+
+static void run_mutex_slist(size_t const thread, void *const arg)
+{
+	struct bench_stack *bench = arg;
+
+	for (size_t i = 0; i < bench->ops / 2; i++) {
+		pthread_mutex_lock(&bench->mutex);
+		bench->list = zk_slist_push_front(bench->list, (void *)(thread + 1));
+		pthread_mutex_unlock(&bench->mutex);
+
+		pthread_mutex_lock(&bench->mutex);
+		bench->list = zk_slist_pop_front(bench->list, NULL);
+		pthread_mutex_unlock(&bench->mutex);
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	size_t const ops = argc > 1 ? strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_OPS;
+	size_t const max_threads = argc > 2 ? strtoul(argv[2], NULL, 10) : 16;
+
+	for (size_t threads = 1; threads <= max_threads && threads <= BENCH_MAX_THREADS; threads *= 2) {
+		struct bench_stack bench = { .ops = ops };
+		pthread_mutex_init(&bench.mutex, NULL);
+		if (zk_lf_stack_new(&bench.lf_stack) != ZK_OK)
+			return 1;
+
+		uint64_t ns = bench_run_threads(threads, run_lf_stack, &bench);
+		bench_report_throughput("zk_lf_stack push/pop", threads, threads * ops, ns);
+
+		ns = bench_run_threads(threads, run_mutex_slist, &bench);
+		bench_report_throughput("zk_slist push/pop + mutex", threads, threads * ops, ns);
+
+		zk_lf_stack_free(&bench.lf_stack, NULL);
+		zk_slist_free(&bench.list, NULL);
+		pthread_mutex_destroy(&bench.mutex);
+	}
+
+	return 0;
+}
@@ -0,0 +1,134 @@
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common/bench_common.h"
+#include "zk/zklib.h"
+#include "zk_lock_dlist/zk_lock_dlist.h"
+
+/*
+ * Updates in the middle of a large sorted list: the keys are split into one region per thread and every thread
+ * removes a random key of its region and inserts it back. Compares the per-node locks of zk_lock_dlist with a
+ * zk_dlist behind a single mutex, the setup it replaces. Each thread performs the same number of operations whatever
+ * the thread count, so the total work grows with the threads.
+ */
+
+#define BENCH_DEFAULT_OPS  (1u << 14)
+#define BENCH_DEFAULT_KEYS (1u << 12)
+#define BENCH_MAX_THREADS  64
+
+struct bench_list {
+	zk_lock_dlist *lock_dlist;
+	zk_dlist *list;
+	pthread_mutex_t mutex;
+	size_t ops;
+	size_t keys;
+	size_t threads;
+};
+
+static int compare_key(const void *const a, const void *const b)
+{
+	uintptr_t const x = (uintptr_t)a;
+	uintptr_t const y = (uintptr_t)b;
+	return (x > y) - (x < y);
+}
+
+static uintptr_t pick_key(struct bench_list *const bench, size_t const thread, uint64_t *const seed)
+{
+	size_t const region = bench->keys / bench->threads;
+	*seed = *seed * 6364136223846793005u + 1442695040888963407u;
+	return 1 + thread * region + (uintptr_t)(*seed >> 33) % region;
+}
+
+static void run_lock_dlist(size_t const thread, void *const arg)
+{
+	struct bench_list *bench = arg;
+	uint64_t seed = thread + 1;
+
+	for (size_t i = 0; i < bench->ops / 2; i++) {
+		void *const key = (void *)pick_key(bench, thread, &seed);
+		if (!zk_lock_dlist_remove(bench->lock_dlist, key, NULL) ||
+		    zk_lock_dlist_insert(bench->lock_dlist, key) != ZK_OK)
+			abort();
+	}
+}
+
+// sorted remove and insert on a zk_dlist, the caller holds the mutex. Keys are compared through a function pointer,
+// as in zk_lock_dlist.
+static zk_dlist *dlist_lower_bound(zk_dlist *list, uintptr_t const key, zk_dlist **last_p)
+{
+	zk_compare_func volatile compare = compare_key;
+	for (*last_p = NULL; list != NULL && compare(list->data, (void *)key) < 0; list = list->next)
+		*last_p = list;
+	return list;
+}
+
+static void run_mutex_dlist(size_t const thread, void *const arg)
+{
+	struct bench_list *bench = arg;
+	uint64_t seed = thread + 1;
+
+	for (size_t i = 0; i < bench->ops / 2; i++) {
+		uintptr_t const key = pick_key(bench, thread, &seed);
+		zk_dlist *last;
+
+		pthread_mutex_lock(&bench->mutex);
+		zk_dlist *node = dlist_lower_bound(bench->list, key, &last);
+		if (node == NULL || (uintptr_t)node->data != key)
+			abort();
+		if (node->prev != NULL)
+			node->prev->next = node->next;
+		else
+			bench->list = node->next;
+		if (node->next != NULL)
+			node->next->prev = node->prev;
+		free(node);
+		pthread_mutex_unlock(&bench->mutex);
+
+		pthread_mutex_lock(&bench->mutex);
+		zk_dlist *next = dlist_lower_bound(bench->list, key, &last);
+		if (zk_dlist_new_node(&node, (void *)key) != ZK_OK)
+			abort();
+		node->prev = last;
+		node->next = next;
+		if (next != NULL)
+			next->prev = node;
+		if (last != NULL)
+			last->next = node;
+		else
+			bench->list = node;
+		pthread_mutex_unlock(&bench->mutex);
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	size_t const ops = argc > 1 ? strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_OPS;
+	size_t const keys = argc > 2 ? strtoul(argv[2], NULL, 10) : BENCH_DEFAULT_KEYS;
+	size_t const max_threads = argc > 3 ? strtoul(argv[3], NULL, 10) : 16;
+
+	for (size_t threads = 1; threads <= max_threads && threads <= BENCH_MAX_THREADS; threads *= 2) {
+		struct bench_list bench = { .ops = ops, .keys = keys, .threads = threads };
+		pthread_mutex_init(&bench.mutex, NULL);
+		if (zk_lock_dlist_new(&bench.lock_dlist, compare_key) != ZK_OK)
+			return 1;
+		for (uintptr_t key = keys; key > 0; key--) {
+			if (zk_lock_dlist_insert(bench.lock_dlist, (void *)key) != ZK_OK ||
+			    zk_dlist_push_front(&bench.list, (void *)key) != ZK_OK)
+				return 1;
+		}
+
+		uint64_t ns = bench_run_threads(threads, run_lock_dlist, &bench);
+		bench_report_throughput("zk_lock_dlist remove/insert", threads, threads * ops, ns);
+
+		ns = bench_run_threads(threads, run_mutex_dlist, &bench);
+		bench_report_throughput("zk_dlist remove/insert + mutex", threads, threads * ops, ns);
+
+		zk_lock_dlist_free(&bench.lock_dlist, NULL);
+		zk_dlist_free(&bench.list, NULL);
+		pthread_mutex_destroy(&bench.mutex);
+	}
+
+	return 0;
+}
@@ -0,0 +1,134 @@
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common/bench_common.h"
+#include "zk/zklib.h"
+#include "zk_node_cache/zk_node_cache.h"
+
+/*
+ * Allocator pressure of list churn: every thread owns its own zk_dlist and zk_c_dlist and repeatedly fills and empties
+ * it, so the only thing the threads share is the allocator. The malloc rows run the same allocation pattern without
+ * lists. Compare builds with `-Dnode_cache=false` to see the thread-local node cache against malloc() alone.
+ *
+ * The latency rows time every push of a fresh zk_c_slist, with and without a zk_c_slist_reserve() call beforehand.
+ */
+
+#define BENCH_DEFAULT_OPS (1u << 20)
+#define BENCH_MAX_THREADS 64
+#define BENCH_DEPTH       256
+#define BENCH_LATENCY_N   (1u << 16)
+
+struct bench_churn {
+	size_t ops;
+};
+
+static void run_dlist(size_t const thread, void *const arg)
+{
+	struct bench_churn *bench = arg;
+	zk_dlist *list = NULL;
+
+	for (size_t i = 0; i < bench->ops / BENCH_DEPTH; i++) {
+		for (size_t j = 0; j < BENCH_DEPTH; j++) {
+			if (zk_dlist_push_front(&list, (void *)(thread + 1)) != ZK_OK)
+				abort();
+		}
+		for (size_t j = 0; j < BENCH_DEPTH; j++)
+			zk_dlist_pop_front(&list, NULL);
+	}
+}
+
+static void run_c_dlist(size_t const thread, void *const arg)
+{
+	struct bench_churn *bench = arg;
+	zk_c_dlist *list = NULL;
+
+	for (size_t i = 0; i < bench->ops / BENCH_DEPTH; i++) {
+		for (size_t j = 0; j < BENCH_DEPTH; j++) {
+			if (zk_c_dlist_push_back(&list, (void *)(thread + 1)) != ZK_OK)
+				abort();
+		}
+		for (size_t j = 0; j < BENCH_DEPTH; j++)
+			zk_c_dlist_pop_front(&list, NULL);
+	}
+}
+
+static void run_malloc(size_t const thread, void *const arg)
+{
+	struct bench_churn *bench = arg;
+	void *nodes[BENCH_DEPTH];
+
+	ZK_UNUSED(thread);
+	for (size_t i = 0; i < bench->ops / BENCH_DEPTH; i++) {
+		for (size_t j = 0; j < BENCH_DEPTH; j++) {
+			nodes[j] = malloc(sizeof(zk_dlist));
+			if (nodes[j] == NULL)
+				abort();
+			*(void *volatile *)nodes[j] = nodes;
+		}
+		for (size_t j = 0; j < BENCH_DEPTH; j++)
+			free(nodes[j]);
+	}
+}
+
+static int compare_u64(const void *a, const void *b)
+{
+	uint64_t const x = *(const uint64_t *)a;
+	uint64_t const y = *(const uint64_t *)b;
+	return (x > y) - (x < y);
+}
+
+// Times each push onto an empty zk_c_slist, after reserving its nodes if `reserve` is set.
+static void bench_push_latency(const char *const name, bool const reserve, uint64_t *const push_ns)
+{
+	zk_c_slist *list = NULL;
+
+	zk_node_cache_trim();
+	uint64_t const start = bench_now_ns();
+	if (reserve && zk_c_slist_reserve(BENCH_LATENCY_N) != ZK_OK)
+		abort();
+	uint64_t const reserve_ns = bench_now_ns() - start;
+
+	for (size_t i = 0; i < BENCH_LATENCY_N; i++) {
+		uint64_t const push_start = bench_now_ns();
+		if (zk_c_slist_push_back(&list, (void *)(i + 1)) != ZK_OK)
+			abort();
+		push_ns[i] = bench_now_ns() - push_start;
+	}
+	zk_c_slist_free(&list, NULL);
+
+	qsort(push_ns, BENCH_LATENCY_N, sizeof(uint64_t), compare_u64);
+	printf("%-40s pushes=%-9u reserve %" PRIu64 " us, p99 %" PRIu64 " ns, p99.99 %" PRIu64 " ns, max %" PRIu64
+	       " ns\n",
+	       name, BENCH_LATENCY_N, reserve_ns / 1000, push_ns[BENCH_LATENCY_N * 99 / 100],
+	       push_ns[BENCH_LATENCY_N * 9999 / 10000], push_ns[BENCH_LATENCY_N - 1]);
+}
+
+int main(int argc, char *argv[])
+{
+	size_t const ops = argc > 1 ? strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_OPS;
+	size_t const max_threads = argc > 2 ? strtoul(argv[2], NULL, 10) : 16;
+	struct bench_churn bench = { .ops = ops };
+
+	printf("node cache: %d\n", ZK_NODE_CACHE);
+	for (size_t threads = 1; threads <= max_threads && threads <= BENCH_MAX_THREADS; threads *= 2) {
+		uint64_t ns = bench_run_threads(threads, run_dlist, &bench);
+		bench_report_throughput("zk_dlist push + pop", threads, threads * ops, ns);
+
+		ns = bench_run_threads(threads, run_c_dlist, &bench);
+		bench_report_throughput("zk_c_dlist push + pop", threads, threads * ops, ns);
+
+		ns = bench_run_threads(threads, run_malloc, &bench);
+		bench_report_throughput("malloc + free", threads, threads * ops, ns);
+	}
+
+	uint64_t *push_ns = malloc(BENCH_LATENCY_N * sizeof(uint64_t));
+	if (push_ns == NULL)
+		return 1;
+	bench_push_latency("zk_c_slist_push_back", false, push_ns);
+	bench_push_latency("zk_c_slist_push_back (reserved)", true, push_ns);
+	free(push_ns);
+
+	return 0;
+}
@@ -0,0 +1,111 @@
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common/bench_common.h"
+#include "zk/zklib.h"
+#include "zk_ebr/zk_ebr.h"
+#include "zk_rcu_dlist/zk_rcu_dlist.h"
+
+/*
+ * Read-mostly routing table: every thread looks up random keys in a small table, on the RCU list and on a zk_dlist
+ * behind a reader/writer lock, the setup it replaces. The lock is taken in read mode only, its counter is still
+ * written by every lookup. Each thread performs the same number of lookups whatever the thread count.
+ */
+
+#define BENCH_DEFAULT_OPS (1u << 20)
+#define BENCH_ROUTES      64
+#define BENCH_MAX_THREADS 64
+
+struct route {
+	uintptr_t key;
+	uintptr_t value;
+};
+
+struct bench_table {
+	zk_rcu_dlist *rcu_dlist;
+	zk_dlist *list;
+	pthread_rwlock_t rwlock;
+	struct route routes[BENCH_ROUTES];
+	size_t ops;
+};
+
+static int compare_key(const void *const a, const void *const b)
+{
+	uintptr_t const x = ((const struct route *)a)->key;
+	uintptr_t const y = ((const struct route *)b)->key;
+	return (x > y) - (x < y);
+}
+
+static bool match_key(const void *const data, void *user_data)
+{
+	return ((const struct route *)data)->key == *(uintptr_t *)user_data;
+}
+
+static uintptr_t next_key(uint64_t *const seed)
+{
+	*seed = *seed * 6364136223846793005u + 1442695040888963407u;
+	return (uintptr_t)(*seed >> 33) % BENCH_ROUTES;
+}
+
+static void run_rcu_dlist(size_t const thread, void *const arg)
+{
+	struct bench_table *bench = arg;
+	uint64_t seed = thread + 1;
+
+	for (size_t i = 0; i < bench->ops; i++) {
+		struct route const key = { next_key(&seed), 0 };
+		zk_ebr_enter();
+		struct route *route = zk_rcu_dlist_find(bench->rcu_dlist, &key, compare_key);
+		if (route == NULL || route->value != key.key)
+			abort();
+		zk_ebr_exit();
+	}
+}
+
+static void run_rwlock_dlist(size_t const thread, void *const arg)
+{
+	struct bench_table *bench = arg;
+	uint64_t seed = thread + 1;
+
+	for (size_t i = 0; i < bench->ops; i++) {
+		uintptr_t key = next_key(&seed);
+		pthread_rwlock_rdlock(&bench->rwlock);
+		zk_dlist *node = zk_dlist_find_if(bench->list, match_key, &key);
+		if (node == NULL || ((struct route *)node->data)->value != key)
+			abort();
+		pthread_rwlock_unlock(&bench->rwlock);
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	size_t const ops = argc > 1 ? strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_OPS;
+	size_t const max_threads = argc > 2 ? strtoul(argv[2], NULL, 10) : 16;
+	struct bench_table bench = { .ops = ops };
+
+	pthread_rwlock_init(&bench.rwlock, NULL);
+	if (zk_rcu_dlist_new(&bench.rcu_dlist) != ZK_OK)
+		return 1;
+	for (uintptr_t i = 0; i < BENCH_ROUTES; i++) {
+		bench.routes[i] = (struct route){ i, i };
+		if (zk_rcu_dlist_push_back(bench.rcu_dlist, &bench.routes[i]) != ZK_OK ||
+		    zk_dlist_push_back(&bench.list, &bench.routes[i]) != ZK_OK)
+			return 1;
+	}
+
+	for (size_t threads = 1; threads <= max_threads && threads <= BENCH_MAX_THREADS; threads *= 2) {
+		uint64_t ns = bench_run_threads(threads, run_rcu_dlist, &bench);
+		bench_report_throughput("zk_rcu_dlist find", threads, threads * ops, ns);
+
+		ns = bench_run_threads(threads, run_rwlock_dlist, &bench);
+		bench_report_throughput("zk_dlist find_if + rwlock", threads, threads * ops, ns);
+	}
+
+	zk_rcu_dlist_free(&bench.rcu_dlist, NULL);
+	zk_dlist_free(&bench.list, NULL);
+	pthread_rwlock_destroy(&bench.rwlock);
+
+	return 0;
+}
@@ -0,0 +1,50 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common/bench_common.h"
+#include "zk/zklib.h"
+
+/*
+ * Cost of dropping a large list with a destructor, as seen by the calling thread: zk_slist_free() walks and frees
+ * every node and payload, zk_slist_free_async() only hands the list to the reclaimer thread. The flush row is the time
+ * the reclaimer then needs, which the caller only pays if it waits for it.
+ */
+
+#define BENCH_DEFAULT_N (1u << 22)
+
+static zk_slist *new_list(size_t const n)
+{
+	zk_slist *list = NULL;
+	for (size_t i = 0; i < n; i++) {
+		long *payload = malloc(sizeof(long));
+		if (payload == NULL) {
+			fprintf(stderr, "out of memory\n");
+			exit(1);
+		}
+		*payload = (long)i;
+		list = zk_slist_push_front(list, payload);
+	}
+	return list;
+}
+
+int main(int argc, char *argv[])
+{
+	size_t const n = argc > 1 ? strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_N;
+
+	zk_slist *list = new_list(n);
+	uint64_t start = bench_now_ns();
+	zk_slist_free(&list, free);
+	bench_report("zk_slist_free", n, bench_now_ns() - start);
+
+	list = new_list(n);
+	start = bench_now_ns();
+	if (zk_slist_free_async(&list, free) != ZK_OK)
+		return 1;
+	bench_report("zk_slist_free_async (caller)", n, bench_now_ns() - start);
+
+	start = bench_now_ns();
+	zk_reclaim_flush();
+	bench_report("zk_reclaim_flush", n, bench_now_ns() - start);
+
+	return 0;
+}
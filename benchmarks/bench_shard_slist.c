@@ -0,0 +1,98 @@
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common/bench_common.h"
+#include "zk/zklib.h"
+#include "zk_shard_slist/zk_shard_slist.h"
+
+/*
+ * Collection workload: every thread appends its results to one logical list, on the sharded list and on a zk_slist
+ * behind a mutex, the setup it replaces. Each thread appends the same number of elements whatever the thread count,
+ * the combine rows then build the single list a consumer reads.
+ */
+
+#define BENCH_DEFAULT_OPS (1u << 16)
+#define BENCH_MAX_THREADS 64
+
+struct bench_collect {
+	zk_shard_slist *shard_slist;
+	zk_slist *list;
+	pthread_mutex_t mutex;
+	size_t ops;
+};
+
+static int compare_value(const void *const a, const void *const b)
+{
+	uintptr_t const x = (uintptr_t)a;
+	uintptr_t const y = (uintptr_t)b;
+	return (x > y) - (x < y);
+}
+
+static void run_shard_slist(size_t const thread, void *const arg)
+{
+	struct bench_collect *bench = arg;
+	uint64_t seed = thread + 1;
+
+	for (size_t i = 0; i < bench->ops; i++) {
+		seed = seed * 6364136223846793005u + 1442695040888963407u;
+		if (zk_shard_slist_push_back(bench->shard_slist, thread, (void *)(uintptr_t)(seed >> 33)) != ZK_OK)
+			abort();
+	}
+}
+
+static void run_mutex_slist(size_t const thread, void *const arg)
+{
+	struct bench_collect *bench = arg;
+	uint64_t seed = thread + 1;
+
+	for (size_t i = 0; i < bench->ops; i++) {
+		seed = seed * 6364136223846793005u + 1442695040888963407u;
+		pthread_mutex_lock(&bench->mutex);
+		zk_slist *list = zk_slist_push_front(bench->list, (void *)(uintptr_t)(seed >> 33));
+		if (list == NULL)
+			abort();
+		bench->list = list;
+		pthread_mutex_unlock(&bench->mutex);
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	size_t const ops = argc > 1 ? strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_OPS;
+	size_t const max_threads = argc > 2 ? strtoul(argv[2], NULL, 10) : 16;
+	struct bench_collect bench = { .ops = ops };
+
+	pthread_mutex_init(&bench.mutex, NULL);
+	for (size_t threads = 1; threads <= max_threads && threads <= BENCH_MAX_THREADS; threads *= 2) {
+		if (zk_shard_slist_new(&bench.shard_slist, threads) != ZK_OK)
+			return 1;
+		uint64_t ns = bench_run_threads(threads, run_shard_slist, &bench);
+		bench_report_throughput("zk_shard_slist push_back", threads, threads * ops, ns);
+
+		uint64_t start = bench_now_ns();
+		zk_slist *combined = zk_shard_slist_combine(bench.shard_slist);
+		bench_report("zk_shard_slist_combine", threads * ops, bench_now_ns() - start);
+		zk_slist_free(&combined, NULL);
+
+		// same appends again, to time the sorted combine on an identical list
+		bench_run_threads(threads, run_shard_slist, &bench);
+		start = bench_now_ns();
+		combined = zk_shard_slist_combine_sorted(bench.shard_slist, compare_value);
+		bench_report("zk_shard_slist_combine_sorted", threads * ops, bench_now_ns() - start);
+		zk_slist_free(&combined, NULL);
+		zk_shard_slist_free(&bench.shard_slist, NULL);
+
+		ns = bench_run_threads(threads, run_mutex_slist, &bench);
+		bench_report_throughput("zk_slist push_front + mutex", threads, threads * ops, ns);
+
+		start = bench_now_ns();
+		bench.list = zk_slist_sort(bench.list, compare_value);
+		bench_report("zk_slist_sort", threads * ops, bench_now_ns() - start);
+		zk_slist_free(&bench.list, NULL);
+	}
+	pthread_mutex_destroy(&bench.mutex);
+
+	return 0;
+}
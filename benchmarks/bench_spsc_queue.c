@@ -0,0 +1,153 @@
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common/bench_common.h"
+#include "zk/zklib.h"
+
+/*
+ * Pipeline stage hand-off between one producer and one consumer thread.
+ *
+ * Throughput: the producer streams `ops` elements to the consumer through the SPSC queue, one at a time and in
+ * batches, and through a zk_c_slist behind a mutex, the setup it replaces.
+ *
+ * Latency: two threads bounce one element back and forth over a pair of queues, the reported time per element is half
+ * a round trip. Both sides spin and yield when the queue is empty or full, so on a single core the numbers measure
+ * the scheduler rather than the queue.
+ */
+
+#define BENCH_DEFAULT_OPS  (1u << 22)
+#define BENCH_CAPACITY     1024
+#define BENCH_BATCH        ZK_BATCH_SIZE
+#define BENCH_ROUND_TRIPS  (1u << 16)
+
+struct bench_pipe {
+	zk_spsc_queue *queue;
+	zk_spsc_queue *reply;
+	zk_c_slist *list;
+	pthread_mutex_t mutex;
+	size_t ops;
+};
+
+static void run_spsc(size_t const thread, void *const arg)
+{
+	struct bench_pipe *bench = arg;
+	void *data = NULL;
+
+	for (uintptr_t i = 1; i <= bench->ops; i++) {
+		if (thread == 0) {
+			while (!zk_spsc_queue_enqueue(bench->queue, (void *)i))
+				sched_yield();
+		} else {
+			while (!zk_spsc_queue_dequeue(bench->queue, &data))
+				sched_yield();
+			if (data != (void *)i)
+				abort();
+		}
+	}
+}
+
+static void run_spsc_batch(size_t const thread, void *const arg)
+{
+	struct bench_pipe *bench = arg;
+	void *batch[BENCH_BATCH];
+	uintptr_t next = 1;
+
+	while (next <= bench->ops) {
+		size_t n = bench->ops - next + 1 < BENCH_BATCH ? bench->ops - next + 1 : BENCH_BATCH;
+		if (thread == 0) {
+			for (size_t i = 0; i < n; i++)
+				batch[i] = (void *)(next + i);
+			n = zk_spsc_queue_enqueue_batch(bench->queue, batch, n);
+		} else {
+			n = zk_spsc_queue_dequeue_batch(bench->queue, batch, n);
+			for (size_t i = 0; i < n; i++) {
+				if (batch[i] != (void *)(next + i))
+					abort();
+			}
+		}
+		next += n;
+		if (n == 0)
+			sched_yield();
+	}
+}
+
+static void run_mutex_c_slist(size_t const thread, void *const arg)
+{
+	struct bench_pipe *bench = arg;
+
+	for (uintptr_t i = 1; i <= bench->ops; i++) {
+		if (thread == 0) {
+			pthread_mutex_lock(&bench->mutex);
+			zk_status const status = zk_c_slist_push_back(&bench->list, (void *)i);
+			pthread_mutex_unlock(&bench->mutex);
+			if (status != ZK_OK)
+				abort();
+			continue;
+		}
+		for (;;) {
+			void *data = NULL;
+			pthread_mutex_lock(&bench->mutex);
+			if (bench->list != NULL) {
+				zk_c_slist_get_data(bench->list->next, &data);
+				zk_c_slist_pop_front(&bench->list, NULL);
+			}
+			pthread_mutex_unlock(&bench->mutex);
+			if (data == (void *)i)
+				break;
+			if (data != NULL)
+				abort();
+			sched_yield();
+		}
+	}
+}
+
+static void run_ping_pong(size_t const thread, void *const arg)
+{
+	struct bench_pipe *bench = arg;
+	zk_spsc_queue *const in = thread == 0 ? bench->reply : bench->queue;
+	zk_spsc_queue *const out = thread == 0 ? bench->queue : bench->reply;
+	void *data = NULL;
+
+	if (thread == 0)
+		zk_spsc_queue_enqueue(out, (void *)1);
+	for (size_t i = 0; i < bench->ops; i++) {
+		while (!zk_spsc_queue_dequeue(in, &data))
+			sched_yield();
+		if (thread == 0 && i + 1 == bench->ops)
+			break;
+		zk_spsc_queue_enqueue(out, data);
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	size_t const ops = argc > 1 ? strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_OPS;
+	struct bench_pipe bench = { .ops = ops };
+
+	pthread_mutex_init(&bench.mutex, NULL);
+	if (zk_spsc_queue_new(&bench.queue, BENCH_CAPACITY) != ZK_OK ||
+	    zk_spsc_queue_new(&bench.reply, BENCH_CAPACITY) != ZK_OK)
+		return 1;
+
+	uint64_t ns = bench_run_threads(2, run_spsc, &bench);
+	bench_report_throughput("zk_spsc_queue enqueue/dequeue", 2, ops, ns);
+
+	ns = bench_run_threads(2, run_spsc_batch, &bench);
+	bench_report_throughput("zk_spsc_queue batch", 2, ops, ns);
+
+	ns = bench_run_threads(2, run_mutex_c_slist, &bench);
+	bench_report_throughput("zk_c_slist push/pop + mutex", 2, ops, ns);
+
+	bench.ops = argc > 2 ? strtoul(argv[2], NULL, 10) : BENCH_ROUND_TRIPS;
+	ns = bench_run_threads(2, run_ping_pong, &bench);
+	bench_report("zk_spsc_queue one-way latency", 2 * bench.ops, ns);
+
+	zk_spsc_queue_free(&bench.queue, NULL);
+	zk_spsc_queue_free(&bench.reply, NULL);
+	pthread_mutex_destroy(&bench.mutex);
+
+	return 0;
+}
@@ -0,0 +1,217 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common/bench_common.h"
+#include "zk/zklib.h"
+
+/*
+ * Traversal kernels over cold, heap-scattered lists. Every run starts with evicted caches, and nodes and payloads are
+ * allocated at scattered addresses so the hardware prefetcher cannot follow the chain. The slist "baseline" rows walk
+ * the list without software prefetching, to compare with the library kernels built with the `prefetch_distance`
+ * option. Compare the other containers across builds with `-Dprefetch_distance=0`.
+ */
+
+#define BENCH_DEFAULT_N (1u << 20)
+
+struct payload {
+	uint64_t key;
+	long value;
+};
+
+static void sum_values(void *data, void *user_data)
+{
+	*(long *)user_data += ((struct payload *)data)->value;
+}
+
+static void sum_values_batch(void **data, size_t const count, void *user_data)
+{
+	long sum = 0;
+	for (size_t i = 0; i < count; i++)
+		sum += ((struct payload *)data[i])->value;
+	*(long *)user_data += sum;
+}
+
+static int64_t add_value(int64_t acc, const void *const data, void *user_data)
+{
+	ZK_UNUSED(user_data);
+	return acc + ((const struct payload *)data)->value;
+}
+
+static int compare_value(const void *const a, const void *const b)
+{
+	long const va = ((const struct payload *)a)->value;
+	long const vb = *(const long *)b;
+	return (va > vb) - (va < vb);
+}
+
+static int compare_key(const void *const a, const void *const b)
+{
+	uint64_t const ka = ((const struct payload *)a)->key;
+	uint64_t const kb = ((const struct payload *)b)->key;
+	return (ka > kb) - (ka < kb);
+}
+
+static struct payload *new_payload(long const value)
+{
+	struct payload *payload = malloc(sizeof(struct payload));
+	if (payload == NULL) {
+		fprintf(stderr, "out of memory\n");
+		exit(1);
+	}
+	payload->key = bench_rand();
+	payload->value = value;
+	return payload;
+}
+
+static void bench_slist(size_t const n)
+{
+	zk_slist *list = NULL;
+
+	void *scatter = bench_scatter_heap(sizeof(zk_slist), n);
+	for (size_t i = 0; i < n; i++)
+		list = zk_slist_push_front(list, new_payload((long)i));
+	// link order follows the random keys, not the allocation order
+	list = zk_slist_sort(list, compare_key);
+
+	long sum = 0;
+	zk_for_each_func volatile baseline_func = sum_values;
+	bench_flush_caches();
+	uint64_t start = bench_now_ns();
+	for (zk_slist *node = list; node; node = node->next)
+		baseline_func(node->data, &sum);
+	bench_report("zk_slist for_each (baseline)", n, bench_now_ns() - start);
+
+	bench_flush_caches();
+	start = bench_now_ns();
+	zk_slist_for_each(list, NULL, sum_values, &sum);
+	bench_report("zk_slist_for_each", n, bench_now_ns() - start);
+
+	bench_flush_caches();
+	start = bench_now_ns();
+	zk_slist_for_each_batch(list, NULL, sum_values_batch, &sum);
+	bench_report("zk_slist_for_each_batch", n, bench_now_ns() - start);
+
+	bench_flush_caches();
+	start = bench_now_ns();
+	sum += zk_fold_int(list, 0, add_value, NULL);
+	bench_report("zk_fold_int", n, bench_now_ns() - start);
+
+	long const missing = -1;
+	zk_compare_func volatile baseline_compare = compare_value;
+	bench_flush_caches();
+	start = bench_now_ns();
+	zk_slist *found = list;
+	while (found && baseline_compare(found->data, &missing) != 0)
+		found = found->next;
+	bench_report("zk_slist find miss (baseline)", n, bench_now_ns() - start);
+
+	bench_flush_caches();
+	start = bench_now_ns();
+	found = zk_slist_find(list, &missing, compare_value);
+	bench_report("zk_slist_find miss", n, bench_now_ns() - start);
+
+	bench_flush_caches();
+	start = bench_now_ns();
+	size_t const size = zk_slist_size(list);
+	bench_report("zk_slist_size", n, bench_now_ns() - start);
+
+	bench_flush_caches();
+	start = bench_now_ns();
+	zk_slist_free(&list, free);
+	bench_report("zk_slist_free", n, bench_now_ns() - start);
+	bench_scatter_release(scatter, n);
+
+	if (found != NULL || size != n || sum == 0)
+		fprintf(stderr, "unexpected result\n");
+}
+
+static void bench_dlist(size_t const n)
+{
+	zk_dlist *list = NULL;
+
+	void *scatter = bench_scatter_heap(3 * sizeof(void *), n);
+	for (size_t i = 0; i < n; i++)
+		zk_dlist_push_front(&list, new_payload((long)i));
+
+	long sum = 0;
+	bench_flush_caches();
+	uint64_t start = bench_now_ns();
+	zk_for_each(list, sum_values, &sum);
+	bench_report("zk_dlist_for_each", n, bench_now_ns() - start);
+
+	bench_flush_caches();
+	start = bench_now_ns();
+	zk_for_each_batch(list, sum_values_batch, &sum);
+	bench_report("zk_dlist_for_each_batch", n, bench_now_ns() - start);
+
+	bench_flush_caches();
+	start = bench_now_ns();
+	zk_free(&list, free);
+	bench_report("zk_dlist_free", n, bench_now_ns() - start);
+	bench_scatter_release(scatter, n);
+}
+
+static void bench_c_slist(size_t const n)
+{
+	zk_c_slist *list = NULL;
+
+	void *scatter = bench_scatter_heap(2 * sizeof(void *), n);
+	for (size_t i = 0; i < n; i++)
+		zk_c_slist_push_back(&list, new_payload((long)i));
+
+	long sum = 0;
+	bench_flush_caches();
+	uint64_t start = bench_now_ns();
+	zk_for_each(list, sum_values, &sum);
+	bench_report("zk_c_slist_for_each", n, bench_now_ns() - start);
+
+	bench_flush_caches();
+	start = bench_now_ns();
+	zk_for_each_batch(list, sum_values_batch, &sum);
+	bench_report("zk_c_slist_for_each_batch", n, bench_now_ns() - start);
+
+	bench_flush_caches();
+	start = bench_now_ns();
+	zk_free(&list, free);
+	bench_report("zk_c_slist_free", n, bench_now_ns() - start);
+	bench_scatter_release(scatter, n);
+}
+
+static void bench_c_dlist(size_t const n)
+{
+	zk_c_dlist *list = NULL;
+
+	void *scatter = bench_scatter_heap(3 * sizeof(void *), n);
+	for (size_t i = 0; i < n; i++)
+		zk_c_dlist_push_back(&list, new_payload((long)i));
+
+	long sum = 0;
+	bench_flush_caches();
+	uint64_t start = bench_now_ns();
+	zk_for_each(list, sum_values, &sum);
+	bench_report("zk_c_dlist_for_each", n, bench_now_ns() - start);
+
+	bench_flush_caches();
+	start = bench_now_ns();
+	zk_for_each_batch(list, sum_values_batch, &sum);
+	bench_report("zk_c_dlist_for_each_batch", n, bench_now_ns() - start);
+
+	bench_flush_caches();
+	start = bench_now_ns();
+	zk_free(&list, free);
+	bench_report("zk_c_dlist_free", n, bench_now_ns() - start);
+	bench_scatter_release(scatter, n);
+}
+
+int main(int argc, char *argv[])
+{
+	size_t const n = argc > 1 ? strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_N;
+
+	printf("prefetch distance: %d\n", ZK_PREFETCH_DISTANCE);
+	bench_slist(n);
+	bench_dlist(n);
+	bench_c_slist(n);
+	bench_c_dlist(n);
+
+	return 0;
+}
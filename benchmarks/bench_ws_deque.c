@@ -0,0 +1,163 @@
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common/bench_common.h"
+#include "zk/zklib.h"
+#include "zk_ws_deque/zk_ws_deque.h"
+
+/*
+ * Fork-join task tree: the task `n` forks the tasks `n - 1` and `n - 2` until `n` drops below 2, like a naive
+ * recursive Fibonacci. Every worker runs the tasks of its own deque and steals from a random victim when it runs dry.
+ * The baseline gives every worker a zk_c_dlist behind a mutex, the owner working at the back and the thieves at the
+ * front. The whole tree is shared between the threads, so the runs with more threads should finish faster.
+ */
+
+#define BENCH_DEFAULT_DEPTH 24
+#define BENCH_LEAF_WORK     64
+#define BENCH_MAX_THREADS   64
+
+struct bench_worker {
+	_Alignas(ZK_CACHE_LINE) zk_ws_deque *deque;
+	zk_c_dlist *list;
+	pthread_mutex_t mutex;
+};
+
+struct bench_pool {
+	struct bench_worker workers[BENCH_MAX_THREADS];
+	size_t threads;
+	size_t pending;
+	size_t depth;
+};
+
+// Returns the tasks forked by `task`, counted in `pending` before they become visible to the thieves.
+static size_t run_task(struct bench_pool *const pool, uintptr_t const task, void *forked[2])
+{
+	if (task < 2) {
+		uint64_t volatile sink = task;
+		for (size_t i = 0; i < BENCH_LEAF_WORK; i++)
+			sink = sink * 6364136223846793005u + 1442695040888963407u;
+		__atomic_fetch_sub(&pool->pending, 1, __ATOMIC_RELEASE);
+		return 0;
+	}
+	// two tasks forked, one task done
+	__atomic_fetch_add(&pool->pending, 1, __ATOMIC_RELAXED);
+	forked[0] = (void *)(task - 1);
+	forked[1] = (void *)(task - 2);
+	return 2;
+}
+
+static size_t next_victim(uint64_t *const seed, size_t const threads)
+{
+	*seed = *seed * 6364136223846793005u + 1442695040888963407u;
+	return (size_t)(*seed >> 33) % threads;
+}
+
+static void run_ws_deque(size_t const thread, void *const arg)
+{
+	struct bench_pool *pool = arg;
+	zk_ws_deque *deque = pool->workers[thread].deque;
+	uint64_t seed = thread + 1;
+	void *forked[2];
+	void *task = NULL;
+
+	if (thread == 0 && zk_ws_deque_push_bottom(deque, (void *)pool->depth) != ZK_OK)
+		abort();
+	while (__atomic_load_n(&pool->pending, __ATOMIC_ACQUIRE) > 0) {
+		if (!zk_ws_deque_pop_bottom(deque, &task) &&
+		    !zk_ws_deque_steal(pool->workers[next_victim(&seed, pool->threads)].deque, &task))
+			continue;
+		for (size_t i = run_task(pool, (uintptr_t)task, forked); i > 0; i--) {
+			if (zk_ws_deque_push_bottom(deque, forked[i - 1]) != ZK_OK)
+				abort();
+		}
+	}
+}
+
+static bool mutex_c_dlist_pop(struct bench_worker *const worker, bool const back, void **const task)
+{
+	bool found = false;
+	pthread_mutex_lock(&worker->mutex);
+	if (worker->list != NULL) {
+		zk_c_dlist *node = back ? worker->list->prev : worker->list;
+		*task = node->data;
+		if ((back ? zk_c_dlist_pop_back(&worker->list, NULL) : zk_c_dlist_pop_front(&worker->list, NULL)) != ZK_OK)
+			abort();
+		found = true;
+	}
+	pthread_mutex_unlock(&worker->mutex);
+	return found;
+}
+
+static void mutex_c_dlist_push(struct bench_worker *const worker, void *const task)
+{
+	pthread_mutex_lock(&worker->mutex);
+	if (zk_c_dlist_push_back(&worker->list, task) != ZK_OK)
+		abort();
+	pthread_mutex_unlock(&worker->mutex);
+}
+
+static void run_mutex_c_dlist(size_t const thread, void *const arg)
+{
+	struct bench_pool *pool = arg;
+	struct bench_worker *worker = &pool->workers[thread];
+	uint64_t seed = thread + 1;
+	void *forked[2];
+	void *task = NULL;
+
+	if (thread == 0)
+		mutex_c_dlist_push(worker, (void *)pool->depth);
+	while (__atomic_load_n(&pool->pending, __ATOMIC_ACQUIRE) > 0) {
+		if (!mutex_c_dlist_pop(worker, true, &task) &&
+		    !mutex_c_dlist_pop(&pool->workers[next_victim(&seed, pool->threads)], false, &task))
+			continue;
+		for (size_t i = run_task(pool, (uintptr_t)task, forked); i > 0; i--)
+			mutex_c_dlist_push(worker, forked[i - 1]);
+	}
+}
+
+// Number of tasks in the tree of `depth`.
+static size_t count_tasks(size_t const depth)
+{
+	size_t a = 1, b = 1;
+	for (size_t i = 0; i < depth; i++) {
+		size_t const c = a + b + 1;
+		a = b;
+		b = c;
+	}
+	return a;
+}
+
+int main(int argc, char *argv[])
+{
+	size_t const depth = argc > 1 ? strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_DEPTH;
+	size_t const max_threads = argc > 2 ? strtoul(argv[2], NULL, 10) : 16;
+	size_t const tasks = count_tasks(depth);
+	static struct bench_pool pool;
+
+	pool.depth = depth;
+	for (size_t i = 0; i < BENCH_MAX_THREADS; i++) {
+		if (zk_ws_deque_new(&pool.workers[i].deque, 64) != ZK_OK)
+			return 1;
+		pthread_mutex_init(&pool.workers[i].mutex, NULL);
+	}
+
+	for (size_t threads = 1; threads <= max_threads && threads <= BENCH_MAX_THREADS; threads *= 2) {
+		pool.threads = threads;
+		pool.pending = 1;
+		uint64_t ns = bench_run_threads(threads, run_ws_deque, &pool);
+		bench_report_throughput("zk_ws_deque fork-join", threads, tasks, ns);
+
+		pool.pending = 1;
+		ns = bench_run_threads(threads, run_mutex_c_dlist, &pool);
+		bench_report_throughput("zk_c_dlist + mutex fork-join", threads, tasks, ns);
+	}
+
+	for (size_t i = 0; i < BENCH_MAX_THREADS; i++) {
+		zk_ws_deque_free(&pool.workers[i].deque, NULL);
+		pthread_mutex_destroy(&pool.workers[i].mutex);
+	}
+
+	return 0;
+}
@@ -0,0 +1,134 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "common/bench_common.h"
+
+#define BENCH_FLUSH_SIZE (64 * 1024 * 1024)
+
+static uint64_t bench_rand_state = 0x9e3779b97f4a7c15u;
+
+uint64_t bench_now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+void bench_flush_caches(void)
+{
+	static volatile unsigned char *buffer = NULL;
+	if (buffer == NULL) {
+		buffer = malloc(BENCH_FLUSH_SIZE);
+		if (buffer == NULL)
+			return;
+	}
+	for (size_t i = 0; i < BENCH_FLUSH_SIZE; i += 64)
+		buffer[i]++;
+}
+
+void *bench_scatter_heap(size_t const size, size_t const count)
+{
+	void **blocks = malloc(2 * count * sizeof(void *));
+	if (blocks == NULL)
+		return NULL;
+
+	for (size_t i = 0; i < 2 * count; i++)
+		blocks[i] = malloc(size);
+
+	// free every other block in random order; the ones kept in between stop the allocator from coalescing the
+	// freed blocks back into a sequential region
+	size_t *order = malloc(count * sizeof(size_t));
+	if (order != NULL) {
+		for (size_t i = 0; i < count; i++)
+			order[i] = 2 * i;
+		for (size_t i = count; i > 1; i--) {
+			size_t j = bench_rand() % i;
+			size_t tmp = order[i - 1];
+			order[i - 1] = order[j];
+			order[j] = tmp;
+		}
+		for (size_t i = 0; i < count; i++) {
+			free(blocks[order[i]]);
+			blocks[order[i]] = NULL;
+		}
+		free(order);
+	}
+
+	return blocks;
+}
+
+void bench_scatter_release(void *const scatter, size_t const count)
+{
+	void **blocks = scatter;
+	if (blocks != NULL) {
+		for (size_t i = 0; i < 2 * count; i++)
+			free(blocks[i]);
+		free(blocks);
+	}
+}
+
+uint64_t bench_rand(void)
+{
+	// xorshift64
+	bench_rand_state ^= bench_rand_state << 13;
+	bench_rand_state ^= bench_rand_state >> 7;
+	bench_rand_state ^= bench_rand_state << 17;
+	return bench_rand_state;
+}
+
+void bench_report(const char *const name, size_t const n, uint64_t const ns)
+{
+	printf("%-40s n=%-10zu %10.3f ms %8.2f ns/elem\n", name, n, (double)ns / 1e6, n ? (double)ns / (double)n : 0.0);
+}
+
+struct bench_thread {
+	pthread_t handle;
+	size_t index;
+	bench_thread_func func;
+	void *arg;
+	pthread_barrier_t *barrier;
+};
+
+static void *bench_thread_main(void *arg)
+{
+	struct bench_thread *thread = arg;
+	pthread_barrier_wait(thread->barrier);
+	thread->func(thread->index, thread->arg);
+	return NULL;
+}
+
+uint64_t bench_run_threads(size_t const threads, bench_thread_func const func, void *const arg)
+{
+	struct bench_thread *workers = malloc(threads * sizeof(struct bench_thread));
+	pthread_barrier_t barrier;
+	if (workers == NULL || pthread_barrier_init(&barrier, NULL, (unsigned)threads + 1) != 0) {
+		fprintf(stderr, "cannot start %zu threads\n", threads);
+		exit(1);
+	}
+
+	for (size_t i = 0; i < threads; i++) {
+		workers[i] = (struct bench_thread){ .index = i, .func = func, .arg = arg, .barrier = &barrier };
+		if (pthread_create(&workers[i].handle, NULL, bench_thread_main, &workers[i]) != 0) {
+			fprintf(stderr, "cannot start %zu threads\n", threads);
+			exit(1);
+		}
+	}
+
+	pthread_barrier_wait(&barrier);
+	uint64_t const start = bench_now_ns();
+	for (size_t i = 0; i < threads; i++)
+		pthread_join(workers[i].handle, NULL);
+	uint64_t const ns = bench_now_ns() - start;
+
+	pthread_barrier_destroy(&barrier);
+	free(workers);
+	return ns;
+}
+
+void bench_report_throughput(const char *const name, size_t const threads, size_t const ops, uint64_t const ns)
+{
+	printf("%-40s threads=%-4zu ops=%-10zu %10.3f ms %8.2f Mops/s\n", name, threads, ops, (double)ns / 1e6,
+	       ns ? (double)ops * 1e3 / (double)ns : 0.0);
+}
@@ -0,0 +1,54 @@
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Returns a monotonic timestamp in nanoseconds.
+ */
+uint64_t bench_now_ns(void);
+
+/**
+ * @brief Evicts the data caches by streaming through a buffer larger than the last level cache.
+ */
+void bench_flush_caches(void);
+
+/**
+ * @brief Fragments the heap so that the next `count` allocations of `size` bytes are handed out at scattered addresses
+ *        rather than sequentially.
+ *
+ * @return Handle to the blocks kept allocated, to be released with bench_scatter_release() once the list is freed.
+ */
+void *bench_scatter_heap(size_t const size, size_t const count);
+
+/**
+ * @brief Releases the blocks kept by bench_scatter_heap().
+ */
+void bench_scatter_release(void *const scatter, size_t const count);
+
+/**
+ * @brief Returns a pseudo random number, deterministic across runs.
+ */
+uint64_t bench_rand(void);
+
+/**
+ * @brief Prints one result line: name, element count, total time and time per element.
+ */
+void bench_report(const char *const name, size_t const n, uint64_t const ns);
+
+typedef void (*bench_thread_func)(size_t const thread, void *const arg);
+
+/**
+ * @brief Runs func(i, arg) on `threads` threads, i in [0, threads). All threads are released together once started.
+ *
+ * @return Time from the release of the threads to the end of the last one, in nanoseconds.
+ */
+uint64_t bench_run_threads(size_t const threads, bench_thread_func const func, void *const arg);
+
+/**
+ * @brief Prints one throughput line: name, thread count, total operations, total time and operations per second.
+ */
+void bench_report_throughput(const char *const name, size_t const threads, size_t const ops, uint64_t const ns);
+
+#endif
@@ -8,6 +8,7 @@ BUILDTYPE=${BUILDTYPE:-"debug"}
 fast_build=0
 build_gcov="false"
 unit_test="false"
+benchmarks="false"
 
 usage()
 {
@@ -18,6 +19,7 @@ usage()
 	echo "    -f   Incremental build."
 	echo "    -g   Build with Gcov."
 	echo "    -u   Build with unit tests."
+	echo "    -b   Build with benchmarks."
 }
 
 cleanup() {
@@ -28,7 +30,7 @@ main()
 {
 	_start_time="$(date "+%s")"
 
-	while getopts ":hfgu" _options; do
+	while getopts ":hfgub" _options; do
 		case "${_options}" in
 		h)
 			usage
@@ -46,6 +48,10 @@ main()
 			unit_test="true"
 			echo "info" "Build with unit tests"
 			;;
+		b)
+			benchmarks="true"
+			echo "info" "Build with benchmarks"
+			;;
 		:)
 			echo "Option -${OPTARG} requires an argument."
 			exit 1
@@ -61,6 +67,7 @@ main()
 		rm -rf "${BUILDDIR}"
 		meson setup \
 			-Dunit_test=${unit_test} \
+			-Dbenchmarks=${benchmarks} \
 			-Db_coverage=${build_gcov} \
 			--buildtype "${BUILDTYPE}" "${BUILDDIR}"
 	fi
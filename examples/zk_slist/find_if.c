@@ -0,0 +1,39 @@
+#include <stdio.h>
+
+#include "zk/zklib.h"
+
+struct person {
+	char *name;
+	unsigned int age;
+};
+
+bool zk_person_is_older_than(const void *const person, void *age)
+{
+	return ((struct person *)person)->age > *(unsigned int *)age;
+}
+
+int main()
+{
+	zk_slist *list = NULL;
+
+	struct person persons[] = {
+		{ "Andrew", 25 },
+		{ "Thiago", 23 },
+		{ "Simon", 27 },
+		{ "John", 30 },
+	};
+	for (int i = 0; i < 4; i++) {
+		list = zk_slist_push_back(list, &persons[i]);
+	}
+
+	unsigned int age = 26;
+	// stops at Simon, John is never visited
+	zk_slist *person = zk_find_if(list, zk_person_is_older_than, &age);
+	if (person)
+		printf("First person older than %u: %s\n", age, ((struct person *)person->data)->name);
+
+	printf("Persons older than %u: %zu\n", age, zk_count_if(list, zk_person_is_older_than, &age));
+
+	zk_free(&list, NULL);
+	return 0;
+}
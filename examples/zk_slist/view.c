@@ -0,0 +1,46 @@
+#include <stdio.h>
+
+#include "zk/zklib.h"
+
+struct person {
+	char *name;
+	unsigned int age;
+};
+
+bool zk_person_is_older_than(const void *const person, void *age)
+{
+	return ((struct person *)person)->age > *(unsigned int *)age;
+}
+
+void *zk_person_name(void *person, void *user_data)
+{
+	ZK_UNUSED(user_data);
+	return ((struct person *)person)->name;
+}
+
+void zk_print_name(void *name, void *user_data)
+{
+	ZK_UNUSED(user_data);
+	printf("%s\n", (char *)name);
+}
+
+int main()
+{
+	zk_slist *list = NULL;
+
+	struct person persons[] = {
+		{ "Andrew", 25 }, { "Thiago", 23 }, { "Simon", 27 }, { "John", 30 }, { "Maria", 41 },
+	};
+	for (int i = 0; i < 5; i++) {
+		list = zk_slist_push_back(list, &persons[i]);
+	}
+
+	unsigned int age = 26;
+	// names of the first two persons older than 26, in one pass over the list and without building a new list
+	zk_view view = zk_view_of(list);
+	zk_view_take(zk_view_map(zk_view_filter(&view, zk_person_is_older_than, &age), zk_person_name, NULL), 2);
+	zk_view_for_each(&view, zk_print_name, NULL);
+
+	zk_free(&list, NULL);
+	return 0;
+}
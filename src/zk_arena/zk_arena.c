@@ -0,0 +1,180 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/mman.h>
+
+#include "zk_arena/zk_arena.h"
+
+/*
+ * Bump allocator over a single anonymous mapping, for lists of millions of nodes that are built once, traversed many
+ * times and dropped as a whole. Nodes packed in 2 MB pages need one TLB entry per 2 MB instead of one per 4 KB, which
+ * is most of the cost of chasing pointers through a list larger than the TLB reach.
+ *
+ * The mapping first asks for explicit huge pages with MAP_HUGETLB, which only succeeds when the administrator reserved
+ * them (vm.nr_hugepages). Otherwise it falls back to a regular mapping aligned to ZK_ARENA_HUGE_PAGE_SIZE and advised
+ * with MADV_HUGEPAGE, which the kernel backs with transparent huge pages when it can and with 4 KB pages otherwise.
+ * The arena header lives at the start of its own mapping, so zk_arena_free() releases everything with one munmap().
+ *
+ * Memory is never given back to the arena: nodes are not freed one by one, the lists built on an arena are dropped
+ * together with it, see zk_slist_free_arena().
+ */
+
+#define ZK_ARENA_ALIGNMENT _Alignof(max_align_t)
+
+/**
+ * @brief Arena struct, stored at the start of the mapping it describes.
+ */
+struct zk_arena {
+	size_t mapped;
+	size_t used;
+	zk_arena_pages pages;
+	_Alignas(max_align_t) unsigned char memory[];
+};
+
+// Private functions
+static size_t zk_arena_round_up(size_t const n, size_t const alignment)
+{
+	return (n + alignment - 1) & ~(alignment - 1);
+}
+
+static void *zk_arena_map_hugetlb(size_t const mapped)
+{
+#ifdef MAP_HUGETLB
+	void *base = mmap(NULL, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+	return base == MAP_FAILED ? NULL : base;
+#else
+	ZK_UNUSED(mapped);
+	return NULL;
+#endif
+}
+
+// Maps `mapped` bytes aligned to ZK_ARENA_HUGE_PAGE_SIZE, so that every huge page of the range can be a real one.
+static void *zk_arena_map_aligned(size_t const mapped)
+{
+	size_t const padded = mapped + ZK_ARENA_HUGE_PAGE_SIZE;
+	unsigned char *raw = mmap(NULL, padded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (raw == MAP_FAILED)
+		return NULL;
+
+	unsigned char *base = (unsigned char *)zk_arena_round_up((uintptr_t)raw, ZK_ARENA_HUGE_PAGE_SIZE);
+	size_t const head = (size_t)(base - raw);
+	if (head > 0)
+		munmap(raw, head);
+	if (padded - head > mapped)
+		munmap(base + mapped, padded - head - mapped);
+
+	return base;
+}
+
+// Constructor
+
+/**
+ * @brief Creates an arena able to hold `bytes` bytes of nodes, backed by huge pages when the platform provides them.
+ *        The address space is reserved up front. With MAP_HUGETLB the huge pages are also reserved from the pool
+ *        right away, otherwise physical pages are only used once touched.
+ *
+ * @param arena_p Pointer to the arena to create.
+ * @param bytes Capacity of the arena. It is rounded up to a multiple of ZK_ARENA_HUGE_PAGE_SIZE, minus a small header.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if arguments are invalid or ZK_ERROR_ALLOC if the memory cannot be
+ *         mapped.
+ */
+zk_status zk_arena_new(zk_arena **arena_p, size_t const bytes)
+{
+	if (arena_p == NULL || bytes == 0)
+		return ZK_INVALID_ARGUMENT;
+	if (bytes > SIZE_MAX / 2 - 2 * ZK_ARENA_HUGE_PAGE_SIZE)
+		return ZK_ERROR_ALLOC;
+
+	size_t const mapped = zk_arena_round_up(offsetof(zk_arena, memory) + bytes, ZK_ARENA_HUGE_PAGE_SIZE);
+	zk_arena_pages pages = ZK_ARENA_PAGES_HUGETLB;
+	zk_arena *arena = zk_arena_map_hugetlb(mapped);
+	if (arena == NULL) {
+		arena = zk_arena_map_aligned(mapped);
+		if (arena == NULL)
+			return ZK_ERROR_ALLOC;
+
+		pages = ZK_ARENA_PAGES_DEFAULT;
+#ifdef MADV_HUGEPAGE
+		if (madvise(arena, mapped, MADV_HUGEPAGE) == 0)
+			pages = ZK_ARENA_PAGES_TRANSPARENT;
+#endif
+	}
+
+	arena->mapped = mapped;
+	arena->used = 0;
+	arena->pages = pages;
+
+	*arena_p = arena;
+	return ZK_OK;
+}
+
+// Destructor
+
+/**
+ * @brief Releases the arena and every node allocated from it with a single munmap().
+ *
+ * @param arena_p Pointer to the arena. It is set to NULL.
+ *
+ * @note Time complexity: O(1), plus the kernel work to unmap the pages touched.
+ */
+void zk_arena_free(zk_arena **arena_p)
+{
+	if (arena_p != NULL && *arena_p != NULL) {
+		munmap(*arena_p, (*arena_p)->mapped);
+		*arena_p = NULL;
+	}
+}
+
+// Capacity
+size_t zk_arena_capacity(const zk_arena *const arena)
+{
+	return arena ? arena->mapped - offsetof(zk_arena, memory) : 0;
+}
+
+size_t zk_arena_size(const zk_arena *const arena)
+{
+	return arena ? arena->used : 0;
+}
+
+/**
+ * @brief Reports which pages back the arena. ZK_ARENA_PAGES_TRANSPARENT only means the kernel accepted the advice,
+ *        whether it actually used huge pages shows in AnonHugePages of /proc/self/smaps.
+ */
+zk_arena_pages zk_arena_get_pages(const zk_arena *const arena)
+{
+	return arena ? arena->pages : ZK_ARENA_PAGES_DEFAULT;
+}
+
+// Lookup
+bool zk_arena_contains(const zk_arena *const arena, const void *const ptr)
+{
+	if (arena == NULL)
+		return false;
+
+	uintptr_t const begin = (uintptr_t)arena->memory;
+	return (uintptr_t)ptr >= begin && (uintptr_t)ptr < begin + arena->used;
+}
+
+// Modifiers
+
+/**
+ * @brief Allocates `size` bytes from the arena, aligned for any type. Consecutive allocations are adjacent in memory.
+ *
+ * @return Pointer to the memory, or NULL if `arena` is NULL, `size` is 0 or the arena is full.
+ *
+ * @note Time complexity: O(1)
+ */
+void *zk_arena_alloc(zk_arena *const arena, size_t const size)
+{
+	if (arena == NULL || size == 0)
+		return NULL;
+
+	size_t const capacity = arena->mapped - offsetof(zk_arena, memory);
+	if (size > capacity - arena->used)
+		return NULL;
+
+	// the capacity is a multiple of the alignment, so rounding up never goes past it
+	void *ptr = arena->memory + arena->used;
+	arena->used = zk_arena_round_up(arena->used + size, ZK_ARENA_ALIGNMENT);
+	return ptr;
+}
@@ -0,0 +1,48 @@
+#ifndef ZK_ARENA_H
+#define ZK_ARENA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "zk_common/zk_common.h"
+
+/**
+ * Huge page size the arena is aligned and rounded to. 2 MB is the size of transparent huge pages on x86-64 and of the
+ * default hugetlbfs pages on most Linux configurations.
+ */
+#ifndef ZK_ARENA_HUGE_PAGE_SIZE
+#define ZK_ARENA_HUGE_PAGE_SIZE (2u << 20)
+#endif
+
+typedef struct zk_arena zk_arena;
+
+/**
+ * @brief Pages backing an arena, from the best to the fallback.
+ */
+enum zk_arena_pages {
+	ZK_ARENA_PAGES_HUGETLB, // explicit huge pages reserved with MAP_HUGETLB
+	ZK_ARENA_PAGES_TRANSPARENT, // regular mapping advised with MADV_HUGEPAGE
+	ZK_ARENA_PAGES_DEFAULT // regular mapping, huge pages are not supported by the platform
+};
+typedef enum zk_arena_pages zk_arena_pages;
+
+// Constructor
+zk_status zk_arena_new(zk_arena **arena_p, size_t const bytes);
+
+// Destructor
+void zk_arena_free(zk_arena **arena_p);
+
+// Capacity
+size_t zk_arena_capacity(const zk_arena *const arena);
+
+size_t zk_arena_size(const zk_arena *const arena);
+
+zk_arena_pages zk_arena_get_pages(const zk_arena *const arena);
+
+// Lookup
+bool zk_arena_contains(const zk_arena *const arena, const void *const ptr);
+
+// Modifiers
+void *zk_arena_alloc(zk_arena *const arena, size_t const size);
+
+#endif
@@ -0,0 +1,214 @@
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "zk_bloom/zk_bloom.h"
+
+#define ZK_BLOOM_MIN_BITS   64
+#define ZK_BLOOM_MAX_HASHES 32
+
+/**
+ * @brief Bloom filter struct. The number of bits is always a power of two so probes can be masked instead of divided.
+ */
+struct zk_bloom {
+	uint64_t *words;
+	size_t bits;
+	size_t hashes;
+	size_t capacity;
+	size_t count;
+	double fp_rate;
+	zk_hash_func hash;
+};
+
+// Private functions
+static size_t zk_bloom_round_up_pow2(size_t n)
+{
+	size_t p = ZK_BLOOM_MIN_BITS;
+	while (p < n && p <= SIZE_MAX / 2)
+		p *= 2;
+	return p;
+}
+
+static size_t zk_bloom_round_down_pow2(size_t n)
+{
+	size_t p = ZK_BLOOM_MIN_BITS;
+	while (p <= n / 2)
+		p *= 2;
+	return p;
+}
+
+static size_t zk_bloom_optimal_hashes(size_t const bits, size_t const capacity)
+{
+	double k = round((double)bits / (double)capacity * M_LN2);
+	if (k < 1)
+		return 1;
+	if (k > ZK_BLOOM_MAX_HASHES)
+		return ZK_BLOOM_MAX_HASHES;
+	return (size_t)k;
+}
+
+// splitmix64 finalizer, derives an independent second hash from the user hash
+static uint64_t zk_bloom_mix(uint64_t h)
+{
+	h ^= h >> 30;
+	h *= UINT64_C(0xbf58476d1ce4e5b9);
+	h ^= h >> 27;
+	h *= UINT64_C(0x94d049bb133111eb);
+	h ^= h >> 31;
+	return h;
+}
+
+static zk_status zk_bloom_alloc(zk_bloom **bloom_p, size_t const bits, size_t const capacity, zk_hash_func const func)
+{
+	zk_bloom *bloom = malloc(sizeof(zk_bloom));
+	if (bloom == NULL)
+		return ZK_ERROR_ALLOC;
+
+	bloom->words = calloc(bits / 64, sizeof(uint64_t));
+	if (bloom->words == NULL) {
+		free(bloom);
+		return ZK_ERROR_ALLOC;
+	}
+
+	bloom->bits = bits;
+	bloom->hashes = zk_bloom_optimal_hashes(bits, capacity);
+	bloom->capacity = capacity;
+	bloom->count = 0;
+	bloom->fp_rate = pow(1.0 - exp(-(double)bloom->hashes * (double)capacity / (double)bits), (double)bloom->hashes);
+	bloom->hash = func;
+
+	*bloom_p = bloom;
+	return ZK_OK;
+}
+
+// Constructor
+
+/**
+ * @brief Creates a Bloom filter sized to hold `capacity` elements with a false positive rate of at most `fp_rate`.
+ *
+ * @param bloom_p Pointer to the filter to create.
+ * @param capacity Number of elements the filter is expected to hold. Must be greater than 0.
+ * @param fp_rate Target false positive rate, in the open interval (0, 1).
+ * @param func Hash function applied to the data added and looked up. Data that compares equal must hash equal.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if arguments are invalid or ZK_ERROR_ALLOC on allocation failure.
+ *
+ * @note Space complexity: O(capacity * log(1 / fp_rate)), the bit count is rounded up to a power of two.
+ */
+zk_status zk_bloom_new(zk_bloom **bloom_p, size_t const capacity, double const fp_rate, zk_hash_func const func)
+{
+	if (bloom_p == NULL || func == NULL || capacity == 0 || !(fp_rate > 0.0 && fp_rate < 1.0))
+		return ZK_INVALID_ARGUMENT;
+
+	double const bits = ceil(-(double)capacity * log(fp_rate) / (M_LN2 * M_LN2));
+	if (bits >= (double)(SIZE_MAX / 2))
+		return ZK_ERROR_ALLOC;
+
+	return zk_bloom_alloc(bloom_p, zk_bloom_round_up_pow2((size_t)bits), capacity, func);
+}
+
+/**
+ * @brief Creates a Bloom filter that uses at most `bytes` bytes for its bit array and is tuned for `capacity`
+ *        elements. The resulting false positive rate is reported by zk_bloom_get_stats().
+ *
+ * @param bloom_p Pointer to the filter to create.
+ * @param bytes Memory budget for the bit array. Must be at least 8, it is rounded down to a power of two.
+ * @param capacity Number of elements the filter is expected to hold. Must be greater than 0.
+ * @param func Hash function applied to the data added and looked up. Data that compares equal must hash equal.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if arguments are invalid or ZK_ERROR_ALLOC on allocation failure.
+ */
+zk_status zk_bloom_new_with_size(zk_bloom **bloom_p, size_t const bytes, size_t const capacity, zk_hash_func const func)
+{
+	if (bloom_p == NULL || func == NULL || capacity == 0 || bytes < ZK_BLOOM_MIN_BITS / 8 || bytes > SIZE_MAX / 8)
+		return ZK_INVALID_ARGUMENT;
+
+	return zk_bloom_alloc(bloom_p, zk_bloom_round_down_pow2(bytes * 8), capacity, func);
+}
+
+// Destructor
+void zk_bloom_free(zk_bloom **bloom_p)
+{
+	if (bloom_p != NULL && *bloom_p != NULL) {
+		free((*bloom_p)->words);
+		free(*bloom_p);
+		*bloom_p = NULL;
+	}
+}
+
+// Lookup
+
+/**
+ * @brief Tests whether `data` may have been added to the filter.
+ *
+ * @return false if `data` was definitely never added, true if it possibly was. A NULL filter always returns true so
+ *         callers can treat the filter as optional.
+ *
+ * @note Time complexity: O(k), where k is the number of hashes.
+ */
+bool zk_bloom_contains(const zk_bloom *const bloom, const void *const data)
+{
+	if (bloom == NULL)
+		return true;
+
+	uint64_t h1 = bloom->hash(data);
+	uint64_t const h2 = zk_bloom_mix(h1) | 1;
+	size_t const mask = bloom->bits - 1;
+	for (size_t i = 0; i < bloom->hashes; i++, h1 += h2) {
+		size_t const bit = h1 & mask;
+		if (!(bloom->words[bit / 64] & (UINT64_C(1) << (bit % 64))))
+			return false;
+	}
+	return true;
+}
+
+zk_status zk_bloom_get_stats(const zk_bloom *const bloom, zk_bloom_stats *const stats)
+{
+	if (bloom == NULL || stats == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	size_t set = 0;
+	for (size_t i = 0; i < bloom->bits / 64; i++)
+		set += (size_t)__builtin_popcountll(bloom->words[i]);
+
+	stats->capacity = bloom->capacity;
+	stats->count = bloom->count;
+	stats->bits = bloom->bits;
+	stats->bytes = bloom->bits / 8;
+	stats->hashes = bloom->hashes;
+	stats->fp_rate = bloom->fp_rate;
+	stats->estimated_fp_rate = pow((double)set / (double)bloom->bits, (double)bloom->hashes);
+
+	return ZK_OK;
+}
+
+// Modifiers
+zk_status zk_bloom_add(zk_bloom *const bloom, const void *const data)
+{
+	if (bloom == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	uint64_t h1 = bloom->hash(data);
+	uint64_t const h2 = zk_bloom_mix(h1) | 1;
+	size_t const mask = bloom->bits - 1;
+	for (size_t i = 0; i < bloom->hashes; i++, h1 += h2) {
+		size_t const bit = h1 & mask;
+		bloom->words[bit / 64] |= UINT64_C(1) << (bit % 64);
+	}
+	bloom->count++;
+
+	return ZK_OK;
+}
+
+/**
+ * @brief Removes all elements from the filter. Bloom filters cannot remove single elements, so after removing data
+ *        from the underlying container the filter is cleared and rebuilt from the remaining elements.
+ */
+void zk_bloom_clear(zk_bloom *const bloom)
+{
+	if (bloom != NULL) {
+		for (size_t i = 0; i < bloom->bits / 64; i++)
+			bloom->words[i] = 0;
+		bloom->count = 0;
+	}
+}
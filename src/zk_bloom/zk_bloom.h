@@ -0,0 +1,42 @@
+#ifndef ZK_BLOOM_H
+#define ZK_BLOOM_H
+
+#include <stddef.h>
+
+#include "zk_common/zk_common.h"
+
+typedef struct zk_bloom zk_bloom;
+
+/**
+ * @brief Bloom filter statistics.
+ */
+struct zk_bloom_stats {
+	size_t capacity; // number of elements the filter was sized for
+	size_t count; // number of elements added since the last clear
+	size_t bits; // number of bits in the filter
+	size_t bytes; // memory used by the bit array
+	size_t hashes; // number of bits set per element
+	double fp_rate; // false positive rate the filter was sized for
+	double estimated_fp_rate; // false positive rate estimated from the bits currently set
+};
+typedef struct zk_bloom_stats zk_bloom_stats;
+
+// Constructor
+zk_status zk_bloom_new(zk_bloom **bloom_p, size_t const capacity, double const fp_rate, zk_hash_func const func);
+
+zk_status zk_bloom_new_with_size(zk_bloom **bloom_p, size_t const bytes, size_t const capacity, zk_hash_func const func);
+
+// Destructor
+void zk_bloom_free(zk_bloom **bloom_p);
+
+// Lookup
+bool zk_bloom_contains(const zk_bloom *const bloom, const void *const data);
+
+zk_status zk_bloom_get_stats(const zk_bloom *const bloom, zk_bloom_stats *const stats);
+
+// Modifiers
+zk_status zk_bloom_add(zk_bloom *const bloom, const void *const data);
+
+void zk_bloom_clear(zk_bloom *const bloom);
+
+#endif
@@ -0,0 +1,145 @@
+#ifndef ZK_BUDGET_H
+#define ZK_BUDGET_H
+
+#include <stdint.h>
+#include <time.h>
+
+#include "zk_common/zk_common.h"
+#include "zk_iter/zk_iter.h"
+
+/*
+ * Incremental traversals for callers that cannot block for O(n), such as event loops. Every call processes the nodes
+ * allowed by a zk_budget and leaves a cursor where the next call resumes. The cursor of for_each and find is a zk_iter
+ * started with zk_iter_begin(); free uses the list itself, which stays a valid, shorter list between calls.
+ *
+ * The clock is read every ZK_BUDGET_CLOCK_INTERVAL nodes, so a time budget may be overrun by that many nodes.
+ */
+
+/**
+ * Number of nodes processed between two reads of the clock when the budget has a time limit.
+ */
+#ifndef ZK_BUDGET_CLOCK_INTERVAL
+#define ZK_BUDGET_CLOCK_INTERVAL 16
+#endif
+
+/**
+ * @brief Limit of one incremental call: at most `nodes` nodes and at most about `ns` nanoseconds. A limit of 0 is no
+ *        limit. At least one node is processed per call so that every call makes progress.
+ */
+struct zk_budget {
+	size_t nodes;
+	uint64_t ns;
+};
+typedef struct zk_budget zk_budget;
+
+/**
+ * @brief Budget left to a running call, see zk_budget_start() and zk_budget_spend().
+ */
+struct zk_budget_meter {
+	size_t nodes;
+	size_t until_clock;
+	uint64_t deadline;
+};
+typedef struct zk_budget_meter zk_budget_meter;
+
+// Budget
+
+static inline uint64_t zk_budget_now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * UINT64_C(1000000000) + (uint64_t)ts.tv_nsec;
+}
+
+static inline zk_budget_meter zk_budget_start(zk_budget const budget)
+{
+	return (zk_budget_meter){
+		.nodes = budget.nodes > 0 ? budget.nodes : SIZE_MAX,
+		.until_clock = budget.ns > 0 ? ZK_BUDGET_CLOCK_INTERVAL : SIZE_MAX,
+		.deadline = budget.ns > 0 ? zk_budget_now_ns() + budget.ns : 0,
+	};
+}
+
+/**
+ * @brief Accounts for one processed node.
+ *
+ * @return true if the call may process another node, false once the budget is exhausted.
+ */
+static inline bool zk_budget_spend(zk_budget_meter *const meter)
+{
+	if (--meter->nodes == 0)
+		return false;
+	if (--meter->until_clock == 0) {
+		if (zk_budget_now_ns() >= meter->deadline)
+			return false;
+		meter->until_clock = ZK_BUDGET_CLOCK_INTERVAL;
+	}
+	return true;
+}
+
+// Iterators
+
+/**
+ * @brief Calls `func` on the elements from `cursor` on, until the budget is exhausted, and moves `cursor` to the first
+ *        element not visited.
+ *
+ * @return true once the traversal is complete, `cursor` is then invalid. false if it must be resumed with `cursor`.
+ *
+ * @code
+ * zk_iter cursor = zk_iter_begin(list);
+ * while (!zk_iter_for_each_budget(&cursor, func, user_data, (zk_budget){ .ns = 100000 }))
+ *         handle_events();
+ * @endcode
+ */
+static inline bool zk_iter_for_each_budget(zk_iter *const cursor,
+                                           zk_for_each_func const func,
+                                           void *const user_data,
+                                           zk_budget const budget)
+{
+	if (cursor == NULL || func == NULL)
+		return true;
+
+	zk_budget_meter meter = zk_budget_start(budget);
+	zk_iter it = *cursor;
+	while (zk_iter_valid(it)) {
+		func(zk_iter_data(it), user_data);
+		it = zk_iter_next(it);
+		if (!zk_budget_spend(&meter))
+			break;
+	}
+	*cursor = it;
+	return !zk_iter_valid(it);
+}
+
+// Lookup
+
+/**
+ * @brief Searches the elements from `cursor` on for one equal to `data`, until the budget is exhausted.
+ *
+ * @return true once the search is over: `cursor` is on the match if there is one, invalid otherwise. To look for the
+ *         next match, resume from zk_iter_next() of the cursor. false if the search must be resumed with `cursor`.
+ */
+static inline bool zk_iter_find_budget(zk_iter *const cursor,
+                                       const void *const data,
+                                       zk_compare_func const func,
+                                       zk_budget const budget)
+{
+	if (cursor == NULL || func == NULL)
+		return true;
+
+	zk_budget_meter meter = zk_budget_start(budget);
+	zk_iter it = *cursor;
+	while (zk_iter_valid(it)) {
+		if (func(zk_iter_data(it), data) == 0)
+			break;
+		it = zk_iter_next(it);
+		if (!zk_budget_spend(&meter)) {
+			*cursor = it;
+			return !zk_iter_valid(it);
+		}
+	}
+	*cursor = it;
+	return true;
+}
+
+#endif
@@ -1,15 +1,8 @@
 #include <stdlib.h>
 
 #include "zk_c_dlist/zk_c_dlist.h"
-
-/**
- * @brief A circular doubly linked list node.
- */
-struct zk_c_dlist {
-	void *data;
-	struct zk_c_dlist *prev;
-	struct zk_c_dlist *next;
-};
+#include "zk_node_cache/zk_node_cache.h"
+#include "zk_reclaim/zk_reclaim.h"
 
 // Private functions
 static void _zk_c_dlist_free(zk_c_dlist **node, zk_destructor_t const func)
@@ -22,17 +15,58 @@ static void _zk_c_dlist_free(zk_c_dlist **node, zk_destructor_t const func)
 		func((*node)->data);
 	}
 
-	free(*node);
+	zk_node_cache_free(*node, sizeof(zk_c_dlist));
 	*node = NULL;
 }
 
+// `end` is the last element of the circular list, so lookahead stops there instead of wrapping around.
+static zk_c_dlist *zk_c_dlist_prefetch_begin(zk_c_dlist *node, const zk_c_dlist *const end)
+{
+	for (size_t i = ZK_PREFETCH_DISTANCE; i > 0 && node != end; i--) {
+		node = node->next;
+	}
+
+	return ZK_PREFETCH_DISTANCE ? node : (zk_c_dlist *)end;
+}
+
+static zk_c_dlist *zk_c_dlist_prefetch_next(zk_c_dlist *ahead, const zk_c_dlist *const end)
+{
+	if (ZK_PREFETCH_DISTANCE > 0 && ahead != end) {
+		ZK_PREFETCH(ahead->data);
+		ahead = ahead->next;
+		ZK_PREFETCH(ahead);
+	}
+
+	return ahead;
+}
+
+static zk_status zk_c_dlist_nodes_append(zk_c_dlist ***nodes_p,
+                                         size_t *const capacity_p,
+                                         size_t const count,
+                                         zk_c_dlist *node)
+{
+	if (count >= *capacity_p || *nodes_p == NULL) {
+		size_t const capacity = count != 0 ? count * 2 : 8;
+		zk_c_dlist **nodes = realloc(*nodes_p, capacity * sizeof(zk_c_dlist *));
+		if (nodes == NULL) {
+			return ZK_ERROR_ALLOC;
+		}
+
+		*nodes_p = nodes;
+		*capacity_p = capacity;
+	}
+
+	(*nodes_p)[count] = node;
+	return ZK_OK;
+}
+
 // Constructor
 zk_status zk_c_dlist_new_node(zk_c_dlist **node_p, void *const data)
 {
 	if (node_p == NULL)
 		return ZK_INVALID_ARGUMENT;
 
-	*node_p = malloc(sizeof(zk_c_dlist));
+	*node_p = zk_node_cache_alloc(sizeof(zk_c_dlist));
 	if (*node_p == NULL)
 		return ZK_ERROR_ALLOC;
 
@@ -43,13 +77,24 @@ zk_status zk_c_dlist_new_node(zk_c_dlist **node_p, void *const data)
 	return ZK_OK;
 }
 
+/**
+ * @brief Reserves `count` nodes for the calling thread, its next pushes then neither call malloc() nor fail with
+ *        ZK_ERROR_ALLOC until the reserve is used up. See zk_slist_reserve().
+ */
+zk_status zk_c_dlist_reserve(size_t const count)
+{
+	return zk_node_cache_reserve(sizeof(zk_c_dlist), count);
+}
+
 // Destructor
 void zk_c_dlist_free(zk_c_dlist **list_p, zk_destructor_t const func)
 {
 	if (list_p != NULL && *list_p != NULL) {
 		zk_c_dlist *current = zk_c_dlist_begin(*list_p);
 		zk_c_dlist *end = zk_c_dlist_end(*list_p);
+		zk_c_dlist *ahead = zk_c_dlist_prefetch_begin(current, end);
 		while (current != end) {
+			ahead = zk_c_dlist_prefetch_next(ahead, end);
 			zk_c_dlist *node = current;
 			current = current->next;
 			_zk_c_dlist_free(&node, func);
@@ -60,6 +105,39 @@ void zk_c_dlist_free(zk_c_dlist **list_p, zk_destructor_t const func)
 	}
 }
 
+static void zk_c_dlist_reclaim(void *list, zk_destructor_t func)
+{
+	zk_c_dlist *detached = list;
+	zk_c_dlist_free(&detached, func);
+}
+
+zk_status zk_c_dlist_free_async(zk_c_dlist **list_p, zk_destructor_t const func)
+{
+	if (list_p == NULL)
+		return ZK_INVALID_ARGUMENT;
+	if (*list_p == NULL)
+		return ZK_OK;
+
+	zk_status const status = zk_reclaim_submit(*list_p, zk_c_dlist_reclaim, func);
+	if (status == ZK_OK)
+		*list_p = NULL;
+	return status;
+}
+
+bool zk_c_dlist_free_budget(zk_c_dlist **list_p, zk_destructor_t const func, zk_budget const budget)
+{
+	if (list_p == NULL)
+		return true;
+
+	zk_budget_meter meter = zk_budget_start(budget);
+	while (*list_p != NULL) {
+		zk_c_dlist_pop_front(list_p, func);
+		if (!zk_budget_spend(&meter))
+			break;
+	}
+	return *list_p == NULL;
+}
+
 // Element access
 zk_status zk_c_dlist_get_data(const zk_c_dlist *const list, void **data)
 {
@@ -105,7 +183,9 @@ zk_c_dlist *zk_c_dlist_end(zk_c_dlist *list)
 void zk_c_dlist_for_each(zk_c_dlist *begin, zk_c_dlist *const end, zk_for_each_func const func, void *const user_data)
 {
 	if (func != NULL && begin != NULL) {
+		zk_c_dlist *ahead = zk_c_dlist_prefetch_begin(begin, end);
 		for (; begin != end; begin = begin->next) {
+			ahead = zk_c_dlist_prefetch_next(ahead, end);
 			func(begin->data, user_data);
 		}
 		// calls func on last element
@@ -113,6 +193,112 @@ void zk_c_dlist_for_each(zk_c_dlist *begin, zk_c_dlist *const end, zk_for_each_f
 	}
 }
 
+void zk_c_dlist_for_each_batch(zk_c_dlist *begin,
+                               zk_c_dlist *const end,
+                               zk_for_each_batch_func const func,
+                               void *const user_data)
+{
+	if (func != NULL && begin != NULL) {
+		void *batch[ZK_BATCH_SIZE];
+		size_t count = 0;
+		zk_c_dlist *ahead = zk_c_dlist_prefetch_begin(begin, end);
+		for (; begin != end; begin = begin->next) {
+			ahead = zk_c_dlist_prefetch_next(ahead, end);
+			batch[count++] = begin->data;
+			if (count == ZK_BATCH_SIZE) {
+				func(batch, count, user_data);
+				count = 0;
+			}
+		}
+		// last element always fits: the buffer was flushed when it became full
+		batch[count++] = end->data;
+		func(batch, count, user_data);
+	}
+}
+
+zk_c_dlist *zk_c_dlist_for_each_until(zk_c_dlist *begin,
+                                      zk_c_dlist *const end,
+                                      zk_for_each_until_func const func,
+                                      void *const user_data)
+{
+	if (func != NULL && begin != NULL) {
+		zk_c_dlist *ahead = zk_c_dlist_prefetch_begin(begin, end);
+		for (; begin != end; begin = begin->next) {
+			ahead = zk_c_dlist_prefetch_next(ahead, end);
+			if (func(begin->data, user_data) == ZK_STOP)
+				return begin;
+		}
+		// calls func on last element
+		if (func(end->data, user_data) == ZK_STOP)
+			return end;
+	}
+	return NULL;
+}
+
+// Lookup
+zk_c_dlist *zk_c_dlist_find_if(zk_c_dlist *list, zk_predicate_func const func, void *const user_data)
+{
+	if (func != NULL && list != NULL) {
+		zk_c_dlist *node = zk_c_dlist_begin(list);
+		zk_c_dlist *const end = zk_c_dlist_end(list);
+		for (;;) {
+			if (func(node->data, user_data)) {
+				return node;
+			}
+			if (node == end) {
+				break;
+			}
+			node = node->next;
+		}
+	}
+	return NULL;
+}
+
+size_t zk_c_dlist_count_if(const zk_c_dlist *const list, zk_predicate_func const func, void *const user_data)
+{
+	size_t count = 0;
+	if (func != NULL && list != NULL) {
+		const zk_c_dlist *node = zk_c_dlist_begin((zk_c_dlist *)list);
+		const zk_c_dlist *const end = zk_c_dlist_end((zk_c_dlist *)list);
+		for (; node != end; node = node->next) {
+			count += func(node->data, user_data);
+		}
+		// counts last element
+		count += func(end->data, user_data);
+	}
+	return count;
+}
+
+zk_status zk_c_dlist_find_all(zk_c_dlist *list,
+                              zk_predicate_func const func,
+                              void *const user_data,
+                              zk_c_dlist ***nodes_p,
+                              size_t *const capacity_p,
+                              size_t *const count_p)
+{
+	if (func == NULL || nodes_p == NULL || capacity_p == NULL || count_p == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	*count_p = 0;
+	if (list != NULL) {
+		zk_c_dlist *node = zk_c_dlist_begin(list);
+		zk_c_dlist *const end = zk_c_dlist_end(list);
+		for (;;) {
+			if (func(node->data, user_data)) {
+				if (zk_c_dlist_nodes_append(nodes_p, capacity_p, *count_p, node) != ZK_OK)
+					return ZK_ERROR_ALLOC;
+				(*count_p)++;
+			}
+			if (node == end) {
+				break;
+			}
+			node = node->next;
+		}
+	}
+
+	return ZK_OK;
+}
+
 // Modifiers
 
 zk_status zk_c_dlist_pop_back(zk_c_dlist **list_p, zk_destructor_t const func)
@@ -1,16 +1,34 @@
 #ifndef ZK_C_SLIST_H
 #define ZK_C_SLIST_H
 
+#include "zk_budget/zk_budget.h"
 #include "zk_common/zk_common.h"
+#include "zk_iter/zk_iter.h"
 
+/**
+ * @brief Circular singly linked list struct
+ * Internally this list is managed in a way that it always points to the last node for efficient operations.
+ */
+struct zk_c_slist {
+	void *data;
+	struct zk_c_slist *next;
+};
 typedef struct zk_c_slist zk_c_slist;
 
+ZK_ITER_ASSERT_NODE_LAYOUT(zk_c_slist);
+
 // Constructor
 zk_status zk_c_slist_new_node(zk_c_slist **node_p, void *const data);
 
+zk_status zk_c_slist_reserve(size_t const count);
+
 // Destructor
 void zk_c_slist_free(zk_c_slist **list_p, zk_destructor_t const func);
 
+zk_status zk_c_slist_free_async(zk_c_slist **list_p, zk_destructor_t const func);
+
+bool zk_c_slist_free_budget(zk_c_slist **list_p, zk_destructor_t const func, zk_budget const budget);
+
 // Element access
 zk_status zk_c_slist_get_data(const zk_c_slist *const list, void **data);
 
@@ -23,6 +41,28 @@ zk_c_slist *zk_c_slist_end(zk_c_slist *list);
 
 void zk_c_slist_for_each(zk_c_slist *begin, zk_c_slist *const end, zk_for_each_func const func, void *const user_data);
 
+void zk_c_slist_for_each_batch(zk_c_slist *begin,
+                               zk_c_slist *const end,
+                               zk_for_each_batch_func const func,
+                               void *const user_data);
+
+zk_c_slist *zk_c_slist_for_each_until(zk_c_slist *begin,
+                                      zk_c_slist *const end,
+                                      zk_for_each_until_func const func,
+                                      void *const user_data);
+
+// Lookup
+zk_c_slist *zk_c_slist_find_if(zk_c_slist *list, zk_predicate_func const func, void *const user_data);
+
+size_t zk_c_slist_count_if(const zk_c_slist *const list, zk_predicate_func const func, void *const user_data);
+
+zk_status zk_c_slist_find_all(zk_c_slist *list,
+                              zk_predicate_func const func,
+                              void *const user_data,
+                              zk_c_slist ***nodes_p,
+                              size_t *const capacity_p,
+                              size_t *const count_p);
+
 // Modifiers
 
 zk_status zk_c_slist_pop_back(zk_c_slist **list_p, zk_destructor_t const func);
@@ -33,4 +73,47 @@ zk_status zk_c_slist_push_back(zk_c_slist **list_p, void *const data);
 
 zk_status zk_c_slist_push_front(zk_c_slist **list_p, void *const data);
 
+// Inline iteration
+
+/**
+ * @brief Iterates over every node of the list as a plain pointer loop, without calling through function pointers.
+ *
+ * @param NODE A `zk_c_slist *` variable that points to each node in turn.
+ * @param LIST The list to iterate.
+ */
+#define ZK_C_SLIST_FOREACH(NODE, LIST)                 \
+	for ((NODE) = _zk_c_slist_foreach_first(LIST); \
+	     (NODE) != NULL;                           \
+	     (NODE) = _zk_c_slist_foreach_next(LIST, NODE))
+
+/**
+ * @brief Same as ZK_C_SLIST_FOREACH() but the loop body may unlink and free NODE.
+ *
+ * @param NODE A `zk_c_slist *` variable that points to each node in turn.
+ * @param TMP A `zk_c_slist *` variable used to hold the next node.
+ * @param LIST The list to iterate.
+ */
+#define ZK_C_SLIST_FOREACH_SAFE(NODE, TMP, LIST)                                  \
+	for ((NODE) = _zk_c_slist_foreach_first(LIST);                            \
+	     (NODE) != NULL && ((TMP) = _zk_c_slist_foreach_next(LIST, NODE), 1); \
+	     (NODE) = (TMP))
+
+static inline zk_c_slist *_zk_c_slist_foreach_first(zk_c_slist *list)
+{
+	return list != NULL ? list->next : NULL;
+}
+
+static inline zk_c_slist *_zk_c_slist_foreach_next(const zk_c_slist *const list, zk_c_slist *node)
+{
+	return node != list ? node->next : NULL;
+}
+
+/**
+ * @brief Returns an iterator on the first element of the list, see zk_iter.
+ */
+static inline zk_iter zk_c_slist_iter(zk_c_slist *list)
+{
+	return zk_iter_new(list != NULL ? list->next : NULL, list);
+}
+
 #endif
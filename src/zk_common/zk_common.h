@@ -2,9 +2,41 @@
 #define ZK_COMMON_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #define ZK_UNUSED(x) (void)(x)
 
+/**
+ * Number of nodes traversal kernels run ahead of the current node to prefetch upcoming nodes and their data. It is set
+ * at build time through the `prefetch_distance` option, 0 disables prefetching. The lookahead reaches its node through
+ * the same chain of `next` loads as the walk, so it cannot hide the misses of a cold, scattered list: it is off by
+ * default and only worth enabling where a benchmark shows a gain, typically when `func` or the data is the slow part.
+ */
+#ifndef ZK_PREFETCH_DISTANCE
+#define ZK_PREFETCH_DISTANCE 0
+#endif
+
+/**
+ * Number of data pointers gathered on the stack before a batched for_each calls its function.
+ */
+#ifndef ZK_BATCH_SIZE
+#define ZK_BATCH_SIZE 64
+#endif
+
+/**
+ * Size of a cache line. Data written by different threads is aligned on it to avoid false sharing.
+ */
+#ifndef ZK_CACHE_LINE
+#define ZK_CACHE_LINE 64
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define ZK_PREFETCH(ADDR) __builtin_prefetch(ADDR)
+#else
+#define ZK_PREFETCH(ADDR) ZK_UNUSED(ADDR)
+#endif
+
 typedef int (*zk_compare_func)(const void *const a, const void *const b);
 
 typedef bool (*zk_predicate_func)(const void *const data, void *user_data);
@@ -15,10 +47,31 @@ typedef void (*zk_destructor_t)(void *data);
 
 typedef void (*zk_for_each_func)(void *data, void *user_data);
 
+typedef void (*zk_for_each_batch_func)(void **data, size_t const count, void *user_data);
+
+typedef enum zk_iteration {
+	ZK_CONTINUE = 0,
+	ZK_STOP = 1,
+} zk_iteration;
+
+typedef zk_iteration (*zk_for_each_until_func)(void *data, void *user_data);
+
+typedef void *(*zk_fold_func)(void *acc, void *data, void *user_data);
+
+typedef int64_t (*zk_fold_int_func)(int64_t acc, const void *const data, void *user_data);
+
+typedef double (*zk_fold_double_func)(double acc, const void *const data, void *user_data);
+
+typedef void *(*zk_map_func)(void *data, void *user_data);
+
+typedef size_t (*zk_hash_func)(const void *const data);
+
 typedef enum zk_status {
 	ZK_OK = 0,
 	ZK_ERROR_ALLOC = 1,
 	ZK_INVALID_ARGUMENT = 2,
+	ZK_ERROR_FULL = 3,
+	ZK_ERROR_EXISTS = 4,
 } zk_status;
 
 #endif
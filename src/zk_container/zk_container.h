@@ -1,28 +1,51 @@
 #ifndef ZK_CONTAINER_H
 #define ZK_CONTAINER_H
 
+#include "zk_budget/zk_budget.h"
 #include "zk_c_dlist/zk_c_dlist.h"
 #include "zk_c_slist/zk_c_slist.h"
 #include "zk_dlist/zk_dlist.h"
+#include "zk_fold/zk_fold.h"
+#include "zk_reclaim/zk_reclaim.h"
 #include "zk_slist/zk_slist.h"
+#include "zk_spsc_queue/zk_spsc_queue.h"
+#include "zk_view/zk_view.h"
 
 // clang-format off
 
 // Destructor
-#define zk_free(CONTAINER, FUNC)                 \
-	_Generic((CONTAINER),                    \
-		zk_slist **   : zk_slist_free,   \
-		zk_dlist **   : zk_dlist_free,   \
-		zk_c_slist ** : zk_c_slist_free, \
-		zk_c_dlist ** : zk_c_dlist_free) \
+#define zk_free(CONTAINER, FUNC)                       \
+	_Generic((CONTAINER),                          \
+		zk_slist **      : zk_slist_free,      \
+		zk_dlist **      : zk_dlist_free,      \
+		zk_c_slist **    : zk_c_slist_free,    \
+		zk_c_dlist **    : zk_c_dlist_free,    \
+		zk_spsc_queue ** : zk_spsc_queue_free) \
+		(CONTAINER, FUNC)
+
+#define zk_free_async(CONTAINER, FUNC)                 \
+	_Generic((CONTAINER),                          \
+		zk_slist **   : zk_slist_free_async,   \
+		zk_dlist **   : zk_dlist_free_async,   \
+		zk_c_slist ** : zk_c_slist_free_async, \
+		zk_c_dlist ** : zk_c_dlist_free_async) \
 		(CONTAINER, FUNC)
 
+#define zk_free_budget(CONTAINER, FUNC, BUDGET)         \
+	_Generic((CONTAINER),                           \
+		zk_slist **   : zk_slist_free_budget,   \
+		zk_dlist **   : zk_dlist_free_budget,   \
+		zk_c_slist ** : zk_c_slist_free_budget, \
+		zk_c_dlist ** : zk_c_dlist_free_budget) \
+		(CONTAINER, FUNC, BUDGET)
+
 // Element access
-#define zk_get_data(CONTAINER, DATA)                \
-	_Generic((CONTAINER),                       \
-		zk_dlist *   : zk_dlist_get_data,   \
-		zk_c_slist * : zk_c_slist_get_data, \
-		zk_c_dlist * : zk_c_dlist_get_data) \
+#define zk_get_data(CONTAINER, DATA)                   \
+	_Generic((CONTAINER),                          \
+		zk_dlist *      : zk_dlist_get_data,   \
+		zk_c_slist *    : zk_c_slist_get_data, \
+		zk_c_dlist *    : zk_c_dlist_get_data, \
+		zk_spsc_queue * : zk_spsc_queue_front) \
 		(CONTAINER, DATA)
 
 // Iterators
@@ -39,6 +62,44 @@
 			USER_DATA                   \
 		)
 
+#define zk_for_each_batch(CONTAINER, FUNC, USER_DATA)     \
+	_Generic((CONTAINER),                             \
+		zk_slist *   : zk_slist_for_each_batch,   \
+		zk_dlist *   : zk_dlist_for_each_batch,   \
+		zk_c_slist * : zk_c_slist_for_each_batch, \
+		zk_c_dlist * : zk_c_dlist_for_each_batch) \
+		(                                         \
+			zk_begin(CONTAINER),              \
+			zk_end(CONTAINER),                \
+			FUNC,                             \
+			USER_DATA                         \
+		)
+
+#define zk_for_each_until(CONTAINER, FUNC, USER_DATA)     \
+	_Generic((CONTAINER),                             \
+		zk_slist *   : zk_slist_for_each_until,   \
+		zk_dlist *   : zk_dlist_for_each_until,   \
+		zk_c_slist * : zk_c_slist_for_each_until, \
+		zk_c_dlist * : zk_c_dlist_for_each_until) \
+		(                                         \
+			zk_begin(CONTAINER),              \
+			zk_end(CONTAINER),                \
+			FUNC,                             \
+			USER_DATA                         \
+		)
+
+#define zk_for_each_parallel(CONTAINER, FUNC, USER_DATA, THREADS) \
+	_Generic((CONTAINER),                                     \
+		zk_slist * : zk_slist_for_each_parallel,          \
+		zk_dlist * : zk_dlist_for_each_parallel)          \
+		(                                                 \
+			zk_begin(CONTAINER),                      \
+			zk_end(CONTAINER),                        \
+			FUNC,                                     \
+			USER_DATA,                                \
+			THREADS                                   \
+		)
+
 #define zk_begin(CONTAINER)                      \
 	_Generic((CONTAINER),                    \
 		zk_slist *   : zk_slist_begin,   \
@@ -68,6 +129,93 @@
 		zk_c_dlist * : zk_c_dlist_prev) \
 		(CONTAINER, NEXT)
 
+// Inline iteration
+
+/**
+ * @brief Returns a zk_iter on the first element of the container. It has the same semantics for every container.
+ */
+#define zk_iter_begin(CONTAINER)                \
+	_Generic((CONTAINER),                   \
+		zk_slist *   : zk_slist_iter,   \
+		zk_dlist *   : zk_dlist_iter,   \
+		zk_c_slist * : zk_c_slist_iter, \
+		zk_c_dlist * : zk_c_dlist_iter) \
+		(CONTAINER)
+
+/**
+ * @brief Returns a zk_view with no stage over the elements of the container.
+ */
+#define zk_view_of(CONTAINER) zk_view_new(zk_iter_begin(CONTAINER))
+
+// Reduction
+
+/**
+ * @brief Folds the elements of the container into an accumulator, see zk_iter_fold().
+ *
+ * @param CONTAINER A pointer to the container.
+ * @param INIT Initial accumulator.
+ * @param FUNC A zk_fold_func returning the next accumulator from the current one and an element.
+ * @param USER_DATA User data passed to FUNC.
+ */
+#define zk_fold(CONTAINER, INIT, FUNC, USER_DATA) zk_iter_fold(zk_iter_begin(CONTAINER), INIT, FUNC, USER_DATA)
+
+#define zk_fold_int(CONTAINER, INIT, FUNC, USER_DATA) \
+	zk_iter_fold_int(zk_iter_begin(CONTAINER), INIT, FUNC, USER_DATA)
+
+#define zk_fold_double(CONTAINER, INIT, FUNC, USER_DATA) \
+	zk_iter_fold_double(zk_iter_begin(CONTAINER), INIT, FUNC, USER_DATA)
+
+#define zk_sum_int(CONTAINER) zk_iter_sum_int(zk_iter_begin(CONTAINER))
+
+#define zk_sum_double(CONTAINER) zk_iter_sum_double(zk_iter_begin(CONTAINER))
+
+/**
+ * @brief Iterate over every node of the container. The loop compiles to a plain pointer walk: no function is called
+ *        through a pointer and no status is returned per step, so the loop body can be inlined and optimized.
+ *
+ * @param NODE A variable of the container node type that points to each node in turn.
+ * @param CONTAINER A pointer to the container.
+ *
+ * @code
+ * zk_dlist *node = NULL;
+ * ZK_FOREACH(node, list) {
+ *	sum += *(int *)node->data;
+ * }
+ * @endcode
+*/
+#define ZK_FOREACH(NODE, CONTAINER)                     \
+	for ((NODE) = _zk_foreach_first(CONTAINER);     \
+	     (NODE) != NULL;                            \
+	     (NODE) = _zk_foreach_next(CONTAINER, NODE))
+
+/**
+ * @brief Same as ZK_FOREACH() but the loop body may unlink and free NODE, e.g. to tear down the container.
+ *
+ * @param NODE A variable of the container node type that points to each node in turn.
+ * @param TMP A variable of the container node type used to hold the next node.
+ * @param CONTAINER A pointer to the container.
+*/
+#define ZK_FOREACH_SAFE(NODE, TMP, CONTAINER)                                     \
+	for ((NODE) = _zk_foreach_first(CONTAINER);                               \
+	     (NODE) != NULL && ((TMP) = _zk_foreach_next(CONTAINER, NODE), 1);    \
+	     (NODE) = (TMP))
+
+#define _zk_foreach_first(CONTAINER)                            \
+	_Generic((CONTAINER),                                   \
+		zk_slist *   : _zk_slist_foreach_first,         \
+		zk_dlist *   : _zk_dlist_foreach_first,         \
+		zk_c_slist * : _zk_c_slist_foreach_first,       \
+		zk_c_dlist * : _zk_c_dlist_foreach_first)       \
+		(CONTAINER)
+
+#define _zk_foreach_next(CONTAINER, NODE)                       \
+	_Generic((CONTAINER),                                   \
+		zk_slist *   : _zk_slist_foreach_next,          \
+		zk_dlist *   : _zk_dlist_foreach_next,          \
+		zk_c_slist * : _zk_c_slist_foreach_next,        \
+		zk_c_dlist * : _zk_c_dlist_foreach_next)        \
+		(CONTAINER, NODE)
+
 // Modifiers
 #define zk_pop_back(CONTAINER, FUNC)                 \
 	_Generic((CONTAINER),                        \
@@ -77,20 +225,22 @@
 		zk_c_dlist ** : zk_c_dlist_pop_back) \
 		(CONTAINER, FUNC)
 
-#define zk_pop_front(CONTAINER, FUNC)                 \
-	_Generic((CONTAINER),                         \
-		zk_slist *   : zk_slist_pop_front,    \
-		zk_dlist **   : zk_dlist_pop_front,   \
-		zk_c_slist ** : zk_c_slist_pop_front, \
-		zk_c_dlist ** : zk_c_dlist_pop_front) \
+#define zk_pop_front(CONTAINER, FUNC)                      \
+	_Generic((CONTAINER),                              \
+		zk_slist *      : zk_slist_pop_front,      \
+		zk_dlist **     : zk_dlist_pop_front,      \
+		zk_c_slist **   : zk_c_slist_pop_front,    \
+		zk_c_dlist **   : zk_c_dlist_pop_front,    \
+		zk_spsc_queue * : zk_spsc_queue_pop_front) \
 		(CONTAINER, FUNC)
 
-#define zk_push_back(CONTAINER, DATA)                 \
-	_Generic((CONTAINER),                         \
-		zk_slist *   : zk_slist_push_back,    \
-		zk_dlist **   : zk_dlist_push_back,   \
-		zk_c_slist ** : zk_c_slist_push_back, \
-		zk_c_dlist ** : zk_c_dlist_push_back) \
+#define zk_push_back(CONTAINER, DATA)                      \
+	_Generic((CONTAINER),                              \
+		zk_slist *      : zk_slist_push_back,      \
+		zk_dlist **     : zk_dlist_push_back,      \
+		zk_c_slist **   : zk_c_slist_push_back,    \
+		zk_c_dlist **   : zk_c_dlist_push_back,    \
+		zk_spsc_queue * : zk_spsc_queue_push_back) \
 		(CONTAINER, DATA)
 
 #define zk_push_front(CONTAINER, DATA)                   \
@@ -172,4 +322,65 @@
 		zk_slist *   : zk_slist_find) \
 		(CONTAINER, DATA, FUNC)
 
+/**
+ * @brief Find the first element in the container for which the predicate returns true. The traversal stops at the
+ *        first match.
+ *
+ * @param CONTAINER A pointer to the container.
+ * @param FUNC A pointer to the predicate function.
+ *             Signature: bool (*func)(const void *const data, void *user_data);
+ * @param USER_DATA A pointer to user data passed to the predicate. Can be NULL.
+ *
+ * @return A pointer to the first matching element or NULL if no match is found.
+*/
+#define zk_find_if(CONTAINER, FUNC, USER_DATA)       \
+	_Generic((CONTAINER),                        \
+		zk_slist *   : zk_slist_find_if,     \
+		zk_dlist *   : zk_dlist_find_if,     \
+		zk_c_slist * : zk_c_slist_find_if,   \
+		zk_c_dlist * : zk_c_dlist_find_if)   \
+		(CONTAINER, FUNC, USER_DATA)
+
+/**
+ * @brief Count the elements in the container for which the predicate returns true.
+ *
+ * @param CONTAINER A pointer to the container.
+ * @param FUNC A pointer to the predicate function.
+ *             Signature: bool (*func)(const void *const data, void *user_data);
+ * @param USER_DATA A pointer to user data passed to the predicate. Can be NULL.
+ *
+ * @return The number of matching elements.
+*/
+#define zk_count_if(CONTAINER, FUNC, USER_DATA)      \
+	_Generic((CONTAINER),                        \
+		zk_slist *   : zk_slist_count_if,    \
+		zk_dlist *   : zk_dlist_count_if,    \
+		zk_c_slist * : zk_c_slist_count_if,  \
+		zk_c_dlist * : zk_c_dlist_count_if)  \
+		(CONTAINER, FUNC, USER_DATA)
+
+/**
+ * @brief Collect every element of the container for which the predicate returns true, in container order, in a single
+ *        pass.
+ *
+ * @param CONTAINER A pointer to the container.
+ * @param FUNC A pointer to the predicate function.
+ *             Signature: bool (*func)(const void *const data, void *user_data);
+ * @param USER_DATA A pointer to user data passed to the predicate. Can be NULL.
+ * @param NODES A pointer to an array of element pointers. The array is either NULL or allocated with malloc(), it is
+ *              grown with realloc() when full and must be freed by the caller.
+ * @param CAPACITY A pointer to the capacity of the array, updated when the array grows.
+ * @param COUNT A pointer receiving the number of matching elements.
+ *
+ * @return ZK_OK if the operation was successful, ZK_INVALID_ARGUMENT if arguments are invalid, ZK_ERROR_ALLOC if the
+ *         array could not be grown.
+*/
+#define zk_find_all(CONTAINER, FUNC, USER_DATA, NODES, CAPACITY, COUNT) \
+	_Generic((CONTAINER),                                           \
+		zk_slist *   : zk_slist_find_all,                       \
+		zk_dlist *   : zk_dlist_find_all,                       \
+		zk_c_slist * : zk_c_slist_find_all,                     \
+		zk_c_dlist * : zk_c_dlist_find_all)                     \
+		(CONTAINER, FUNC, USER_DATA, NODES, CAPACITY, COUNT)
+
 #endif /* ZK_CONTAINER_H */
@@ -1,15 +1,9 @@
 #include <stdlib.h>
 
 #include "zk_dlist/zk_dlist.h"
-
-/**
- * @brief: Doubly linked list struct
- */
-struct zk_dlist {
-	void *data;
-	struct zk_dlist *prev;
-	struct zk_dlist *next;
-};
+#include "zk_node_cache/zk_node_cache.h"
+#include "zk_parallel/zk_parallel.h"
+#include "zk_reclaim/zk_reclaim.h"
 
 // SECTION: Private functions
 static zk_dlist *zk_dlist_back(zk_dlist *list)
@@ -33,10 +27,52 @@ static void _zk_dlist_free(zk_dlist **node, zk_destructor_t func)
 		func((*node)->data);
 	}
 
-	free(*node);
+	zk_node_cache_free(*node, sizeof(zk_dlist));
 	*node = NULL;
 }
 
+static zk_dlist *zk_dlist_prefetch_begin(zk_dlist *node, const zk_dlist *const end)
+{
+	for (size_t i = ZK_PREFETCH_DISTANCE; i > 0 && node != end; i--) {
+		node = node->next;
+	}
+
+	return ZK_PREFETCH_DISTANCE ? node : (zk_dlist *)end;
+}
+
+static zk_dlist *zk_dlist_prefetch_next(zk_dlist *ahead, const zk_dlist *const end)
+{
+	if (ZK_PREFETCH_DISTANCE > 0 && ahead != end) {
+		ZK_PREFETCH(ahead->data);
+		ahead = ahead->next;
+		if (ahead != end) {
+			ZK_PREFETCH(ahead);
+		}
+	}
+
+	return ahead;
+}
+
+static zk_status zk_dlist_nodes_append(zk_dlist ***nodes_p,
+                                       size_t *const capacity_p,
+                                       size_t const count,
+                                       zk_dlist *node)
+{
+	if (count >= *capacity_p || *nodes_p == NULL) {
+		size_t const capacity = count != 0 ? count * 2 : 8;
+		zk_dlist **nodes = realloc(*nodes_p, capacity * sizeof(zk_dlist *));
+		if (nodes == NULL) {
+			return ZK_ERROR_ALLOC;
+		}
+
+		*nodes_p = nodes;
+		*capacity_p = capacity;
+	}
+
+	(*nodes_p)[count] = node;
+	return ZK_OK;
+}
+
 // SECTION END: Private functions
 
 // Constructor
@@ -45,7 +81,7 @@ zk_status zk_dlist_new_node(zk_dlist **node_p, void *const data)
 	if (node_p == NULL)
 		return ZK_INVALID_ARGUMENT;
 
-	*node_p = malloc(sizeof(zk_dlist));
+	*node_p = zk_node_cache_alloc(sizeof(zk_dlist));
 	if (*node_p == NULL)
 		return ZK_ERROR_ALLOC;
 
@@ -56,11 +92,22 @@ zk_status zk_dlist_new_node(zk_dlist **node_p, void *const data)
 	return ZK_OK;
 }
 
+/**
+ * @brief Reserves `count` nodes for the calling thread, its next pushes then neither call malloc() nor fail with
+ *        ZK_ERROR_ALLOC until the reserve is used up. See zk_slist_reserve().
+ */
+zk_status zk_dlist_reserve(size_t const count)
+{
+	return zk_node_cache_reserve(sizeof(zk_dlist), count);
+}
+
 // Destructor
 void zk_dlist_free(zk_dlist **list_p, zk_destructor_t const func)
 {
 	if (list_p != NULL) {
+		zk_dlist *ahead = zk_dlist_prefetch_begin(*list_p, NULL);
 		while ((*list_p) != NULL) {
+			ahead = zk_dlist_prefetch_next(ahead, NULL);
 			zk_dlist *node = *list_p;
 			*list_p = node->next;
 			_zk_dlist_free(&node, func);
@@ -68,6 +115,39 @@ void zk_dlist_free(zk_dlist **list_p, zk_destructor_t const func)
 	}
 }
 
+static void zk_dlist_reclaim(void *list, zk_destructor_t func)
+{
+	zk_dlist *detached = list;
+	zk_dlist_free(&detached, func);
+}
+
+zk_status zk_dlist_free_async(zk_dlist **list_p, zk_destructor_t const func)
+{
+	if (list_p == NULL)
+		return ZK_INVALID_ARGUMENT;
+	if (*list_p == NULL)
+		return ZK_OK;
+
+	zk_status const status = zk_reclaim_submit(*list_p, zk_dlist_reclaim, func);
+	if (status == ZK_OK)
+		*list_p = NULL;
+	return status;
+}
+
+bool zk_dlist_free_budget(zk_dlist **list_p, zk_destructor_t const func, zk_budget const budget)
+{
+	if (list_p == NULL)
+		return true;
+
+	zk_budget_meter meter = zk_budget_start(budget);
+	while (*list_p != NULL) {
+		zk_dlist_pop_front(list_p, func);
+		if (!zk_budget_spend(&meter))
+			break;
+	}
+	return *list_p == NULL;
+}
+
 // Element access
 zk_status zk_dlist_get_data(const zk_dlist *const list, void **data)
 {
@@ -114,12 +194,147 @@ zk_dlist *zk_dlist_end(zk_dlist *list)
 void zk_dlist_for_each(zk_dlist *begin, zk_dlist *const end, zk_for_each_func const func, void *const user_data)
 {
 	if (func != NULL) {
+		zk_dlist *ahead = zk_dlist_prefetch_begin(begin, end);
 		for (; begin != end; begin = begin->next) {
+			ahead = zk_dlist_prefetch_next(ahead, end);
 			func(begin->data, user_data);
 		}
 	}
 }
 
+void zk_dlist_for_each_batch(zk_dlist *begin,
+                             zk_dlist *const end,
+                             zk_for_each_batch_func const func,
+                             void *const user_data)
+{
+	if (func != NULL) {
+		void *batch[ZK_BATCH_SIZE];
+		size_t count = 0;
+		zk_dlist *ahead = zk_dlist_prefetch_begin(begin, end);
+		for (; begin != end; begin = begin->next) {
+			ahead = zk_dlist_prefetch_next(ahead, end);
+			batch[count++] = begin->data;
+			if (count == ZK_BATCH_SIZE) {
+				func(batch, count, user_data);
+				count = 0;
+			}
+		}
+		if (count > 0)
+			func(batch, count, user_data);
+	}
+}
+
+zk_dlist *zk_dlist_for_each_until(zk_dlist *begin,
+                                  zk_dlist *const end,
+                                  zk_for_each_until_func const func,
+                                  void *const user_data)
+{
+	if (func != NULL) {
+		zk_dlist *ahead = zk_dlist_prefetch_begin(begin, end);
+		for (; begin != end; begin = begin->next) {
+			ahead = zk_dlist_prefetch_next(ahead, end);
+			if (func(begin->data, user_data) == ZK_STOP)
+				return begin;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * @brief Range of the list run by one thread of zk_dlist_for_each_parallel().
+ */
+struct zk_dlist_chunk {
+	zk_dlist *begin;
+	zk_dlist *end;
+	zk_for_each_func func;
+	void *user_data;
+};
+
+static void zk_dlist_chunk_run(void *task)
+{
+	struct zk_dlist_chunk *chunk = task;
+	zk_dlist_for_each(chunk->begin, chunk->end, chunk->func, chunk->user_data);
+}
+
+zk_status zk_dlist_for_each_parallel(zk_dlist *begin,
+                                     zk_dlist *const end,
+                                     zk_for_each_func const func,
+                                     void *const *const user_data,
+                                     size_t const threads)
+{
+	if (func == NULL || threads == 0)
+		return ZK_INVALID_ARGUMENT;
+
+	if (threads > SIZE_MAX / (sizeof(struct zk_dlist_chunk) + sizeof(void *)) - 1)
+		return ZK_ERROR_ALLOC;
+
+	// the bounds of the chunks share their allocation
+	struct zk_dlist_chunk *chunks = malloc(threads * sizeof(struct zk_dlist_chunk) + (threads + 1) * sizeof(void *));
+	if (chunks == NULL)
+		return ZK_ERROR_ALLOC;
+	void **bounds = (void **)(chunks + threads);
+
+	size_t count = 0;
+	zk_status status = zk_parallel_split(begin, end, threads, bounds, &count);
+	for (size_t i = 0; status == ZK_OK && i < count; i++) {
+		chunks[i].begin = bounds[i];
+		chunks[i].end = bounds[i + 1];
+		chunks[i].func = func;
+		chunks[i].user_data = user_data != NULL ? user_data[i] : NULL;
+	}
+
+	if (status == ZK_OK && count > 0)
+		status = zk_parallel_run(chunks, sizeof(struct zk_dlist_chunk), count, zk_dlist_chunk_run);
+	free(chunks);
+	return status;
+}
+
+// Lookup
+zk_dlist *zk_dlist_find_if(zk_dlist *list, zk_predicate_func const func, void *const user_data)
+{
+	if (func != NULL) {
+		for (; list != NULL; list = list->next) {
+			if (func(list->data, user_data)) {
+				return list;
+			}
+		}
+	}
+	return NULL;
+}
+
+size_t zk_dlist_count_if(const zk_dlist *const list, zk_predicate_func const func, void *const user_data)
+{
+	size_t count = 0;
+	if (func != NULL) {
+		for (const zk_dlist *node = list; node != NULL; node = node->next) {
+			count += func(node->data, user_data);
+		}
+	}
+	return count;
+}
+
+zk_status zk_dlist_find_all(zk_dlist *list,
+                            zk_predicate_func const func,
+                            void *const user_data,
+                            zk_dlist ***nodes_p,
+                            size_t *const capacity_p,
+                            size_t *const count_p)
+{
+	if (func == NULL || nodes_p == NULL || capacity_p == NULL || count_p == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	*count_p = 0;
+	for (; list != NULL; list = list->next) {
+		if (func(list->data, user_data)) {
+			if (zk_dlist_nodes_append(nodes_p, capacity_p, *count_p, list) != ZK_OK)
+				return ZK_ERROR_ALLOC;
+			(*count_p)++;
+		}
+	}
+
+	return ZK_OK;
+}
+
 // Modifiers
 zk_status zk_dlist_pop_back(zk_dlist **list_p, zk_destructor_t const func)
 {
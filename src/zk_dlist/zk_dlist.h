@@ -1,16 +1,34 @@
 #ifndef ZK_DLIST_H
 #define ZK_DLIST_H
 
+#include "zk_budget/zk_budget.h"
 #include "zk_common/zk_common.h"
+#include "zk_iter/zk_iter.h"
 
+/**
+ * @brief: Doubly linked list struct
+ */
+struct zk_dlist {
+	void *data;
+	struct zk_dlist *next;
+	struct zk_dlist *prev;
+};
 typedef struct zk_dlist zk_dlist;
 
+ZK_ITER_ASSERT_NODE_LAYOUT(zk_dlist);
+
 // Constructor
 zk_status zk_dlist_new_node(zk_dlist **node_p, void *const data);
 
+zk_status zk_dlist_reserve(size_t const count);
+
 // Destructor
 void zk_dlist_free(zk_dlist **list_p, zk_destructor_t const func);
 
+zk_status zk_dlist_free_async(zk_dlist **list_p, zk_destructor_t const func);
+
+bool zk_dlist_free_budget(zk_dlist **list_p, zk_destructor_t const func, zk_budget const budget);
+
 // Element access
 zk_status zk_dlist_get_data(const zk_dlist *const list, void **data);
 
@@ -25,6 +43,34 @@ zk_dlist *zk_dlist_end(zk_dlist *list);
 
 void zk_dlist_for_each(zk_dlist *begin, zk_dlist *const end, zk_for_each_func func, void *const user_data);
 
+void zk_dlist_for_each_batch(zk_dlist *begin,
+                             zk_dlist *const end,
+                             zk_for_each_batch_func const func,
+                             void *const user_data);
+
+zk_dlist *zk_dlist_for_each_until(zk_dlist *begin,
+                                  zk_dlist *const end,
+                                  zk_for_each_until_func const func,
+                                  void *const user_data);
+
+zk_status zk_dlist_for_each_parallel(zk_dlist *begin,
+                                     zk_dlist *const end,
+                                     zk_for_each_func const func,
+                                     void *const *const user_data,
+                                     size_t const threads);
+
+// Lookup
+zk_dlist *zk_dlist_find_if(zk_dlist *list, zk_predicate_func const func, void *const user_data);
+
+size_t zk_dlist_count_if(const zk_dlist *const list, zk_predicate_func const func, void *const user_data);
+
+zk_status zk_dlist_find_all(zk_dlist *list,
+                            zk_predicate_func const func,
+                            void *const user_data,
+                            zk_dlist ***nodes_p,
+                            size_t *const capacity_p,
+                            size_t *const count_p);
+
 // Modifiers
 zk_status zk_dlist_pop_back(zk_dlist **list_p, zk_destructor_t const func);
 
@@ -34,4 +80,48 @@ zk_status zk_dlist_push_back(zk_dlist **list_p, void *const data);
 
 zk_status zk_dlist_push_front(zk_dlist **list_p, void *const data);
 
+// Inline iteration
+
+/**
+ * @brief Iterates over every node of the list as a plain pointer loop, without calling through function pointers.
+ *
+ * @param NODE A `zk_dlist *` variable that points to each node in turn.
+ * @param LIST The list to iterate.
+ */
+#define ZK_DLIST_FOREACH(NODE, LIST)                 \
+	for ((NODE) = _zk_dlist_foreach_first(LIST); \
+	     (NODE) != NULL;                         \
+	     (NODE) = _zk_dlist_foreach_next(LIST, NODE))
+
+/**
+ * @brief Same as ZK_DLIST_FOREACH() but the loop body may unlink and free NODE.
+ *
+ * @param NODE A `zk_dlist *` variable that points to each node in turn.
+ * @param TMP A `zk_dlist *` variable used to hold the next node.
+ * @param LIST The list to iterate.
+ */
+#define ZK_DLIST_FOREACH_SAFE(NODE, TMP, LIST)                                  \
+	for ((NODE) = _zk_dlist_foreach_first(LIST);                            \
+	     (NODE) != NULL && ((TMP) = _zk_dlist_foreach_next(LIST, NODE), 1); \
+	     (NODE) = (TMP))
+
+static inline zk_dlist *_zk_dlist_foreach_first(zk_dlist *list)
+{
+	return list;
+}
+
+static inline zk_dlist *_zk_dlist_foreach_next(const zk_dlist *const list, zk_dlist *node)
+{
+	ZK_UNUSED(list);
+	return node->next;
+}
+
+/**
+ * @brief Returns an iterator on the first element of the list, see zk_iter.
+ */
+static inline zk_iter zk_dlist_iter(zk_dlist *list)
+{
+	return zk_iter_new(list, NULL);
+}
+
 #endif
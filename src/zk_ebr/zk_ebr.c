@@ -0,0 +1,264 @@
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+
+#include "zk_ebr/zk_ebr.h"
+
+#if defined(__SANITIZE_THREAD__)
+#define ZK_EBR_TSAN 1
+#elif defined(__has_feature)
+#if __has_feature(thread_sanitizer)
+#define ZK_EBR_TSAN 1
+#endif
+#endif
+#ifndef ZK_EBR_TSAN
+#define ZK_EBR_TSAN 0
+#endif
+
+/*
+ * Epoch-based reclamation. A global epoch counter only advances once every thread inside a critical section has
+ * observed its current value. A node retired during epoch e was unlinked before, so threads that enter a critical
+ * section afterwards cannot reach it. Once the epoch reaches e + 2, every thread that could have read the node has left
+ * the critical section it read it in, and its destructor runs.
+ *
+ * Each thread keeps its retired nodes in a private FIFO list, so retiring needs no synchronization, and reclaims its
+ * oldest nodes every ZK_EBR_THRESHOLD retirements. The nodes left when a thread exits are handed over to a shared
+ * orphan list, reclaimed by the next threads that collect.
+ *
+ * Thread records are taken from a static table, registration therefore never allocates and cannot fail.
+ */
+
+/**
+ * @brief Per-thread record. `state` is read by other threads, it is alone on its cache line.
+ */
+struct zk_ebr_thread {
+	_Alignas(ZK_CACHE_LINE) uint64_t state; // (epoch << 1) | 1 inside a critical section, 0 outside
+	bool in_use;
+	size_t nesting;
+	size_t since_collect;
+	size_t count;
+	zk_ebr_node *head; // oldest retired node
+	zk_ebr_node *tail;
+};
+
+static _Alignas(ZK_CACHE_LINE) uint64_t zk_ebr_epoch = 1;
+static struct zk_ebr_thread zk_ebr_threads[ZK_EBR_MAX_THREADS];
+static size_t zk_ebr_thread_count; // records ever used, only the first ones are scanned
+static _Thread_local struct zk_ebr_thread *zk_ebr_self;
+static pthread_key_t zk_ebr_key;
+static pthread_once_t zk_ebr_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t zk_ebr_orphans_mutex = PTHREAD_MUTEX_INITIALIZER;
+static struct zk_ebr_thread zk_ebr_orphans; // guarded by the mutex
+static size_t zk_ebr_orphan_count; // copy of zk_ebr_orphans.count read without the mutex
+
+// Private functions
+static void zk_ebr_append(struct zk_ebr_thread *const thread, zk_ebr_node *const head, zk_ebr_node *const tail)
+{
+	if (thread->tail != NULL)
+		thread->tail->next = head;
+	else
+		thread->head = head;
+	thread->tail = tail;
+}
+
+// Runs the destructors of the nodes retired at least two epochs before `epoch`, oldest first.
+static void zk_ebr_reclaim(struct zk_ebr_thread *const thread, uint64_t const epoch)
+{
+	while (thread->head != NULL && thread->head->epoch + 2 <= epoch) {
+		zk_ebr_node *node = thread->head;
+		thread->head = node->next;
+		if (thread->head == NULL)
+			thread->tail = NULL;
+		thread->count--;
+		if (node->func != NULL)
+			node->func(node);
+	}
+}
+
+static void zk_ebr_reclaim_orphans(uint64_t const epoch, bool const wait)
+{
+	if (__atomic_load_n(&zk_ebr_orphan_count, __ATOMIC_RELAXED) == 0)
+		return;
+	if (wait)
+		pthread_mutex_lock(&zk_ebr_orphans_mutex);
+	else if (pthread_mutex_trylock(&zk_ebr_orphans_mutex) != 0)
+		return;
+	zk_ebr_reclaim(&zk_ebr_orphans, epoch);
+	__atomic_store_n(&zk_ebr_orphan_count, zk_ebr_orphans.count, __ATOMIC_RELAXED);
+	pthread_mutex_unlock(&zk_ebr_orphans_mutex);
+}
+
+// Advances the global epoch if every thread inside a critical section observed it. Returns the current epoch.
+static uint64_t zk_ebr_try_advance(void)
+{
+	uint64_t epoch = __atomic_load_n(&zk_ebr_epoch, __ATOMIC_SEQ_CST);
+	size_t const count = __atomic_load_n(&zk_ebr_thread_count, __ATOMIC_ACQUIRE);
+	for (size_t i = 0; i < count; i++) {
+		uint64_t const state = __atomic_load_n(&zk_ebr_threads[i].state, __ATOMIC_SEQ_CST);
+		if ((state & 1) && (state >> 1) != epoch)
+			return epoch;
+	}
+	if (__atomic_compare_exchange_n(&zk_ebr_epoch, &epoch, epoch + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+		return epoch + 1;
+	return epoch;
+}
+
+static void zk_ebr_thread_exit(void *arg)
+{
+	struct zk_ebr_thread *thread = arg;
+
+	zk_ebr_reclaim(thread, zk_ebr_try_advance());
+	if (thread->head != NULL) {
+		pthread_mutex_lock(&zk_ebr_orphans_mutex);
+		zk_ebr_append(&zk_ebr_orphans, thread->head, thread->tail);
+		zk_ebr_orphans.count += thread->count;
+		__atomic_store_n(&zk_ebr_orphan_count, zk_ebr_orphans.count, __ATOMIC_RELAXED);
+		pthread_mutex_unlock(&zk_ebr_orphans_mutex);
+	}
+	thread->head = NULL;
+	thread->tail = NULL;
+	thread->count = 0;
+	thread->since_collect = 0;
+	thread->nesting = 0;
+	__atomic_store_n(&thread->state, 0, __ATOMIC_RELEASE);
+	// destructors of other thread specific data running later register a new record
+	zk_ebr_self = NULL;
+	__atomic_store_n(&thread->in_use, false, __ATOMIC_RELEASE);
+}
+
+static void zk_ebr_init(void)
+{
+	pthread_key_create(&zk_ebr_key, zk_ebr_thread_exit);
+}
+
+// Returns the record of the calling thread, taking a free one on first use.
+static struct zk_ebr_thread *zk_ebr_thread_get(void)
+{
+	if (zk_ebr_self != NULL)
+		return zk_ebr_self;
+
+	pthread_once(&zk_ebr_once, zk_ebr_init);
+	for (;;) {
+		for (size_t i = 0; i < ZK_EBR_MAX_THREADS; i++) {
+			struct zk_ebr_thread *thread = &zk_ebr_threads[i];
+			bool expected = false;
+			if (__atomic_load_n(&thread->in_use, __ATOMIC_RELAXED) ||
+			    !__atomic_compare_exchange_n(&thread->in_use, &expected, true, false, __ATOMIC_ACQUIRE,
+			                                 __ATOMIC_RELAXED))
+				continue;
+
+			size_t count = __atomic_load_n(&zk_ebr_thread_count, __ATOMIC_RELAXED);
+			while (count <= i && !__atomic_compare_exchange_n(&zk_ebr_thread_count, &count, i + 1, true,
+			                                                  __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+				;
+			pthread_setspecific(zk_ebr_key, thread);
+			zk_ebr_self = thread;
+			return thread;
+		}
+		// every record is taken, wait for a thread to exit
+		sched_yield();
+	}
+}
+
+// Critical sections
+
+/**
+ * @brief Enters a critical section. Nodes reachable from a concurrent container inside the critical section stay
+ *        valid until zk_ebr_exit(), even if another thread retires them. Critical sections may be nested.
+ *
+ * @note Must be kept short: no retired node is reclaimed while a thread stays inside a critical section.
+ */
+void zk_ebr_enter(void)
+{
+	struct zk_ebr_thread *thread = zk_ebr_thread_get();
+	if (thread->nesting++ == 0) {
+		uint64_t const epoch = __atomic_load_n(&zk_ebr_epoch, __ATOMIC_SEQ_CST);
+		// the announcement must be visible before the container is read. Readers only write their own cache line and
+		// use no read-modify-write, except under ThreadSanitizer that does not support fences.
+#if ZK_EBR_TSAN
+		__atomic_exchange_n(&thread->state, epoch << 1 | 1, __ATOMIC_SEQ_CST);
+#else
+		__atomic_store_n(&thread->state, epoch << 1 | 1, __ATOMIC_RELAXED);
+		__atomic_thread_fence(__ATOMIC_SEQ_CST);
+#endif
+	}
+}
+
+/**
+ * @brief Leaves the critical section entered by the matching zk_ebr_enter().
+ */
+void zk_ebr_exit(void)
+{
+	struct zk_ebr_thread *thread = zk_ebr_thread_get();
+	if (thread->nesting > 0 && --thread->nesting == 0)
+		__atomic_store_n(&thread->state, 0, __ATOMIC_RELEASE);
+}
+
+// Reclamation
+
+/**
+ * @brief Waits until every node retired so far by the calling thread, or by exited threads, can be reclaimed, and
+ *        runs their destructors. Used when a container is freed.
+ *
+ * @note Blocks while another thread stays inside a critical section. Called inside a critical section, it does not
+ *       wait and behaves like zk_ebr_collect().
+ */
+void zk_ebr_barrier(void)
+{
+	struct zk_ebr_thread *thread = zk_ebr_thread_get();
+	if (thread->nesting != 0) {
+		zk_ebr_collect();
+		return;
+	}
+
+	uint64_t const target = __atomic_load_n(&zk_ebr_epoch, __ATOMIC_SEQ_CST) + 2;
+	uint64_t epoch;
+	while ((epoch = zk_ebr_try_advance()) < target)
+		sched_yield();
+	zk_ebr_reclaim(thread, epoch);
+	zk_ebr_reclaim_orphans(epoch, true);
+}
+
+/**
+ * @brief Tries to advance the epoch and runs the destructors of the nodes that can be reclaimed, without waiting.
+ */
+void zk_ebr_collect(void)
+{
+	struct zk_ebr_thread *thread = zk_ebr_thread_get();
+	uint64_t const epoch = zk_ebr_try_advance();
+	thread->since_collect = 0;
+	zk_ebr_reclaim(thread, epoch);
+	zk_ebr_reclaim_orphans(epoch, false);
+}
+
+/**
+ * @brief Returns the number of nodes retired by the calling thread and not reclaimed yet.
+ */
+size_t zk_ebr_pending(void)
+{
+	return zk_ebr_thread_get()->count;
+}
+
+/**
+ * @brief Defers the destruction of a node unlinked from a concurrent container until no thread can still read it.
+ *
+ * @param node Link embedded in the node. The node must already be unreachable for threads entering a critical section.
+ * @param func Pointer to the destructor called with `node` once it is safe. If NULL, nothing is called.
+ *
+ * @note Never allocates. Every ZK_EBR_THRESHOLD calls the thread reclaims its oldest nodes, so its garbage stays
+ *       within a few times ZK_EBR_THRESHOLD nodes unless a thread stays inside a critical section.
+ */
+void zk_ebr_retire(zk_ebr_node *const node, zk_destructor_t const func)
+{
+	if (node == NULL)
+		return;
+
+	struct zk_ebr_thread *thread = zk_ebr_thread_get();
+	node->next = NULL;
+	node->func = func;
+	node->epoch = __atomic_load_n(&zk_ebr_epoch, __ATOMIC_SEQ_CST);
+	zk_ebr_append(thread, node, node);
+	thread->count++;
+	if (++thread->since_collect >= ZK_EBR_THRESHOLD)
+		zk_ebr_collect();
+}
@@ -0,0 +1,55 @@
+#ifndef ZK_EBR_H
+#define ZK_EBR_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "zk_common/zk_common.h"
+
+/**
+ * Maximum number of threads registered with the reclamation at the same time. The record of a thread is released when
+ * it exits and reused by the next thread.
+ */
+#ifndef ZK_EBR_MAX_THREADS
+#define ZK_EBR_MAX_THREADS 256
+#endif
+
+/**
+ * Number of nodes a thread retires before it tries to reclaim them. It bounds the garbage of each thread as long as no
+ * thread stays inside a critical section.
+ */
+#ifndef ZK_EBR_THRESHOLD
+#define ZK_EBR_THRESHOLD (2 * ZK_BATCH_SIZE)
+#endif
+
+/**
+ * @brief Link embedded in the nodes of concurrent containers to retire them without allocating. The destructor given
+ *        to zk_ebr_retire() receives this link, the node is retrieved with ZK_EBR_ENTRY().
+ */
+struct zk_ebr_node {
+	struct zk_ebr_node *next;
+	zk_destructor_t func;
+	uint64_t epoch;
+};
+typedef struct zk_ebr_node zk_ebr_node;
+
+/**
+ * @brief Returns the node of type TYPE whose member MEMBER is the zk_ebr_node NODE.
+ */
+#define ZK_EBR_ENTRY(NODE, TYPE, MEMBER) ((TYPE *)(void *)((char *)(NODE) - offsetof(TYPE, MEMBER)))
+
+// Critical sections
+void zk_ebr_enter(void);
+
+void zk_ebr_exit(void);
+
+// Reclamation
+void zk_ebr_barrier(void);
+
+void zk_ebr_collect(void);
+
+size_t zk_ebr_pending(void);
+
+void zk_ebr_retire(zk_ebr_node *const node, zk_destructor_t const func);
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef ZK_FOLD_H
+#define ZK_FOLD_H
+
+#include <stdint.h>
+
+#include "zk_common/zk_common.h"
+#include "zk_iter/zk_iter.h"
+
+/*
+ * Reductions over a zk_iter. They are static inline so the loop is the plain pointer walk of zk_iter and, when the
+ * callback is known at the call site, the compiler can inline it too. zk_fold(), zk_fold_int(), zk_fold_double(),
+ * zk_sum_int() and zk_sum_double() in zk_container.h apply them to any container.
+ */
+
+// Reduction
+
+/**
+ * @brief Folds the elements of `it` into an accumulator: acc = func(acc, data, user_data) for every element, in order.
+ *
+ * @return The final accumulator, `init` if there is no element or `func` is NULL.
+ */
+static inline void *zk_iter_fold(zk_iter it, void *init, zk_fold_func const func, void *const user_data)
+{
+	if (func != NULL) {
+		for (; zk_iter_valid(it); it = zk_iter_next(it))
+			init = func(init, zk_iter_data(it), user_data);
+	}
+	return init;
+}
+
+/**
+ * @brief Same as zk_iter_fold() with an integer accumulator carried by value.
+ */
+static inline int64_t zk_iter_fold_int(zk_iter it, int64_t init, zk_fold_int_func const func, void *const user_data)
+{
+	if (func != NULL) {
+		for (; zk_iter_valid(it); it = zk_iter_next(it))
+			init = func(init, zk_iter_data(it), user_data);
+	}
+	return init;
+}
+
+/**
+ * @brief Same as zk_iter_fold() with a floating point accumulator carried by value.
+ */
+static inline double zk_iter_fold_double(zk_iter it, double init, zk_fold_double_func const func, void *const user_data)
+{
+	if (func != NULL) {
+		for (; zk_iter_valid(it); it = zk_iter_next(it))
+			init = func(init, zk_iter_data(it), user_data);
+	}
+	return init;
+}
+
+/**
+ * @brief Sums elements whose data points to an `int`, without any callback.
+ */
+static inline int64_t zk_iter_sum_int(zk_iter it)
+{
+	int64_t sum = 0;
+	for (; zk_iter_valid(it); it = zk_iter_next(it))
+		sum += *(const int *)zk_iter_data(it);
+	return sum;
+}
+
+/**
+ * @brief Sums elements whose data points to a `double`, without any callback.
+ */
+static inline double zk_iter_sum_double(zk_iter it)
+{
+	double sum = 0.0;
+	for (; zk_iter_valid(it); it = zk_iter_next(it))
+		sum += *(const double *)zk_iter_data(it);
+	return sum;
+}
+
+#endif
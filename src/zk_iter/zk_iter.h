@@ -0,0 +1,77 @@
+#ifndef ZK_ITER_H
+#define ZK_ITER_H
+
+#include <stddef.h>
+#include <string.h>
+
+#include "zk_common/zk_common.h"
+
+/**
+ * @brief Layout every container node starts with: the data pointer followed by the link to the next node. Containers
+ *        check it with ZK_ITER_ASSERT_NODE_LAYOUT(), which is what lets a single zk_iter walk all of them.
+ */
+struct zk_iter_node {
+	void *data;
+	struct zk_iter_node *next;
+};
+
+#define ZK_ITER_ASSERT_NODE_LAYOUT(TYPE)                                              \
+	_Static_assert(offsetof(TYPE, data) == offsetof(struct zk_iter_node, data) && \
+	               offsetof(TYPE, next) == offsetof(struct zk_iter_node, next),   \
+	               #TYPE " does not start with the zk_iter_node layout")
+
+/**
+ * @brief Forward iterator over any container, passed and returned by value.
+ *
+ * Every container uses the same semantics: the iterator starts on the first element, zk_iter_next() moves to the
+ * following one and the iterator becomes invalid after the last element. There is no separate end iterator, circular
+ * lists record their last node so that the walk stops after one lap.
+ *
+ * @code
+ * for (zk_iter it = zk_iter_begin(list); zk_iter_valid(it); it = zk_iter_next(it))
+ *         sum += *(int *)zk_iter_data(it);
+ * @endcode
+ */
+struct zk_iter {
+	void *node; // current node, NULL once the iteration is over
+	void *last; // last node of a circular list, NULL for linear lists
+};
+typedef struct zk_iter zk_iter;
+
+// Constructor
+static inline zk_iter zk_iter_new(void *const first, void *const last)
+{
+	return (zk_iter){ .node = first, .last = last };
+}
+
+// Element access
+static inline bool zk_iter_valid(zk_iter const it)
+{
+	return it.node != NULL;
+}
+
+static inline void *zk_iter_node(zk_iter const it)
+{
+	return it.node;
+}
+
+// memcpy keeps the loads free of type punning, it compiles to a single load
+static inline void *zk_iter_data(zk_iter const it)
+{
+	void *data;
+	memcpy(&data, (char *)it.node + offsetof(struct zk_iter_node, data), sizeof(data));
+	return data;
+}
+
+// Iterators
+static inline zk_iter zk_iter_next(zk_iter it)
+{
+	if (it.node == it.last) {
+		it.node = NULL;
+	} else {
+		memcpy(&it.node, (char *)it.node + offsetof(struct zk_iter_node, next), sizeof(it.node));
+	}
+	return it;
+}
+
+#endif
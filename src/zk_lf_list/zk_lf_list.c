@@ -0,0 +1,295 @@
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "zk_ebr/zk_ebr.h"
+#include "zk_lf_list/zk_lf_list.h"
+
+/*
+ * Harris list with the traversal of Michael: a node is removed in two steps. It is first marked, by setting the low
+ * bit of its own `next` field, which logically removes it and freezes its successor, then unlinked from its
+ * predecessor. Any thread traversing the list unlinks the marked nodes it meets, so a removal is complete even if its
+ * thread is preempted after the mark.
+ *
+ * The thread whose compare and swap unlinks a node is the only one to retire it. The destructor is given once for the
+ * list rather than to each removal, since the node may be unlinked and retired by another thread than the one that
+ * marked it.
+ *
+ * Every operation runs inside an epoch critical section. Lookups may still stand on an unlinked node, so unlinked nodes
+ * and their data are retired through zk_ebr and freed once no traversal can reach them.
+ */
+
+#define ZK_LF_LIST_MARK ((uintptr_t)1)
+
+/**
+ * @brief List node. `next` holds the successor and the mark bit, it is read and written with atomic builtins.
+ */
+struct zk_lf_list_node {
+	void *data;
+	uintptr_t next;
+	zk_destructor_t destructor;
+	zk_ebr_node ebr;
+};
+
+/**
+ * @brief Lock-free list. `head` is a sentinel that is never removed.
+ */
+struct zk_lf_list {
+	struct zk_lf_list_node head;
+	zk_compare_func compare;
+	zk_destructor_t destructor;
+	size_t size;
+};
+
+// Private functions
+static uintptr_t zk_lf_list_load(const struct zk_lf_list_node *const node)
+{
+	return __atomic_load_n(&node->next, __ATOMIC_ACQUIRE);
+}
+
+static bool zk_lf_list_cas(struct zk_lf_list_node *const node, uintptr_t expected, uintptr_t const desired)
+{
+	return __atomic_compare_exchange_n(&node->next, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+static struct zk_lf_list_node *zk_lf_list_ptr(uintptr_t const next)
+{
+	return (struct zk_lf_list_node *)(next & ~ZK_LF_LIST_MARK);
+}
+
+static void zk_lf_list_node_free(void *ebr)
+{
+	struct zk_lf_list_node *node = ZK_EBR_ENTRY(ebr, struct zk_lf_list_node, ebr);
+	if (node->destructor != NULL)
+		node->destructor(node->data);
+	free(node);
+}
+
+// the node outlives the list if a critical section of another thread delays its reclamation
+static void zk_lf_list_retire(zk_lf_list *const list, struct zk_lf_list_node *const node)
+{
+	node->destructor = list->destructor;
+	zk_ebr_retire(&node->ebr, zk_lf_list_node_free);
+}
+
+// Finds pred and curr such that pred < data <= curr, curr being NULL at the end of the list, and unlinks the marked
+// nodes on the way. Returns true if curr is equal to data. Runs inside a critical section.
+static bool zk_lf_list_find(zk_lf_list *const list,
+                            const void *const data,
+                            struct zk_lf_list_node **pred_p,
+                            struct zk_lf_list_node **curr_p)
+{
+retry:;
+	struct zk_lf_list_node *pred = &list->head;
+	struct zk_lf_list_node *curr = zk_lf_list_ptr(zk_lf_list_load(pred));
+	while (curr != NULL) {
+		uintptr_t const next = zk_lf_list_load(curr);
+		if (next & ZK_LF_LIST_MARK) {
+			// fails if pred was marked or its successor changed, the traversal then restarts
+			if (!zk_lf_list_cas(pred, (uintptr_t)curr, next & ~ZK_LF_LIST_MARK))
+				goto retry;
+			zk_lf_list_retire(list, curr);
+			curr = zk_lf_list_ptr(next);
+			continue;
+		}
+
+		int const cmp = list->compare(curr->data, data);
+		if (cmp >= 0) {
+			*pred_p = pred;
+			*curr_p = curr;
+			return cmp == 0;
+		}
+		pred = curr;
+		curr = zk_lf_list_ptr(next);
+	}
+	*pred_p = pred;
+	*curr_p = NULL;
+	return false;
+}
+
+// Constructor
+
+/**
+ * @brief Creates an empty list kept sorted in ascending order of `compare`, holding at most one element per value.
+ *
+ * @param list_p Pointer to the list to create.
+ * @param compare Pointer to the function comparing two data.
+ * @param func Pointer to the destructor applied to the data once removed from the list and no longer read by any
+ *             thread, or when the list is freed. If NULL, the data is not freed.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if arguments are invalid or ZK_ERROR_ALLOC on allocation failure.
+ */
+zk_status zk_lf_list_new(zk_lf_list **list_p, zk_compare_func const compare, zk_destructor_t const func)
+{
+	if (list_p == NULL || compare == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	zk_lf_list *list = calloc(1, sizeof(zk_lf_list));
+	if (list == NULL)
+		return ZK_ERROR_ALLOC;
+
+	list->compare = compare;
+	list->destructor = func;
+
+	*list_p = list;
+	return ZK_OK;
+}
+
+// Destructor
+
+/**
+ * @brief Frees the list and its data. Must not run concurrently with other operations on the list. Also waits for the
+ *        nodes removed by the calling thread to be reclaimed, see zk_ebr_barrier().
+ *
+ * @param list_p Pointer to the list. It is set to NULL after the list is freed.
+ */
+void zk_lf_list_free(zk_lf_list **list_p)
+{
+	if (list_p == NULL || *list_p == NULL)
+		return;
+
+	zk_lf_list *list = *list_p;
+	// marked nodes not unlinked yet are still reachable, their data is freed once like any other
+	struct zk_lf_list_node *node = zk_lf_list_ptr(list->head.next);
+	while (node != NULL) {
+		struct zk_lf_list_node *next = zk_lf_list_ptr(node->next);
+		if (list->destructor != NULL)
+			list->destructor(node->data);
+		free(node);
+		node = next;
+	}
+
+	free(list);
+	*list_p = NULL;
+	zk_ebr_barrier();
+}
+
+// Capacity
+
+/**
+ * @brief Returns the number of elements in the list. While other threads update the list the value may be stale by
+ *        the time it is used.
+ */
+size_t zk_lf_list_size(const zk_lf_list *const list)
+{
+	return list != NULL ? __atomic_load_n(&list->size, __ATOMIC_RELAXED) : 0;
+}
+
+// Lookup
+
+/**
+ * @brief Tests whether the list holds an element equal to `data`. Wait-free: it neither locks nor helps updates.
+ *
+ * @note Time complexity: O(n).
+ */
+bool zk_lf_list_contains(const zk_lf_list *const list, const void *const data)
+{
+	if (list == NULL)
+		return false;
+
+	zk_ebr_enter();
+	struct zk_lf_list_node *curr = zk_lf_list_ptr(zk_lf_list_load(&list->head));
+	while (curr != NULL && list->compare(curr->data, data) < 0)
+		curr = zk_lf_list_ptr(zk_lf_list_load(curr));
+	bool const found =
+		curr != NULL && list->compare(curr->data, data) == 0 && !(zk_lf_list_load(curr) & ZK_LF_LIST_MARK);
+	zk_ebr_exit();
+	return found;
+}
+
+/**
+ * @brief Calls `func` on the data of each element, in order. Elements inserted or removed during the traversal may or
+ *        may not be visited.
+ */
+void zk_lf_list_for_each(const zk_lf_list *const list, zk_for_each_func const func, void *const user_data)
+{
+	if (list == NULL || func == NULL)
+		return;
+
+	zk_ebr_enter();
+	struct zk_lf_list_node *node = zk_lf_list_ptr(zk_lf_list_load(&list->head));
+	while (node != NULL) {
+		uintptr_t const next = zk_lf_list_load(node);
+		if (!(next & ZK_LF_LIST_MARK))
+			func(node->data, user_data);
+		node = zk_lf_list_ptr(next);
+	}
+	zk_ebr_exit();
+}
+
+// Modifiers
+
+/**
+ * @brief Inserts `data` at its sorted position, unless the list already holds an equal element.
+ *
+ * @return ZK_OK on success, ZK_ERROR_EXISTS if an equal element is in the list, ZK_INVALID_ARGUMENT if `list` is NULL
+ *         or ZK_ERROR_ALLOC on allocation failure. The data is owned by the list only on success.
+ *
+ * @note Time complexity: O(n).
+ */
+zk_status zk_lf_list_insert(zk_lf_list *const list, void *const data)
+{
+	if (list == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	struct zk_lf_list_node *node = malloc(sizeof(struct zk_lf_list_node));
+	if (node == NULL)
+		return ZK_ERROR_ALLOC;
+	node->data = data;
+
+	zk_status status = ZK_ERROR_EXISTS;
+	zk_ebr_enter();
+	for (;;) {
+		struct zk_lf_list_node *pred;
+		struct zk_lf_list_node *curr;
+		if (zk_lf_list_find(list, data, &pred, &curr))
+			break;
+		__atomic_store_n(&node->next, (uintptr_t)curr, __ATOMIC_RELAXED);
+		if (zk_lf_list_cas(pred, (uintptr_t)curr, (uintptr_t)node)) {
+			__atomic_fetch_add(&list->size, 1, __ATOMIC_RELAXED);
+			status = ZK_OK;
+			break;
+		}
+	}
+	zk_ebr_exit();
+
+	if (status != ZK_OK)
+		free(node);
+	return status;
+}
+
+/**
+ * @brief Removes the element equal to `data`. Its data is freed with the destructor of the list.
+ *
+ * @return true if an element was removed, false otherwise.
+ *
+ * @note Time complexity: O(n).
+ */
+bool zk_lf_list_remove(zk_lf_list *const list, const void *const data)
+{
+	if (list == NULL)
+		return false;
+
+	bool removed = false;
+	zk_ebr_enter();
+	for (;;) {
+		struct zk_lf_list_node *pred;
+		struct zk_lf_list_node *curr;
+		if (!zk_lf_list_find(list, data, &pred, &curr))
+			break;
+
+		uintptr_t const next = zk_lf_list_load(curr);
+		// a concurrent removal marked the node first, the next find unlinks it
+		if ((next & ZK_LF_LIST_MARK) || !zk_lf_list_cas(curr, next, next | ZK_LF_LIST_MARK))
+			continue;
+
+		__atomic_fetch_sub(&list->size, 1, __ATOMIC_RELAXED);
+		if (zk_lf_list_cas(pred, (uintptr_t)curr, next))
+			zk_lf_list_retire(list, curr);
+		else
+			zk_lf_list_find(list, data, &pred, &curr);
+		removed = true;
+		break;
+	}
+	zk_ebr_exit();
+	return removed;
+}
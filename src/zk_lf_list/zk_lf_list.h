@@ -0,0 +1,33 @@
+#ifndef ZK_LF_LIST_H
+#define ZK_LF_LIST_H
+
+#include <stddef.h>
+
+#include "zk_common/zk_common.h"
+
+/**
+ * @brief Lock-free sorted singly linked list (Harris list) holding a set of data, safe to share between threads
+ *        without a mutex. Lookups never wait for updates.
+ */
+typedef struct zk_lf_list zk_lf_list;
+
+// Constructor
+zk_status zk_lf_list_new(zk_lf_list **list_p, zk_compare_func const compare, zk_destructor_t const func);
+
+// Destructor
+void zk_lf_list_free(zk_lf_list **list_p);
+
+// Capacity
+size_t zk_lf_list_size(const zk_lf_list *const list);
+
+// Lookup
+bool zk_lf_list_contains(const zk_lf_list *const list, const void *const data);
+
+void zk_lf_list_for_each(const zk_lf_list *const list, zk_for_each_func const func, void *const user_data);
+
+// Modifiers
+zk_status zk_lf_list_insert(zk_lf_list *const list, void *const data);
+
+bool zk_lf_list_remove(zk_lf_list *const list, const void *const data);
+
+#endif
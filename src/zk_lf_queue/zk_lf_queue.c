@@ -0,0 +1,264 @@
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "zk_lf_queue/zk_lf_queue.h"
+
+/*
+ * Michael-Scott queue with counted pointers, as in "Simple, Fast, and Practical Non-Blocking and Blocking Concurrent
+ * Queue Algorithms" (1996). The list always starts with a dummy node: `head` points to it and the front element is the
+ * node that follows. Popping makes that node the new dummy and releases the old one.
+ *
+ * Nodes keep the singly linked layout of zk_c_slist, data followed by the link to the next node, except that the link
+ * carries a counter next to the pointer. Head, tail and links are all updated by double width compare and swap with
+ * the counter incremented, which is what detects ABA on nodes that are reused.
+ *
+ * A link is only read to decide what to CAS, and the CAS compares both halves again, so loads read the pointer and the
+ * counter with two single word atomic loads instead of a double width one. A torn value makes the CAS fail and the
+ * operation retry, while the pointer read is always a node.
+ *
+ * Released nodes are type stable: they go to a Treiber free list and are reused by later pushes, so a thread that read
+ * a stale head or tail always dereferences a valid node. Nodes are freed by zk_lf_queue_free() only.
+ */
+
+struct zk_lf_queue_node;
+
+/**
+ * @brief Counted pointer to a node.
+ */
+struct zk_lf_queue_link {
+	// double width compare and swap requires the pair to be aligned on its size
+	_Alignas(2 * sizeof(void *)) struct zk_lf_queue_node *node;
+	uintptr_t tag;
+};
+
+/**
+ * @brief Queue node.
+ */
+struct zk_lf_queue_node {
+	void *data;
+	struct zk_lf_queue_link next;
+};
+
+/**
+ * @brief Lock-free queue. Producers write the tail, consumers the head, and both the free list, each gets its own cache
+ *        line.
+ */
+struct zk_lf_queue {
+	_Alignas(ZK_CACHE_LINE) struct zk_lf_queue_link head;
+	_Alignas(ZK_CACHE_LINE) struct zk_lf_queue_link tail;
+	_Alignas(ZK_CACHE_LINE) struct zk_lf_queue_link free;
+};
+
+// Private functions
+static struct zk_lf_queue_link zk_lf_queue_link_load(struct zk_lf_queue_link *const link)
+{
+	struct zk_lf_queue_link value;
+	value.tag = __atomic_load_n(&link->tag, __ATOMIC_ACQUIRE);
+	value.node = __atomic_load_n(&link->node, __ATOMIC_ACQUIRE);
+	return value;
+}
+
+static void zk_lf_queue_link_store(struct zk_lf_queue_link *const link, struct zk_lf_queue_link const value)
+{
+	__atomic_store_n(&link->tag, value.tag, __ATOMIC_RELAXED);
+	__atomic_store_n(&link->node, value.node, __ATOMIC_RELAXED);
+}
+
+static bool zk_lf_queue_link_cas(struct zk_lf_queue_link *const link,
+                                 struct zk_lf_queue_link *const expected,
+                                 struct zk_lf_queue_link desired)
+{
+	return __atomic_compare_exchange(link, expected, &desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+static bool zk_lf_queue_link_equal(struct zk_lf_queue_link const a, struct zk_lf_queue_link const b)
+{
+	return a.node == b.node && a.tag == b.tag;
+}
+
+// every write to a link increments its counter, so a stale CAS on the link of a released node always fails
+static void zk_lf_queue_release_node(zk_lf_queue *const queue, struct zk_lf_queue_node *const node)
+{
+	struct zk_lf_queue_link next = zk_lf_queue_link_load(&node->next);
+	struct zk_lf_queue_link old = zk_lf_queue_link_load(&queue->free);
+	struct zk_lf_queue_link new;
+	do {
+		next.node = old.node;
+		next.tag++;
+		zk_lf_queue_link_store(&node->next, next);
+		new.node = node;
+		new.tag = old.tag + 1;
+	} while (!zk_lf_queue_link_cas(&queue->free, &old, new));
+}
+
+static struct zk_lf_queue_node *zk_lf_queue_acquire_node(zk_lf_queue *const queue, void *const data)
+{
+	struct zk_lf_queue_link old = zk_lf_queue_link_load(&queue->free);
+	struct zk_lf_queue_link new;
+	struct zk_lf_queue_node *node = NULL;
+	do {
+		if (old.node == NULL)
+			break;
+		new.node = zk_lf_queue_link_load(&old.node->next).node;
+		new.tag = old.tag + 1;
+	} while (!zk_lf_queue_link_cas(&queue->free, &old, new));
+	node = old.node;
+
+	if (node == NULL) {
+		node = aligned_alloc(_Alignof(struct zk_lf_queue_node), sizeof(struct zk_lf_queue_node));
+		if (node == NULL)
+			return NULL;
+		node->next = (struct zk_lf_queue_link){ NULL, 0 };
+	} else {
+		// keep counting from the previous life of the node
+		struct zk_lf_queue_link next = zk_lf_queue_link_load(&node->next);
+		next.node = NULL;
+		next.tag++;
+		zk_lf_queue_link_store(&node->next, next);
+	}
+	// a stale pop may still read the data of a reused node, its CAS then fails and the value is discarded
+	__atomic_store_n(&node->data, data, __ATOMIC_RELAXED);
+	return node;
+}
+
+static void zk_lf_queue_free_chain(struct zk_lf_queue_node *node, zk_destructor_t const func, bool const dummy)
+{
+	bool skip = dummy;
+	while (node != NULL) {
+		struct zk_lf_queue_node *next = zk_lf_queue_link_load(&node->next).node;
+		if (func != NULL && !skip)
+			func(node->data);
+		skip = false;
+		free(node);
+		node = next;
+	}
+}
+
+// Constructor
+
+/**
+ * @brief Creates an empty lock-free queue.
+ *
+ * @param queue_p Pointer to the queue to create.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if `queue_p` is NULL or ZK_ERROR_ALLOC on allocation failure.
+ */
+zk_status zk_lf_queue_new(zk_lf_queue **queue_p)
+{
+	if (queue_p == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	zk_lf_queue *queue = aligned_alloc(ZK_CACHE_LINE, sizeof(zk_lf_queue));
+	if (queue == NULL)
+		return ZK_ERROR_ALLOC;
+
+	queue->free = (struct zk_lf_queue_link){ NULL, 0 };
+	struct zk_lf_queue_node *dummy = zk_lf_queue_acquire_node(queue, NULL);
+	if (dummy == NULL) {
+		free(queue);
+		return ZK_ERROR_ALLOC;
+	}
+	queue->head = (struct zk_lf_queue_link){ dummy, 0 };
+	queue->tail = (struct zk_lf_queue_link){ dummy, 0 };
+
+	*queue_p = queue;
+	return ZK_OK;
+}
+
+// Destructor
+
+/**
+ * @brief Frees the queue and its nodes. Must not run concurrently with other operations.
+ *
+ * @param queue_p Pointer to the queue. It is set to NULL after the queue is freed.
+ * @param func Pointer to the destructor applied to the data left in the queue. If NULL, the data is not freed.
+ */
+void zk_lf_queue_free(zk_lf_queue **queue_p, zk_destructor_t const func)
+{
+	if (queue_p != NULL && *queue_p != NULL) {
+		zk_lf_queue *queue = *queue_p;
+		zk_lf_queue_free_chain(zk_lf_queue_link_load(&queue->head).node, func, true);
+		zk_lf_queue_free_chain(zk_lf_queue_link_load(&queue->free).node, NULL, false);
+		free(queue);
+		*queue_p = NULL;
+	}
+}
+
+// Modifiers
+
+/**
+ * @brief Removes the element at the front of the queue.
+ *
+ * @param queue The queue.
+ * @param data_p Set to the data of the removed element.
+ *
+ * @return true if an element was removed, false if the queue was empty or arguments are invalid.
+ *
+ * @note Lock-free: a thread only retries when another one completed an operation.
+ */
+bool zk_lf_queue_pop(zk_lf_queue *const queue, void **const data_p)
+{
+	if (queue == NULL || data_p == NULL)
+		return false;
+
+	struct zk_lf_queue_link head;
+	void *data;
+	for (;;) {
+		head = zk_lf_queue_link_load(&queue->head);
+		struct zk_lf_queue_link tail = zk_lf_queue_link_load(&queue->tail);
+		struct zk_lf_queue_link next = zk_lf_queue_link_load(&head.node->next);
+		if (!zk_lf_queue_link_equal(head, zk_lf_queue_link_load(&queue->head)))
+			continue;
+
+		if (head.node == tail.node) {
+			if (next.node == NULL)
+				return false;
+			// the tail lags behind a push in progress, help it forward
+			zk_lf_queue_link_cas(&queue->tail, &tail, (struct zk_lf_queue_link){ next.node, tail.tag + 1 });
+		} else {
+			// read before the CAS: once the head moves another pop may release the node
+			data = __atomic_load_n(&next.node->data, __ATOMIC_RELAXED);
+			if (zk_lf_queue_link_cas(&queue->head, &head, (struct zk_lf_queue_link){ next.node, head.tag + 1 }))
+				break;
+		}
+	}
+
+	*data_p = data;
+	zk_lf_queue_release_node(queue, head.node);
+	return true;
+}
+
+/**
+ * @brief Adds `data` at the back of the queue.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if `queue` is NULL or ZK_ERROR_ALLOC on allocation failure.
+ *
+ * @note Lock-free: a thread only retries when another one completed an operation.
+ */
+zk_status zk_lf_queue_push(zk_lf_queue *const queue, void *const data)
+{
+	if (queue == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	struct zk_lf_queue_node *node = zk_lf_queue_acquire_node(queue, data);
+	if (node == NULL)
+		return ZK_ERROR_ALLOC;
+
+	struct zk_lf_queue_link tail;
+	for (;;) {
+		tail = zk_lf_queue_link_load(&queue->tail);
+		struct zk_lf_queue_link next = zk_lf_queue_link_load(&tail.node->next);
+		if (!zk_lf_queue_link_equal(tail, zk_lf_queue_link_load(&queue->tail)))
+			continue;
+
+		if (next.node == NULL) {
+			if (zk_lf_queue_link_cas(&tail.node->next, &next, (struct zk_lf_queue_link){ node, next.tag + 1 }))
+				break;
+		} else {
+			// the tail lags behind another push, help it forward
+			zk_lf_queue_link_cas(&queue->tail, &tail, (struct zk_lf_queue_link){ next.node, tail.tag + 1 });
+		}
+	}
+	zk_lf_queue_link_cas(&queue->tail, &tail, (struct zk_lf_queue_link){ node, tail.tag + 1 });
+	return ZK_OK;
+}
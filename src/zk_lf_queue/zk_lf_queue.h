@@ -0,0 +1,23 @@
+#ifndef ZK_LF_QUEUE_H
+#define ZK_LF_QUEUE_H
+
+#include "zk_common/zk_common.h"
+
+/**
+ * @brief Lock-free multi-producer multi-consumer FIFO queue (Michael-Scott queue), safe to share between threads
+ *        without a mutex.
+ */
+typedef struct zk_lf_queue zk_lf_queue;
+
+// Constructor
+zk_status zk_lf_queue_new(zk_lf_queue **queue_p);
+
+// Destructor
+void zk_lf_queue_free(zk_lf_queue **queue_p, zk_destructor_t const func);
+
+// Modifiers
+bool zk_lf_queue_pop(zk_lf_queue *const queue, void **const data_p);
+
+zk_status zk_lf_queue_push(zk_lf_queue *const queue, void *const data);
+
+#endif
@@ -0,0 +1,238 @@
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "zk_lf_stack/zk_lf_stack.h"
+
+/*
+ * ABA protection: the head is a pointer and a counter updated together by a double width compare and swap, so a head
+ * popped and pushed back between a load and a CAS is detected by the changed counter.
+ *
+ * Nodes are type stable: popped nodes are kept on a free list, itself a Treiber stack, and reused by later pushes
+ * instead of being returned to malloc. A thread preempted in pop() between loading the head and reading its `next`
+ * field therefore always reads a valid node, and its CAS fails if that node was popped in the meantime. Nodes are
+ * freed by zk_lf_stack_free() once no thread uses the stack any more.
+ *
+ * A head is only read to decide what to CAS, and the CAS compares both halves again, so loads read the pointer and the
+ * counter with two single word atomic loads instead of a double width one. A torn value makes the CAS fail.
+ *
+ * The `next` field of a node can be read by such a stale pop while its new owner writes it, so it is accessed with
+ * relaxed atomic builtins.
+ */
+
+/**
+ * @brief Tagged head of a Treiber stack.
+ */
+struct zk_lf_stack_head {
+	// double width compare and swap requires the pair to be aligned on its size
+	_Alignas(2 * sizeof(void *)) zk_slist *node;
+	uintptr_t tag;
+};
+
+/**
+ * @brief Lock-free stack. The two heads are written by every thread, each gets its own cache line.
+ */
+struct zk_lf_stack {
+	_Alignas(ZK_CACHE_LINE) struct zk_lf_stack_head head;
+	_Alignas(ZK_CACHE_LINE) struct zk_lf_stack_head free;
+};
+
+// Private functions
+static struct zk_lf_stack_head zk_lf_stack_head_load(struct zk_lf_stack_head *const head)
+{
+	struct zk_lf_stack_head value;
+	value.tag = __atomic_load_n(&head->tag, __ATOMIC_ACQUIRE);
+	value.node = __atomic_load_n(&head->node, __ATOMIC_ACQUIRE);
+	return value;
+}
+
+static bool zk_lf_stack_head_cas(struct zk_lf_stack_head *const head,
+                                 struct zk_lf_stack_head *const expected,
+                                 struct zk_lf_stack_head desired)
+{
+	return __atomic_compare_exchange(head, expected, &desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+static zk_slist *zk_lf_stack_node_next(const zk_slist *const node)
+{
+	return __atomic_load_n(&node->next, __ATOMIC_RELAXED);
+}
+
+static void zk_lf_stack_node_set_next(zk_slist *const node, zk_slist *const next)
+{
+	__atomic_store_n(&node->next, next, __ATOMIC_RELAXED);
+}
+
+// pushes the chain first..last on `head` with a single CAS
+static void zk_lf_stack_head_push(struct zk_lf_stack_head *const head, zk_slist *first, zk_slist *last)
+{
+	struct zk_lf_stack_head old = zk_lf_stack_head_load(head);
+	struct zk_lf_stack_head new;
+	do {
+		zk_lf_stack_node_set_next(last, old.node);
+		new.node = first;
+		new.tag = old.tag + 1;
+	} while (!zk_lf_stack_head_cas(head, &old, new));
+}
+
+static zk_slist *zk_lf_stack_head_pop(struct zk_lf_stack_head *const head)
+{
+	struct zk_lf_stack_head old = zk_lf_stack_head_load(head);
+	struct zk_lf_stack_head new;
+	do {
+		if (old.node == NULL)
+			return NULL;
+		new.node = zk_lf_stack_node_next(old.node);
+		new.tag = old.tag + 1;
+	} while (!zk_lf_stack_head_cas(head, &old, new));
+	return old.node;
+}
+
+static void zk_lf_stack_free_chain(zk_slist *node, zk_destructor_t const func)
+{
+	while (node != NULL) {
+		zk_slist *next = node->next;
+		if (func != NULL)
+			func(node->data);
+		free(node);
+		node = next;
+	}
+}
+
+// Constructor
+
+/**
+ * @brief Creates an empty lock-free stack.
+ *
+ * @param stack_p Pointer to the stack to create.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if `stack_p` is NULL or ZK_ERROR_ALLOC on allocation failure.
+ */
+zk_status zk_lf_stack_new(zk_lf_stack **stack_p)
+{
+	if (stack_p == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	zk_lf_stack *stack = aligned_alloc(ZK_CACHE_LINE, sizeof(zk_lf_stack));
+	if (stack == NULL)
+		return ZK_ERROR_ALLOC;
+
+	stack->head = (struct zk_lf_stack_head){ NULL, 0 };
+	stack->free = (struct zk_lf_stack_head){ NULL, 0 };
+
+	*stack_p = stack;
+	return ZK_OK;
+}
+
+// Destructor
+
+/**
+ * @brief Frees the stack, its nodes and the nodes kept for reuse. Must not run concurrently with other operations.
+ *
+ * @param stack_p Pointer to the stack. It is set to NULL after the stack is freed.
+ * @param func Pointer to the destructor applied to the data left in the stack. If NULL, the data is not freed.
+ */
+void zk_lf_stack_free(zk_lf_stack **stack_p, zk_destructor_t const func)
+{
+	if (stack_p != NULL && *stack_p != NULL) {
+		zk_lf_stack *stack = *stack_p;
+		zk_lf_stack_free_chain(zk_lf_stack_head_load(&stack->head).node, func);
+		zk_lf_stack_free_chain(zk_lf_stack_head_load(&stack->free).node, NULL);
+		free(stack);
+		*stack_p = NULL;
+	}
+}
+
+// Modifiers
+
+/**
+ * @brief Pops the element on top of the stack.
+ *
+ * @param stack The stack.
+ * @param data_p Set to the data of the popped element.
+ *
+ * @return true if an element was popped, false if the stack was empty or arguments are invalid.
+ *
+ * @note Lock-free: a thread only retries when another one completed an operation.
+ */
+bool zk_lf_stack_pop(zk_lf_stack *const stack, void **const data_p)
+{
+	if (stack == NULL || data_p == NULL)
+		return false;
+
+	zk_slist *node = zk_lf_stack_head_pop(&stack->head);
+	if (node == NULL)
+		return false;
+
+	*data_p = node->data;
+	zk_lf_stack_head_push(&stack->free, node, node);
+	return true;
+}
+
+/**
+ * @brief Detaches every element of the stack with a single atomic exchange.
+ *
+ * @return The detached elements as a zk_slist, top of the stack first, or NULL if the stack was empty.
+ *
+ * @note A pop running concurrently may still read the returned nodes until it retries. Hand them back with
+ *       zk_lf_stack_recycle() once done with them, free them with zk_slist_free() only when no other thread uses the
+ *       stack.
+ */
+zk_slist *zk_lf_stack_pop_all(zk_lf_stack *const stack)
+{
+	if (stack == NULL)
+		return NULL;
+
+	struct zk_lf_stack_head old = zk_lf_stack_head_load(&stack->head);
+	struct zk_lf_stack_head const empty = { NULL, 0 };
+	struct zk_lf_stack_head new;
+	do {
+		if (old.node == NULL)
+			return NULL;
+		new = empty;
+		new.tag = old.tag + 1;
+	} while (!zk_lf_stack_head_cas(&stack->head, &old, new));
+	return old.node;
+}
+
+/**
+ * @brief Pushes `data` on top of the stack. The node is taken from the ones freed by previous pops when there is one.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if `stack` is NULL or ZK_ERROR_ALLOC on allocation failure.
+ *
+ * @note Lock-free: a thread only retries when another one completed an operation.
+ */
+zk_status zk_lf_stack_push(zk_lf_stack *const stack, void *const data)
+{
+	if (stack == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	zk_slist *node = zk_lf_stack_head_pop(&stack->free);
+	if (node == NULL) {
+		node = zk_slist_new_node(data);
+		if (node == NULL)
+			return ZK_ERROR_ALLOC;
+	} else {
+		node->data = data;
+	}
+
+	zk_lf_stack_head_push(&stack->head, node, node);
+	return ZK_OK;
+}
+
+/**
+ * @brief Gives the nodes of a list returned by zk_lf_stack_pop_all() back to the stack for reuse. Their data is not
+ *        freed.
+ *
+ * @param stack The stack.
+ * @param list_p Pointer to the list. It is set to NULL.
+ */
+void zk_lf_stack_recycle(zk_lf_stack *const stack, zk_slist **list_p)
+{
+	if (stack != NULL && list_p != NULL && *list_p != NULL) {
+		zk_slist *last = *list_p;
+		while (zk_lf_stack_node_next(last) != NULL)
+			last = zk_lf_stack_node_next(last);
+		zk_lf_stack_head_push(&stack->free, *list_p, last);
+		*list_p = NULL;
+	}
+}
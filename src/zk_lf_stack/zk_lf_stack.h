@@ -0,0 +1,27 @@
+#ifndef ZK_LF_STACK_H
+#define ZK_LF_STACK_H
+
+#include "zk_common/zk_common.h"
+#include "zk_slist/zk_slist.h"
+
+/**
+ * @brief Lock-free LIFO stack (Treiber stack) of zk_slist nodes, safe to share between threads without a mutex.
+ */
+typedef struct zk_lf_stack zk_lf_stack;
+
+// Constructor
+zk_status zk_lf_stack_new(zk_lf_stack **stack_p);
+
+// Destructor
+void zk_lf_stack_free(zk_lf_stack **stack_p, zk_destructor_t const func);
+
+// Modifiers
+bool zk_lf_stack_pop(zk_lf_stack *const stack, void **const data_p);
+
+zk_slist *zk_lf_stack_pop_all(zk_lf_stack *const stack);
+
+zk_status zk_lf_stack_push(zk_lf_stack *const stack, void *const data);
+
+void zk_lf_stack_recycle(zk_lf_stack *const stack, zk_slist **list_p);
+
+#endif
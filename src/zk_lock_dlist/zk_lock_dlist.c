@@ -0,0 +1,294 @@
+#include <sched.h>
+#include <stdlib.h>
+
+#include "zk_ebr/zk_ebr.h"
+#include "zk_lock_dlist/zk_lock_dlist.h"
+
+/*
+ * Lazy list synchronization: traversals take no lock. An update locks the nodes it changes, the predecessor for an
+ * insertion and the predecessor and the node for a removal, then checks that they are still linked and not removed
+ * before writing. Locks are always taken in list order, so two updates cannot deadlock.
+ *
+ * A removed node is first marked, then unlinked. Lookups skip marked nodes, which makes the mark the point where the
+ * removal takes effect. The `prev` field of a node is only written by the owner of its predecessor's lock, so a removal
+ * updates its successor's back link without locking it.
+ *
+ * When the check fails the operation restarts from the predecessor, or from the first node before it that is still
+ * in the list, found through the back links, instead of from the head of the list.
+ *
+ * Every operation runs inside an epoch critical section. Lock-free traversals may still stand on a removed node, so
+ * removed nodes and their data are retired through zk_ebr and freed once no traversal can reach them.
+ */
+
+/**
+ * @brief List node. `next`, `prev` and `marked` are read without the lock and written with atomic builtins.
+ */
+struct zk_lock_dlist_node {
+	void *data;
+	struct zk_lock_dlist_node *next;
+	struct zk_lock_dlist_node *prev;
+	zk_destructor_t destructor;
+	zk_ebr_node ebr;
+	bool marked;
+	bool lock;
+};
+
+/**
+ * @brief Concurrent list. `head` and `tail` are sentinels that are never removed, so every update has a predecessor.
+ */
+struct zk_lock_dlist {
+	struct zk_lock_dlist_node head;
+	struct zk_lock_dlist_node tail;
+	zk_compare_func compare;
+	size_t size;
+};
+
+// Private functions
+static void zk_lock_dlist_lock(struct zk_lock_dlist_node *const node)
+{
+	while (__atomic_test_and_set(&node->lock, __ATOMIC_ACQUIRE))
+		sched_yield();
+}
+
+static void zk_lock_dlist_unlock(struct zk_lock_dlist_node *const node)
+{
+	__atomic_clear(&node->lock, __ATOMIC_RELEASE);
+}
+
+static struct zk_lock_dlist_node *zk_lock_dlist_next(const struct zk_lock_dlist_node *const node)
+{
+	return __atomic_load_n(&node->next, __ATOMIC_ACQUIRE);
+}
+
+static bool zk_lock_dlist_marked(const struct zk_lock_dlist_node *const node)
+{
+	return __atomic_load_n(&node->marked, __ATOMIC_ACQUIRE);
+}
+
+// Finds pred and curr such that pred < data <= curr, starting from `start`, which must be before data.
+static struct zk_lock_dlist_node *zk_lock_dlist_locate(const zk_lock_dlist *const list,
+                                                       const void *const data,
+                                                       struct zk_lock_dlist_node *pred,
+                                                       struct zk_lock_dlist_node **curr_p)
+{
+	struct zk_lock_dlist_node *curr = zk_lock_dlist_next(pred);
+	while (curr != &list->tail && list->compare(curr->data, data) < 0) {
+		pred = curr;
+		curr = zk_lock_dlist_next(curr);
+	}
+	*curr_p = curr;
+	return pred;
+}
+
+// Walks back from a node that failed validation to the closest node still in the list. Its data is smaller than the
+// data of `node`, so it is a valid starting point for zk_lock_dlist_locate().
+static struct zk_lock_dlist_node *zk_lock_dlist_restart(struct zk_lock_dlist_node *node)
+{
+	while (zk_lock_dlist_marked(node))
+		node = __atomic_load_n(&node->prev, __ATOMIC_ACQUIRE);
+	return node;
+}
+
+static void zk_lock_dlist_node_free(void *ebr)
+{
+	struct zk_lock_dlist_node *node = ZK_EBR_ENTRY(ebr, struct zk_lock_dlist_node, ebr);
+	if (node->destructor != NULL)
+		node->destructor(node->data);
+	free(node);
+}
+
+// Constructor
+
+/**
+ * @brief Creates an empty list kept sorted in ascending order of `func`.
+ *
+ * @param list_p Pointer to the list to create.
+ * @param func Pointer to the function comparing two data.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if arguments are invalid or ZK_ERROR_ALLOC on allocation failure.
+ */
+zk_status zk_lock_dlist_new(zk_lock_dlist **list_p, zk_compare_func const func)
+{
+	if (list_p == NULL || func == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	zk_lock_dlist *list = calloc(1, sizeof(zk_lock_dlist));
+	if (list == NULL)
+		return ZK_ERROR_ALLOC;
+
+	list->head.next = &list->tail;
+	list->tail.prev = &list->head;
+	list->compare = func;
+
+	*list_p = list;
+	return ZK_OK;
+}
+
+// Destructor
+
+/**
+ * @brief Frees the list and its data. Must not run concurrently with other operations on the list. Also waits for the
+ *        nodes removed by the calling thread to be reclaimed, see zk_ebr_barrier().
+ *
+ * @param list_p Pointer to the list. It is set to NULL after the list is freed.
+ * @param func Pointer to the destructor applied to the data still in the list. If NULL, the data is not freed. Removed
+ *             data is freed with the destructor given to zk_lock_dlist_remove().
+ */
+void zk_lock_dlist_free(zk_lock_dlist **list_p, zk_destructor_t const func)
+{
+	if (list_p == NULL || *list_p == NULL)
+		return;
+
+	zk_lock_dlist *list = *list_p;
+	struct zk_lock_dlist_node *node = list->head.next;
+	while (node != &list->tail) {
+		struct zk_lock_dlist_node *next = node->next;
+		if (func != NULL)
+			func(node->data);
+		free(node);
+		node = next;
+	}
+
+	free(list);
+	*list_p = NULL;
+	zk_ebr_barrier();
+}
+
+// Capacity
+
+/**
+ * @brief Returns the number of elements in the list. While other threads update the list the value may be stale by
+ *        the time it is used.
+ */
+size_t zk_lock_dlist_size(const zk_lock_dlist *const list)
+{
+	return list != NULL ? __atomic_load_n(&list->size, __ATOMIC_RELAXED) : 0;
+}
+
+// Lookup
+
+/**
+ * @brief Tests whether the list holds an element equal to `data`. Takes no lock.
+ *
+ * @note Time complexity: O(n).
+ */
+bool zk_lock_dlist_contains(const zk_lock_dlist *const list, const void *const data)
+{
+	if (list == NULL)
+		return false;
+
+	bool found = false;
+	struct zk_lock_dlist_node *curr;
+	zk_ebr_enter();
+	zk_lock_dlist_locate(list, data, (struct zk_lock_dlist_node *)&list->head, &curr);
+	for (; !found && curr != &list->tail && list->compare(curr->data, data) == 0; curr = zk_lock_dlist_next(curr))
+		found = !zk_lock_dlist_marked(curr);
+	zk_ebr_exit();
+	return found;
+}
+
+/**
+ * @brief Calls `func` on the data of each element, in order. Takes no lock: elements inserted or removed during the
+ *        traversal may or may not be visited.
+ */
+void zk_lock_dlist_for_each(const zk_lock_dlist *const list, zk_for_each_func const func, void *const user_data)
+{
+	if (list == NULL || func == NULL)
+		return;
+
+	zk_ebr_enter();
+	for (struct zk_lock_dlist_node *node = zk_lock_dlist_next(&list->head); node != &list->tail;
+	     node = zk_lock_dlist_next(node)) {
+		if (!zk_lock_dlist_marked(node))
+			func(node->data, user_data);
+	}
+	zk_ebr_exit();
+}
+
+// Modifiers
+
+/**
+ * @brief Inserts `data` before the first element greater than or equal to it. Locks the predecessor only.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if `list` is NULL or ZK_ERROR_ALLOC on allocation failure.
+ *
+ * @note Time complexity: O(n).
+ */
+zk_status zk_lock_dlist_insert(zk_lock_dlist *const list, void *const data)
+{
+	if (list == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	struct zk_lock_dlist_node *node = calloc(1, sizeof(struct zk_lock_dlist_node));
+	if (node == NULL)
+		return ZK_ERROR_ALLOC;
+	node->data = data;
+
+	zk_ebr_enter();
+	struct zk_lock_dlist_node *pred = &list->head;
+	for (;;) {
+		struct zk_lock_dlist_node *curr;
+		pred = zk_lock_dlist_locate(list, data, pred, &curr);
+		zk_lock_dlist_lock(pred);
+		if (!pred->marked && pred->next == curr) {
+			node->next = curr;
+			node->prev = pred;
+			__atomic_store_n(&curr->prev, node, __ATOMIC_RELEASE);
+			__atomic_store_n(&pred->next, node, __ATOMIC_RELEASE);
+			zk_lock_dlist_unlock(pred);
+			zk_ebr_exit();
+			__atomic_fetch_add(&list->size, 1, __ATOMIC_RELAXED);
+			return ZK_OK;
+		}
+		zk_lock_dlist_unlock(pred);
+		pred = zk_lock_dlist_restart(pred);
+	}
+}
+
+/**
+ * @brief Removes the first element equal to `data`. Locks the element and its predecessor.
+ *
+ * @param list The list.
+ * @param data Data to compare the elements with.
+ * @param func Pointer to the destructor applied to the removed data once no thread can read it. If NULL, the data is
+ *             not freed.
+ *
+ * @return true if an element was removed, false otherwise.
+ *
+ * @note Time complexity: O(n).
+ */
+bool zk_lock_dlist_remove(zk_lock_dlist *const list, const void *const data, zk_destructor_t const func)
+{
+	if (list == NULL)
+		return false;
+
+	zk_ebr_enter();
+	struct zk_lock_dlist_node *pred = &list->head;
+	for (;;) {
+		struct zk_lock_dlist_node *curr;
+		pred = zk_lock_dlist_locate(list, data, pred, &curr);
+		if (curr == &list->tail || list->compare(curr->data, data) != 0) {
+			zk_ebr_exit();
+			return false;
+		}
+
+		zk_lock_dlist_lock(pred);
+		zk_lock_dlist_lock(curr);
+		if (!pred->marked && !curr->marked && pred->next == curr) {
+			struct zk_lock_dlist_node *succ = curr->next;
+			__atomic_store_n(&curr->marked, true, __ATOMIC_RELEASE);
+			__atomic_store_n(&succ->prev, pred, __ATOMIC_RELEASE);
+			__atomic_store_n(&pred->next, succ, __ATOMIC_RELEASE);
+			zk_lock_dlist_unlock(curr);
+			zk_lock_dlist_unlock(pred);
+			zk_ebr_exit();
+			__atomic_fetch_sub(&list->size, 1, __ATOMIC_RELAXED);
+			curr->destructor = func;
+			zk_ebr_retire(&curr->ebr, zk_lock_dlist_node_free);
+			return true;
+		}
+		zk_lock_dlist_unlock(curr);
+		zk_lock_dlist_unlock(pred);
+		pred = zk_lock_dlist_restart(pred);
+	}
+}
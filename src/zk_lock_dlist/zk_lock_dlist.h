@@ -0,0 +1,33 @@
+#ifndef ZK_LOCK_DLIST_H
+#define ZK_LOCK_DLIST_H
+
+#include <stddef.h>
+
+#include "zk_common/zk_common.h"
+
+/**
+ * @brief Sorted doubly linked list safe to share between threads. Every node has its own lock, so insertions and
+ *        removals in disjoint regions of the list proceed in parallel, and lookups take no lock at all.
+ */
+typedef struct zk_lock_dlist zk_lock_dlist;
+
+// Constructor
+zk_status zk_lock_dlist_new(zk_lock_dlist **list_p, zk_compare_func const func);
+
+// Destructor
+void zk_lock_dlist_free(zk_lock_dlist **list_p, zk_destructor_t const func);
+
+// Capacity
+size_t zk_lock_dlist_size(const zk_lock_dlist *const list);
+
+// Lookup
+bool zk_lock_dlist_contains(const zk_lock_dlist *const list, const void *const data);
+
+void zk_lock_dlist_for_each(const zk_lock_dlist *const list, zk_for_each_func const func, void *const user_data);
+
+// Modifiers
+zk_status zk_lock_dlist_insert(zk_lock_dlist *const list, void *const data);
+
+bool zk_lock_dlist_remove(zk_lock_dlist *const list, const void *const data, zk_destructor_t const func);
+
+#endif
@@ -0,0 +1,166 @@
+#include <stdlib.h>
+
+#include "zk_mpsc_queue/zk_mpsc_queue.h"
+
+/*
+ * Producers swap themselves in as the new head with one atomic exchange, then link the previous head to their node.
+ * There is no loop, so a push completes in a bounded number of steps whatever the other threads do. The consumer
+ * walks the links from the tail, it only needs an atomic read-modify-write when it takes the last node: the stub node
+ * is pushed back so that the queue never becomes empty of nodes. A batch drain therefore costs one atomic exchange.
+ *
+ * Between a producer's exchange and its link the chain is broken: the consumer sees the queue as empty up to that node
+ * and picks the rest up on its next call.
+ */
+
+/**
+ * @brief MPSC queue. The head is written by producers, the tail by the consumer, each gets its own cache line.
+ */
+struct zk_mpsc_queue {
+	_Alignas(ZK_CACHE_LINE) zk_mpsc_node *head;
+	_Alignas(ZK_CACHE_LINE) zk_mpsc_node *tail;
+	zk_mpsc_node stub;
+};
+
+// Private functions
+static zk_mpsc_node *zk_mpsc_queue_node_next(zk_mpsc_node *const node)
+{
+	return __atomic_load_n(&node->next, __ATOMIC_ACQUIRE);
+}
+
+// Constructor
+
+/**
+ * @brief Creates an empty MPSC queue.
+ *
+ * @param queue_p Pointer to the queue to create.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if `queue_p` is NULL or ZK_ERROR_ALLOC on allocation failure.
+ */
+zk_status zk_mpsc_queue_new(zk_mpsc_queue **queue_p)
+{
+	if (queue_p == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	zk_mpsc_queue *queue = aligned_alloc(ZK_CACHE_LINE, sizeof(zk_mpsc_queue));
+	if (queue == NULL)
+		return ZK_ERROR_ALLOC;
+
+	queue->stub.next = NULL;
+	queue->head = &queue->stub;
+	queue->tail = &queue->stub;
+
+	*queue_p = queue;
+	return ZK_OK;
+}
+
+// Destructor
+
+/**
+ * @brief Frees the queue. Must not run concurrently with pushes.
+ *
+ * @param queue_p Pointer to the queue. It is set to NULL after the queue is freed.
+ * @param func Pointer to the destructor applied to the nodes left in the queue, it receives the zk_mpsc_node. If NULL,
+ *        the nodes are not freed.
+ */
+void zk_mpsc_queue_free(zk_mpsc_queue **queue_p, zk_destructor_t const func)
+{
+	if (queue_p != NULL && *queue_p != NULL) {
+		zk_mpsc_node *node;
+		while ((node = zk_mpsc_queue_pop(*queue_p)) != NULL) {
+			if (func != NULL)
+				func(node);
+		}
+		free(*queue_p);
+		*queue_p = NULL;
+	}
+}
+
+// Modifiers
+
+/**
+ * @brief Pops the nodes queued when the call starts and applies `func` to each, in FIFO order. Nodes pushed during the
+ *        drain, including by `func`, are left for the next call, so producers cannot keep it running. `func` receives
+ *        the zk_mpsc_node and may free its element.
+ *
+ * @return The number of nodes drained.
+ *
+ * @note Consumer side: at most one thread at a time.
+ * @note Time complexity: O(k) for k nodes drained, with a single atomic exchange.
+ */
+size_t zk_mpsc_queue_drain(zk_mpsc_queue *const queue, zk_for_each_func const func, void *const user_data)
+{
+	size_t count = 0;
+	if (queue != NULL && func != NULL) {
+		// the batch ends at the head seen on entry
+		zk_mpsc_node *const last = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+		bool done = false;
+		while (!done) {
+			// a stub head ends the batch once the consumer reaches the stub
+			if (last == &queue->stub && queue->tail == &queue->stub)
+				break;
+
+			zk_mpsc_node *node = zk_mpsc_queue_pop(queue);
+			if (node == NULL)
+				break;
+
+			done = node == last;
+			func(node, user_data);
+			count++;
+		}
+	}
+	return count;
+}
+
+/**
+ * @brief Removes the node at the front of the queue.
+ *
+ * @return The node removed, or NULL if the queue is empty or a producer is still linking the front node.
+ *
+ * @note Consumer side: at most one thread at a time.
+ */
+zk_mpsc_node *zk_mpsc_queue_pop(zk_mpsc_queue *const queue)
+{
+	if (queue == NULL)
+		return NULL;
+
+	zk_mpsc_node *tail = queue->tail;
+	zk_mpsc_node *next = zk_mpsc_queue_node_next(tail);
+	if (tail == &queue->stub) {
+		if (next == NULL)
+			return NULL;
+		queue->tail = next;
+		tail = next;
+		next = zk_mpsc_queue_node_next(next);
+	}
+
+	if (next != NULL) {
+		queue->tail = next;
+		return tail;
+	}
+
+	// tail is the last linked node: it can only be taken once the stub is queued behind it
+	if (tail != __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE))
+		return NULL;
+	zk_mpsc_queue_push(queue, &queue->stub);
+
+	next = zk_mpsc_queue_node_next(tail);
+	if (next != NULL) {
+		queue->tail = next;
+		return tail;
+	}
+	return NULL;
+}
+
+/**
+ * @brief Adds `node` at the back of the queue. The node must stay valid until it is popped.
+ *
+ * @note Wait-free: one atomic exchange and one store, from any number of threads.
+ */
+void zk_mpsc_queue_push(zk_mpsc_queue *const queue, zk_mpsc_node *const node)
+{
+	if (queue != NULL && node != NULL) {
+		__atomic_store_n(&node->next, NULL, __ATOMIC_RELAXED);
+		zk_mpsc_node *prev = __atomic_exchange_n(&queue->head, node, __ATOMIC_ACQ_REL);
+		__atomic_store_n(&prev->next, node, __ATOMIC_RELEASE);
+	}
+}
@@ -0,0 +1,41 @@
+#ifndef ZK_MPSC_QUEUE_H
+#define ZK_MPSC_QUEUE_H
+
+#include <stddef.h>
+
+#include "zk_common/zk_common.h"
+
+/**
+ * @brief Link embedded in the elements of a zk_mpsc_queue. The queue never allocates: an element is queued by pushing
+ *        the node it embeds and retrieved with ZK_MPSC_ENTRY().
+ */
+struct zk_mpsc_node {
+	struct zk_mpsc_node *next;
+};
+typedef struct zk_mpsc_node zk_mpsc_node;
+
+/**
+ * @brief Returns the element of type TYPE whose member MEMBER is the zk_mpsc_node NODE.
+ */
+#define ZK_MPSC_ENTRY(NODE, TYPE, MEMBER) ((TYPE *)(void *)((char *)(NODE) - offsetof(TYPE, MEMBER)))
+
+/**
+ * @brief Intrusive multi-producer single-consumer FIFO queue (Vyukov queue). Any thread may push, only one thread at a
+ *        time may pop, drain or free.
+ */
+typedef struct zk_mpsc_queue zk_mpsc_queue;
+
+// Constructor
+zk_status zk_mpsc_queue_new(zk_mpsc_queue **queue_p);
+
+// Destructor
+void zk_mpsc_queue_free(zk_mpsc_queue **queue_p, zk_destructor_t const func);
+
+// Modifiers
+size_t zk_mpsc_queue_drain(zk_mpsc_queue *const queue, zk_for_each_func const func, void *const user_data);
+
+zk_mpsc_node *zk_mpsc_queue_pop(zk_mpsc_queue *const queue);
+
+void zk_mpsc_queue_push(zk_mpsc_queue *const queue, zk_mpsc_node *const node);
+
+#endif
@@ -0,0 +1,319 @@
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "zk_node_cache/zk_node_cache.h"
+
+/*
+ * Free list nodes in two tiers, after the per-CPU caches of tcmalloc:
+ *
+ * - every thread keeps a magazine of free nodes per size class, used without any synchronization. An allocation takes
+ *   the last node freed, which is also the most likely to be in cache;
+ * - a shared depot per size class exchanges whole batches of ZK_BATCH_SIZE nodes with the magazines, under a mutex
+ *   taken once per batch. A magazine holds up to two batches, so a thread alternating allocations and frees around a
+ *   batch boundary does not bounce between the depot and its magazine.
+ *
+ * Nodes are allocated one by one with malloc() and the cache never splits or merges them, so a node allocated by the
+ * cache may still be released with free() and the other way around. A batch is chained through the nodes themselves:
+ * the first word links the nodes of the batch, the second word of its first node links the batches of the depot.
+ *
+ * zk_node_cache_reserve() sets nodes aside in a per thread reserve, used once the magazine is empty and before the
+ * depot, so that a latency sensitive thread can allocate them later without taking a lock or calling malloc().
+ */
+
+#define ZK_NODE_CACHE_MIN_SIZE (2 * sizeof(void *))
+#define ZK_NODE_CACHE_CLASSES  ((ZK_NODE_CACHE_MAX_SIZE - ZK_NODE_CACHE_MIN_SIZE) / 8 + 1)
+#define ZK_NODE_CACHE_MAGAZINE (2 * ZK_BATCH_SIZE)
+
+/**
+ * @brief Free node, as seen by the cache.
+ */
+struct zk_node_cache_link {
+	struct zk_node_cache_link *next;
+	struct zk_node_cache_link *next_batch;
+};
+
+/**
+ * @brief Free nodes of one size class owned by one thread.
+ */
+struct zk_node_cache_magazine {
+	size_t count;
+	void *nodes[ZK_NODE_CACHE_MAGAZINE];
+};
+
+/**
+ * @brief Free nodes of one size class set aside by one thread with zk_node_cache_reserve().
+ */
+struct zk_node_cache_reserve {
+	struct zk_node_cache_link *nodes;
+	size_t count;
+};
+
+/**
+ * @brief Batches of free nodes of one size class shared by all threads.
+ */
+struct zk_node_cache_depot {
+	pthread_mutex_t mutex;
+	struct zk_node_cache_link *batches;
+	size_t count;
+};
+
+static struct zk_node_cache_depot zk_node_cache_depots[ZK_NODE_CACHE_CLASSES];
+static pthread_once_t zk_node_cache_once = PTHREAD_ONCE_INIT;
+static pthread_key_t zk_node_cache_key;
+
+static _Thread_local struct zk_node_cache_magazine zk_node_cache_magazines[ZK_NODE_CACHE_CLASSES];
+static _Thread_local struct zk_node_cache_reserve zk_node_cache_reserves[ZK_NODE_CACHE_CLASSES];
+// 0 until the thread registers its exit handler, then 1, then 2 once its magazines are flushed at exit
+static _Thread_local int zk_node_cache_state;
+
+// Private functions
+static size_t zk_node_cache_class(size_t const size)
+{
+	return size <= ZK_NODE_CACHE_MIN_SIZE ? 0 : (size - ZK_NODE_CACHE_MIN_SIZE + 7) / 8;
+}
+
+static size_t zk_node_cache_class_size(size_t const class)
+{
+	return ZK_NODE_CACHE_MIN_SIZE + class * 8;
+}
+
+static void zk_node_cache_unreserve(void)
+{
+	for (size_t class = 0; class < ZK_NODE_CACHE_CLASSES; class++) {
+		struct zk_node_cache_reserve *const reserve = &zk_node_cache_reserves[class];
+		while (reserve->nodes != NULL) {
+			struct zk_node_cache_link *next = reserve->nodes->next;
+			free(reserve->nodes);
+			reserve->nodes = next;
+		}
+		reserve->count = 0;
+	}
+}
+
+static void zk_node_cache_thread_exit(void *arg)
+{
+	ZK_UNUSED(arg);
+	zk_node_cache_flush();
+	zk_node_cache_unreserve();
+	// nodes freed by destructors of other thread specific data bypass the cache
+	zk_node_cache_state = 2;
+}
+
+static void zk_node_cache_init(void)
+{
+	for (size_t i = 0; i < ZK_NODE_CACHE_CLASSES; i++)
+		pthread_mutex_init(&zk_node_cache_depots[i].mutex, NULL);
+	pthread_key_create(&zk_node_cache_key, zk_node_cache_thread_exit);
+}
+
+static void zk_node_cache_register(void)
+{
+	pthread_once(&zk_node_cache_once, zk_node_cache_init);
+	pthread_setspecific(zk_node_cache_key, zk_node_cache_magazines);
+	zk_node_cache_state = 1;
+}
+
+// Moves the `count` nodes on top of the magazine to the depot, or to free() if the depot is full.
+static void zk_node_cache_release(struct zk_node_cache_magazine *const magazine, size_t const class, size_t count)
+{
+	struct zk_node_cache_link *batch = NULL;
+	for (; count > 0; count--) {
+		struct zk_node_cache_link *link = magazine->nodes[--magazine->count];
+		link->next = batch;
+		batch = link;
+	}
+	if (batch == NULL)
+		return;
+
+	struct zk_node_cache_depot *const depot = &zk_node_cache_depots[class];
+	pthread_mutex_lock(&depot->mutex);
+	bool const kept = depot->count < ZK_NODE_CACHE_DEPOT_BATCHES;
+	if (kept) {
+		batch->next_batch = depot->batches;
+		depot->batches = batch;
+		depot->count++;
+	}
+	pthread_mutex_unlock(&depot->mutex);
+
+	while (!kept && batch != NULL) {
+		struct zk_node_cache_link *next = batch->next;
+		free(batch);
+		batch = next;
+	}
+}
+
+// Refills an empty magazine with a batch of the depot, returns false if the depot is empty.
+static bool zk_node_cache_refill(struct zk_node_cache_magazine *const magazine, size_t const class)
+{
+	struct zk_node_cache_depot *const depot = &zk_node_cache_depots[class];
+	pthread_mutex_lock(&depot->mutex);
+	struct zk_node_cache_link *batch = depot->batches;
+	if (batch != NULL) {
+		depot->batches = batch->next_batch;
+		depot->count--;
+	}
+	pthread_mutex_unlock(&depot->mutex);
+
+	for (; batch != NULL; batch = batch->next)
+		magazine->nodes[magazine->count++] = batch;
+	return magazine->count > 0;
+}
+
+// Allocation
+
+/**
+ * @brief Allocates a node of `size` bytes, from the magazine of the calling thread when possible.
+ *
+ * @return Pointer to the node, NULL on allocation failure. The node may be released with zk_node_cache_free() by any
+ *         thread, or with free().
+ *
+ * @note Time complexity: O(1), amortized over the batches exchanged with the depot.
+ */
+void *zk_node_cache_alloc(size_t const size)
+{
+	if (size > ZK_NODE_CACHE_MAX_SIZE || zk_node_cache_state == 2)
+		return malloc(size);
+
+	size_t const class = zk_node_cache_class(size);
+	struct zk_node_cache_magazine *const magazine = &zk_node_cache_magazines[class];
+	if (magazine->count == 0) {
+		struct zk_node_cache_reserve *const reserve = &zk_node_cache_reserves[class];
+		if (reserve->count > 0) {
+			struct zk_node_cache_link *node = reserve->nodes;
+			reserve->nodes = node->next;
+			reserve->count--;
+			return node;
+		}
+		if (!ZK_NODE_CACHE)
+			return malloc(size);
+		if (zk_node_cache_state == 0)
+			zk_node_cache_register();
+		if (!zk_node_cache_refill(magazine, class))
+			return malloc(zk_node_cache_class_size(class));
+	}
+	return magazine->nodes[--magazine->count];
+}
+
+/**
+ * @brief Sets nodes of `size` bytes aside for the calling thread, so that its next `count` allocations of that size
+ *        class neither call malloc() nor fail. Nodes freed in the meantime are reused first and do not use up the
+ *        reserve. The nodes are written to when reserved, so their pages are already faulted in when they are used.
+ *
+ * @param size Size of the nodes, the size of the container node type.
+ * @param count Number of nodes the reserve holds on success, nodes already reserved count towards it.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if `size` is 0 or larger than ZK_NODE_CACHE_MAX_SIZE, or
+ *         ZK_ERROR_ALLOC on allocation failure, in which case the nodes allocated so far stay reserved.
+ *
+ * @note The reserve is per thread and shared by all containers whose nodes fall in the same size class. It is
+ *       released by zk_node_cache_trim() and when the thread exits.
+ */
+zk_status zk_node_cache_reserve(size_t const size, size_t const count)
+{
+	if (size == 0 || size > ZK_NODE_CACHE_MAX_SIZE)
+		return ZK_INVALID_ARGUMENT;
+	if (zk_node_cache_state == 2)
+		return ZK_ERROR_ALLOC;
+	if (zk_node_cache_state == 0)
+		zk_node_cache_register();
+
+	size_t const class = zk_node_cache_class(size);
+	struct zk_node_cache_magazine *const magazine = &zk_node_cache_magazines[class];
+	struct zk_node_cache_reserve *const reserve = &zk_node_cache_reserves[class];
+	while (reserve->count < count) {
+		struct zk_node_cache_link *node = magazine->count > 0 ? magazine->nodes[--magazine->count]
+		                                                      : malloc(zk_node_cache_class_size(class));
+		if (node == NULL)
+			return ZK_ERROR_ALLOC;
+
+		node->next = reserve->nodes;
+		reserve->nodes = node;
+		reserve->count++;
+	}
+	return ZK_OK;
+}
+
+/**
+ * @brief Returns the number of nodes of `size` bytes left in the reserve of the calling thread.
+ */
+size_t zk_node_cache_reserved(size_t const size)
+{
+	if (size == 0 || size > ZK_NODE_CACHE_MAX_SIZE)
+		return 0;
+
+	return zk_node_cache_reserves[zk_node_cache_class(size)].count;
+}
+
+/**
+ * @brief Releases a node of `size` bytes allocated by zk_node_cache_alloc() or malloc(), keeping it in the magazine of
+ *        the calling thread for the next allocation of the same size class.
+ *
+ * @param node Pointer to the node, may be NULL.
+ * @param size Size the node was allocated with, the size of the container node type.
+ *
+ * @note Time complexity: O(1), amortized over the batches exchanged with the depot.
+ */
+void zk_node_cache_free(void *const node, size_t const size)
+{
+	if (node == NULL)
+		return;
+	if (!ZK_NODE_CACHE || size > ZK_NODE_CACHE_MAX_SIZE || zk_node_cache_state == 2) {
+		free(node);
+		return;
+	}
+
+	size_t const class = zk_node_cache_class(size);
+	struct zk_node_cache_magazine *const magazine = &zk_node_cache_magazines[class];
+	if (zk_node_cache_state == 0)
+		zk_node_cache_register();
+	if (magazine->count == ZK_NODE_CACHE_MAGAZINE)
+		zk_node_cache_release(magazine, class, ZK_BATCH_SIZE);
+	magazine->nodes[magazine->count++] = node;
+}
+
+// Maintenance
+
+/**
+ * @brief Moves the nodes cached by the calling thread to the shared depot, where other threads can reuse them. Runs
+ *        automatically when a thread exits.
+ */
+void zk_node_cache_flush(void)
+{
+	for (size_t class = 0; class < ZK_NODE_CACHE_CLASSES; class++) {
+		struct zk_node_cache_magazine *const magazine = &zk_node_cache_magazines[class];
+		while (magazine->count > 0) {
+			size_t const count = magazine->count < ZK_BATCH_SIZE ? magazine->count : ZK_BATCH_SIZE;
+			zk_node_cache_release(magazine, class, count);
+		}
+	}
+}
+
+/**
+ * @brief Flushes the nodes of the calling thread, releases its reserve and returns every node of the depot to free().
+ *        Nodes cached by other running threads are kept.
+ */
+void zk_node_cache_trim(void)
+{
+	zk_node_cache_flush();
+	zk_node_cache_unreserve();
+	pthread_once(&zk_node_cache_once, zk_node_cache_init);
+	for (size_t class = 0; class < ZK_NODE_CACHE_CLASSES; class++) {
+		struct zk_node_cache_depot *const depot = &zk_node_cache_depots[class];
+		pthread_mutex_lock(&depot->mutex);
+		struct zk_node_cache_link *batches = depot->batches;
+		depot->batches = NULL;
+		depot->count = 0;
+		pthread_mutex_unlock(&depot->mutex);
+
+		while (batches != NULL) {
+			struct zk_node_cache_link *next_batch = batches->next_batch;
+			while (batches != NULL) {
+				struct zk_node_cache_link *next = batches->next;
+				free(batches);
+				batches = next;
+			}
+			batches = next_batch;
+		}
+	}
+}
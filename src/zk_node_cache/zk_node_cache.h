@@ -0,0 +1,47 @@
+#ifndef ZK_NODE_CACHE_H
+#define ZK_NODE_CACHE_H
+
+#include <stddef.h>
+
+#include "zk_common/zk_common.h"
+
+/**
+ * Whether list nodes go through the thread-local node cache. It is set at build time through the `node_cache` option,
+ * 0 makes zk_node_cache_alloc() and zk_node_cache_free() plain malloc() and free(), apart from the nodes reserved with
+ * zk_node_cache_reserve().
+ */
+#ifndef ZK_NODE_CACHE
+#define ZK_NODE_CACHE 1
+#endif
+
+/**
+ * Largest node size served by the cache, larger sizes go straight to malloc(). Sizes are grouped in classes of 8 bytes
+ * starting at 16 bytes.
+ */
+#ifndef ZK_NODE_CACHE_MAX_SIZE
+#define ZK_NODE_CACHE_MAX_SIZE 64
+#endif
+
+/**
+ * Number of batches of ZK_BATCH_SIZE nodes the shared depot keeps per size class. Nodes overflowing it are returned to
+ * free().
+ */
+#ifndef ZK_NODE_CACHE_DEPOT_BATCHES
+#define ZK_NODE_CACHE_DEPOT_BATCHES 64
+#endif
+
+// Allocation
+void *zk_node_cache_alloc(size_t const size);
+
+void zk_node_cache_free(void *const node, size_t const size);
+
+zk_status zk_node_cache_reserve(size_t const size, size_t const count);
+
+size_t zk_node_cache_reserved(size_t const size);
+
+// Maintenance
+void zk_node_cache_flush(void);
+
+void zk_node_cache_trim(void);
+
+#endif
@@ -0,0 +1,149 @@
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "zk_iter/zk_iter.h"
+#include "zk_parallel/zk_parallel.h"
+
+/**
+ * @brief Worker thread running one task.
+ */
+struct zk_parallel_worker {
+	pthread_t thread;
+	bool started;
+	zk_task_func func;
+	void *task;
+};
+
+// Private functions
+static void *zk_parallel_worker_main(void *arg)
+{
+	struct zk_parallel_worker *worker = arg;
+	worker->func(worker->task);
+	return NULL;
+}
+
+static void *zk_parallel_node_next(void *const node)
+{
+	return zk_iter_node(zk_iter_next(zk_iter_new(node, NULL)));
+}
+
+// Execution
+
+/**
+ * @brief Runs `func` once per task, each on its own thread, and returns when all of them completed. The calling thread
+ *        runs the first task itself. If a worker thread cannot be started its task runs on the calling thread, so every
+ *        task always runs exactly once.
+ *
+ * @param tasks Array of `count` tasks of `task_size` bytes. `func` receives a pointer to its task.
+ * @param task_size Size of one task in bytes.
+ * @param count Number of tasks, which is the number of threads used.
+ * @param func Function run for every task.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if arguments are invalid or ZK_ERROR_ALLOC if the worker bookkeeping
+ *         could not be allocated, in which case no task ran.
+ */
+zk_status zk_parallel_run(void *const tasks, size_t const task_size, size_t const count, zk_task_func const func)
+{
+	if (tasks == NULL || task_size == 0 || count == 0 || func == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	char *const task = tasks;
+	if (count == 1) {
+		func(task);
+		return ZK_OK;
+	}
+
+	struct zk_parallel_worker *workers = calloc(count - 1, sizeof(struct zk_parallel_worker));
+	if (workers == NULL)
+		return ZK_ERROR_ALLOC;
+
+	for (size_t i = 0; i < count - 1; i++) {
+		workers[i].func = func;
+		workers[i].task = task + (i + 1) * task_size;
+		workers[i].started = pthread_create(&workers[i].thread, NULL, zk_parallel_worker_main, &workers[i]) == 0;
+	}
+
+	func(task);
+
+	for (size_t i = 0; i < count - 1; i++) {
+		if (workers[i].started)
+			pthread_join(workers[i].thread, NULL);
+		else
+			func(workers[i].task);
+	}
+
+	free(workers);
+	return ZK_OK;
+}
+
+/**
+ * @brief Splits the range [begin, end) of a linear list into at most `threads` chunks of similar length, walking it
+ *        once. The length is not known up front, so the walk remembers every stride-th node in an array of
+ *        ZK_PARALLEL_SPLIT_MARKS * `threads` marks and doubles the stride, keeping every other mark, whenever the array
+ *        fills up. The chunks are then cut at the marks nearest to their ideal bounds, so each chunk length is within
+ *        one stride of size / threads, and the stride stays below size / (ZK_PARALLEL_SPLIT_MARKS / 2 * threads - 1).
+ *        Ranges of up to ZK_PARALLEL_SPLIT_MARKS * threads nodes keep a stride of 1 and are split exactly.
+ *
+ * @param begin First node of the range. Nodes must start with the zk_iter_node layout.
+ * @param end Node following the last node of the range, NULL for the end of the list.
+ * @param threads Maximum number of chunks.
+ * @param bounds Array of at least `threads` + 1 entries. Chunk i is [bounds[i], bounds[i + 1]) and bounds[count] is
+ *        `end`.
+ * @param count_p Receives the number of chunks, fewer than `threads` for short ranges and 0 for an empty one.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if arguments are invalid or ZK_ERROR_ALLOC if the marks could not be
+ *         allocated.
+ *
+ * @note Time complexity: O(n)
+ * @note Space complexity: O(threads)
+ */
+zk_status zk_parallel_split(void *const begin,
+                            const void *const end,
+                            size_t const threads,
+                            void **const bounds,
+                            size_t *const count_p)
+{
+	if (threads == 0 || bounds == NULL || count_p == NULL)
+		return ZK_INVALID_ARGUMENT;
+	if (threads > SIZE_MAX / sizeof(void *) / ZK_PARALLEL_SPLIT_MARKS)
+		return ZK_ERROR_ALLOC;
+
+	size_t const capacity = ZK_PARALLEL_SPLIT_MARKS * threads;
+	void **marks = malloc(capacity * sizeof(void *));
+	if (marks == NULL)
+		return ZK_ERROR_ALLOC;
+
+	// marks[i] is the node at position i * stride, stride is a power of two
+	size_t size = 0;
+	size_t stride = 1;
+	size_t count = 0;
+	for (void *node = begin; node != end; node = zk_parallel_node_next(node), size++) {
+		if ((size & (stride - 1)) != 0)
+			continue;
+		if (count == capacity) {
+			for (size_t i = 0; i < capacity / 2; i++)
+				marks[i] = marks[2 * i];
+			count = capacity / 2;
+			stride *= 2;
+			if ((size & (stride - 1)) != 0)
+				continue;
+		}
+		marks[count++] = node;
+	}
+
+	// chunk i starts at the mark nearest to position i * size / chunks. With a stride of 1 every node is marked and
+	// the split is exact, otherwise there are at least capacity / 2 marks so chunks span several strides each.
+	size_t const chunks = size < threads ? size : threads;
+	for (size_t i = 0; i < chunks; i++) {
+		size_t const position = size / chunks * i + size % chunks * i / chunks;
+		size_t const mark = (position + stride / 2) / stride;
+		bounds[i] = marks[mark < count ? mark : count - 1];
+	}
+	bounds[chunks] = (void *)end;
+	*count_p = chunks;
+
+	free(marks);
+	return ZK_OK;
+}
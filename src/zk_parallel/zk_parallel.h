@@ -0,0 +1,27 @@
+#ifndef ZK_PARALLEL_H
+#define ZK_PARALLEL_H
+
+#include <stddef.h>
+
+#include "zk_common/zk_common.h"
+
+/**
+ * Number of nodes zk_parallel_split() remembers per chunk while it walks a list of unknown length. More marks balance
+ * the chunks better, each chunk is within about 2 / ZK_PARALLEL_SPLIT_MARKS of the average length. Must be even.
+ */
+#ifndef ZK_PARALLEL_SPLIT_MARKS
+#define ZK_PARALLEL_SPLIT_MARKS 8
+#endif
+
+typedef void (*zk_task_func)(void *task);
+
+// Execution
+zk_status zk_parallel_run(void *const tasks, size_t const task_size, size_t const count, zk_task_func const func);
+
+zk_status zk_parallel_split(void *const begin,
+                            const void *const end,
+                            size_t const threads,
+                            void **const bounds,
+                            size_t *const count_p);
+
+#endif
@@ -0,0 +1,337 @@
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "zk_ebr/zk_ebr.h"
+#include "zk_rcu_dlist/zk_rcu_dlist.h"
+
+/*
+ * Readers run inside an epoch critical section and only follow `head` and the `next` fields, with acquire loads. A
+ * writer fully initializes a node before publishing it with a release store, so a reader sees either the old or the
+ * new version of the list, never a partial node.
+ *
+ * An unlinked node keeps its `next` field, readers standing on it carry on with the rest of the list. It is retired
+ * through zk_ebr and freed with its data after a grace period, once no reader can still hold it.
+ *
+ * `prev` and `tail` are only used by writers, under the mutex.
+ */
+
+/**
+ * @brief List node.
+ */
+struct zk_rcu_dlist_node {
+	void *data;
+	struct zk_rcu_dlist_node *next;
+	struct zk_rcu_dlist_node *prev;
+	zk_destructor_t destructor;
+	zk_ebr_node ebr;
+};
+
+/**
+ * @brief RCU list. Writers take `mutex`, readers only read `head`, which is alone on its cache line.
+ */
+struct zk_rcu_dlist {
+	_Alignas(ZK_CACHE_LINE) struct zk_rcu_dlist_node *head;
+	_Alignas(ZK_CACHE_LINE) struct zk_rcu_dlist_node *tail;
+	size_t size;
+	pthread_mutex_t mutex;
+};
+
+// Private functions
+static struct zk_rcu_dlist_node *zk_rcu_dlist_load(struct zk_rcu_dlist_node *const *const link)
+{
+	return __atomic_load_n(link, __ATOMIC_ACQUIRE);
+}
+
+static void zk_rcu_dlist_publish(struct zk_rcu_dlist_node **const link, struct zk_rcu_dlist_node *const node)
+{
+	__atomic_store_n(link, node, __ATOMIC_RELEASE);
+}
+
+static void zk_rcu_dlist_node_free(void *ebr)
+{
+	struct zk_rcu_dlist_node *node = ZK_EBR_ENTRY(ebr, struct zk_rcu_dlist_node, ebr);
+	if (node->destructor != NULL)
+		node->destructor(node->data);
+	free(node);
+}
+
+// Returns the first node equal to data, the caller holds the mutex.
+static struct zk_rcu_dlist_node *zk_rcu_dlist_find_node(const zk_rcu_dlist *const list,
+                                                       const void *const data,
+                                                       zk_compare_func const func)
+{
+	struct zk_rcu_dlist_node *node = list->head;
+	while (node != NULL && func(node->data, data) != 0)
+		node = node->next;
+	return node;
+}
+
+// Makes `node` take the place of `old` for readers and writers, the caller holds the mutex.
+static void zk_rcu_dlist_swap(zk_rcu_dlist *const list,
+                              struct zk_rcu_dlist_node *const old,
+                              struct zk_rcu_dlist_node *const node)
+{
+	if (node != NULL) {
+		node->next = old->next;
+		node->prev = old->prev;
+	}
+	struct zk_rcu_dlist_node *const next = node != NULL ? node : old->next;
+	struct zk_rcu_dlist_node *const prev = node != NULL ? node : old->prev;
+
+	if (old->next != NULL)
+		old->next->prev = prev;
+	else
+		list->tail = prev;
+	zk_rcu_dlist_publish(old->prev != NULL ? &old->prev->next : &list->head, next);
+}
+
+// Constructor
+zk_status zk_rcu_dlist_new(zk_rcu_dlist **list_p)
+{
+	if (list_p == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	zk_rcu_dlist *list = aligned_alloc(ZK_CACHE_LINE, sizeof(zk_rcu_dlist));
+	if (list == NULL)
+		return ZK_ERROR_ALLOC;
+	if (pthread_mutex_init(&list->mutex, NULL) != 0) {
+		free(list);
+		return ZK_ERROR_ALLOC;
+	}
+	list->head = NULL;
+	list->tail = NULL;
+	list->size = 0;
+
+	*list_p = list;
+	return ZK_OK;
+}
+
+/**
+ * @brief Creates a list holding the data of `dlist`, in the same order, and frees the nodes of `dlist`. The data
+ *        itself is moved, not copied. Use it to turn an existing zk_dlist into a list that readers can walk without
+ *        locking while it is updated.
+ *
+ * @param list_p Pointer to the list to create.
+ * @param dlist_p Pointer to the zk_dlist to convert. It is set to NULL on success. It must not be in use by other
+ *        threads during the conversion.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if a pointer is NULL or ZK_ERROR_ALLOC on allocation failure, in
+ *         which case `dlist` is left untouched.
+ *
+ * @note Time complexity: O(n)
+ */
+zk_status zk_rcu_dlist_from_dlist(zk_rcu_dlist **list_p, zk_dlist **dlist_p)
+{
+	if (list_p == NULL || dlist_p == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	zk_rcu_dlist *list = NULL;
+	zk_status status = zk_rcu_dlist_new(&list);
+	for (zk_dlist *node = *dlist_p; status == ZK_OK && node != NULL; node = node->next)
+		status = zk_rcu_dlist_push_back(list, node->data);
+	if (status != ZK_OK) {
+		zk_rcu_dlist_free(&list, NULL);
+		return status;
+	}
+
+	zk_dlist_free(dlist_p, NULL);
+	*list_p = list;
+	return ZK_OK;
+}
+
+// Destructor
+
+/**
+ * @brief Frees the list and its data. Must not run concurrently with other operations on the list. Also waits for the
+ *        nodes removed by the calling thread to be reclaimed, see zk_ebr_barrier().
+ *
+ * @param list_p Pointer to the list. It is set to NULL after the list is freed.
+ * @param func Pointer to the destructor applied to the data still in the list. If NULL, the data is not freed.
+ */
+void zk_rcu_dlist_free(zk_rcu_dlist **list_p, zk_destructor_t const func)
+{
+	if (list_p == NULL || *list_p == NULL)
+		return;
+
+	zk_rcu_dlist *list = *list_p;
+	struct zk_rcu_dlist_node *node = list->head;
+	while (node != NULL) {
+		struct zk_rcu_dlist_node *next = node->next;
+		if (func != NULL)
+			func(node->data);
+		free(node);
+		node = next;
+	}
+	pthread_mutex_destroy(&list->mutex);
+	free(list);
+	*list_p = NULL;
+	zk_ebr_barrier();
+}
+
+// Capacity
+size_t zk_rcu_dlist_size(const zk_rcu_dlist *const list)
+{
+	return list != NULL ? __atomic_load_n(&list->size, __ATOMIC_RELAXED) : 0;
+}
+
+// Lookup
+
+/**
+ * @brief Returns the data of the first element equal to `data`, or NULL. Takes no lock and performs no atomic
+ *        read-modify-write.
+ *
+ * @note The element may be removed concurrently: the caller must surround the call and every use of the returned
+ *       data with zk_ebr_enter() and zk_ebr_exit(), the data stays valid until then.
+ */
+void *zk_rcu_dlist_find(const zk_rcu_dlist *const list, const void *const data, zk_compare_func const func)
+{
+	if (list == NULL || func == NULL)
+		return NULL;
+
+	zk_ebr_enter();
+	struct zk_rcu_dlist_node *node = zk_rcu_dlist_load(&list->head);
+	while (node != NULL && func(node->data, data) != 0)
+		node = zk_rcu_dlist_load(&node->next);
+	void *found = node != NULL ? node->data : NULL;
+	zk_ebr_exit();
+	return found;
+}
+
+/**
+ * @brief Calls `func` on the data of each element, in order, inside a critical section. Takes no lock and performs no
+ *        atomic read-modify-write. Elements inserted or removed during the traversal may or may not be visited.
+ */
+void zk_rcu_dlist_for_each(const zk_rcu_dlist *const list, zk_for_each_func const func, void *const user_data)
+{
+	if (list == NULL || func == NULL)
+		return;
+
+	zk_ebr_enter();
+	for (struct zk_rcu_dlist_node *node = zk_rcu_dlist_load(&list->head); node != NULL;
+	     node = zk_rcu_dlist_load(&node->next))
+		func(node->data, user_data);
+	zk_ebr_exit();
+}
+
+// Modifiers
+zk_status zk_rcu_dlist_push_back(zk_rcu_dlist *const list, void *const data)
+{
+	if (list == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	struct zk_rcu_dlist_node *node = malloc(sizeof(struct zk_rcu_dlist_node));
+	if (node == NULL)
+		return ZK_ERROR_ALLOC;
+	node->data = data;
+	node->next = NULL;
+
+	pthread_mutex_lock(&list->mutex);
+	node->prev = list->tail;
+	zk_rcu_dlist_publish(list->tail != NULL ? &list->tail->next : &list->head, node);
+	list->tail = node;
+	__atomic_store_n(&list->size, list->size + 1, __ATOMIC_RELAXED);
+	pthread_mutex_unlock(&list->mutex);
+
+	return ZK_OK;
+}
+
+zk_status zk_rcu_dlist_push_front(zk_rcu_dlist *const list, void *const data)
+{
+	if (list == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	struct zk_rcu_dlist_node *node = malloc(sizeof(struct zk_rcu_dlist_node));
+	if (node == NULL)
+		return ZK_ERROR_ALLOC;
+	node->data = data;
+	node->prev = NULL;
+
+	pthread_mutex_lock(&list->mutex);
+	node->next = list->head;
+	if (list->head != NULL)
+		list->head->prev = node;
+	else
+		list->tail = node;
+	zk_rcu_dlist_publish(&list->head, node);
+	__atomic_store_n(&list->size, list->size + 1, __ATOMIC_RELAXED);
+	pthread_mutex_unlock(&list->mutex);
+
+	return ZK_OK;
+}
+
+/**
+ * @brief Removes the first element equal to `data`.
+ *
+ * @param list The list.
+ * @param data Data to compare the elements with.
+ * @param func Pointer to the function comparing two data.
+ * @param destructor Pointer to the destructor applied to the removed data after a grace period. If NULL, the data is
+ *                   not freed.
+ *
+ * @return true if an element was removed, false otherwise.
+ */
+bool zk_rcu_dlist_remove(zk_rcu_dlist *const list,
+                         const void *const data,
+                         zk_compare_func const func,
+                         zk_destructor_t const destructor)
+{
+	if (list == NULL || func == NULL)
+		return false;
+
+	pthread_mutex_lock(&list->mutex);
+	struct zk_rcu_dlist_node *node = zk_rcu_dlist_find_node(list, data, func);
+	if (node != NULL) {
+		zk_rcu_dlist_swap(list, node, NULL);
+		__atomic_store_n(&list->size, list->size - 1, __ATOMIC_RELAXED);
+	}
+	pthread_mutex_unlock(&list->mutex);
+
+	if (node == NULL)
+		return false;
+	node->destructor = destructor;
+	zk_ebr_retire(&node->ebr, zk_rcu_dlist_node_free);
+	return true;
+}
+
+/**
+ * @brief Replaces the data of the first element equal to `data` with `new_data`. The element is copied: readers see
+ *        either the old or the new data, and the old one stays valid for them until a grace period has passed.
+ *
+ * @param list The list.
+ * @param data Data to compare the elements with.
+ * @param func Pointer to the function comparing two data.
+ * @param new_data Data of the new version of the element.
+ * @param destructor Pointer to the destructor applied to the old data after a grace period. If NULL, the data is not
+ *                   freed.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if arguments are invalid or no element is equal to `data`, or
+ *         ZK_ERROR_ALLOC on allocation failure.
+ */
+zk_status zk_rcu_dlist_replace(zk_rcu_dlist *const list,
+                               const void *const data,
+                               zk_compare_func const func,
+                               void *const new_data,
+                               zk_destructor_t const destructor)
+{
+	if (list == NULL || func == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	struct zk_rcu_dlist_node *node = malloc(sizeof(struct zk_rcu_dlist_node));
+	if (node == NULL)
+		return ZK_ERROR_ALLOC;
+	node->data = new_data;
+
+	pthread_mutex_lock(&list->mutex);
+	struct zk_rcu_dlist_node *old = zk_rcu_dlist_find_node(list, data, func);
+	if (old != NULL)
+		zk_rcu_dlist_swap(list, old, node);
+	pthread_mutex_unlock(&list->mutex);
+
+	if (old == NULL) {
+		free(node);
+		return ZK_INVALID_ARGUMENT;
+	}
+	old->destructor = destructor;
+	zk_ebr_retire(&old->ebr, zk_rcu_dlist_node_free);
+	return ZK_OK;
+}
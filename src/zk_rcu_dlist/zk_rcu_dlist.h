@@ -0,0 +1,53 @@
+#ifndef ZK_RCU_DLIST_H
+#define ZK_RCU_DLIST_H
+
+#include <stddef.h>
+
+#include "zk_common/zk_common.h"
+#include "zk_dlist/zk_dlist.h"
+
+/**
+ * @brief Read-mostly doubly linked list in the style of read-copy-update. Readers never lock and never write the list,
+ *        they only write their own zk_ebr slot, which the first zk_ebr_enter() of a thread registers with a CAS.
+ *        Writers are serialized by a mutex, publish their changes with release stores and retire the nodes they unlink
+ *        through zk_ebr.
+ *
+ *        It is a separate, opaque type rather than a mode of zk_dlist: zk_dlist hands its nodes out to callers, who
+ *        may read and write their fields directly, and its removals free nodes at once, so readers could never walk a
+ *        zk_dlist safely while it changes. Existing zk_dlist users migrate with zk_rcu_dlist_from_dlist().
+ */
+typedef struct zk_rcu_dlist zk_rcu_dlist;
+
+// Constructor
+zk_status zk_rcu_dlist_new(zk_rcu_dlist **list_p);
+
+zk_status zk_rcu_dlist_from_dlist(zk_rcu_dlist **list_p, zk_dlist **dlist_p);
+
+// Destructor
+void zk_rcu_dlist_free(zk_rcu_dlist **list_p, zk_destructor_t const func);
+
+// Capacity
+size_t zk_rcu_dlist_size(const zk_rcu_dlist *const list);
+
+// Lookup
+void *zk_rcu_dlist_find(const zk_rcu_dlist *const list, const void *const data, zk_compare_func const func);
+
+void zk_rcu_dlist_for_each(const zk_rcu_dlist *const list, zk_for_each_func const func, void *const user_data);
+
+// Modifiers
+zk_status zk_rcu_dlist_push_back(zk_rcu_dlist *const list, void *const data);
+
+zk_status zk_rcu_dlist_push_front(zk_rcu_dlist *const list, void *const data);
+
+bool zk_rcu_dlist_remove(zk_rcu_dlist *const list,
+                         const void *const data,
+                         zk_compare_func const func,
+                         zk_destructor_t const destructor);
+
+zk_status zk_rcu_dlist_replace(zk_rcu_dlist *const list,
+                               const void *const data,
+                               zk_compare_func const func,
+                               void *const new_data,
+                               zk_destructor_t const destructor);
+
+#endif
@@ -0,0 +1,134 @@
+#include <pthread.h>
+#include <stdbool.h>
+
+#include "zk_reclaim/zk_reclaim.h"
+
+/*
+ * A single background thread frees the containers handed over by zk_reclaim_submit(), in submission order. It is
+ * started by the first submission and then waits for work for the rest of the process. Freeing a list is dominated by
+ * cache misses on its nodes and by free() itself, which is why it is moved off the calling thread instead of being
+ * made faster.
+ *
+ * The queue is a fixed ring guarded by a mutex: submissions are rare, one per container, so the lock is never hot.
+ */
+
+/**
+ * @brief Container waiting to be freed.
+ */
+struct zk_reclaim_job {
+	void *container;
+	zk_reclaim_func free_func;
+	zk_destructor_t func;
+};
+
+/**
+ * @brief Reclaimer state. `pending` counts the queued jobs plus the one being freed, if any.
+ */
+struct zk_reclaim {
+	pthread_mutex_t mutex;
+	pthread_cond_t work;
+	pthread_cond_t idle;
+	bool started;
+	size_t head;
+	size_t count;
+	size_t pending;
+	struct zk_reclaim_job jobs[ZK_RECLAIM_QUEUE_SIZE];
+};
+
+static struct zk_reclaim zk_reclaim = {
+	.mutex = PTHREAD_MUTEX_INITIALIZER,
+	.work = PTHREAD_COND_INITIALIZER,
+	.idle = PTHREAD_COND_INITIALIZER,
+};
+
+// Private functions
+static void *zk_reclaim_main(void *arg)
+{
+	ZK_UNUSED(arg);
+
+	pthread_mutex_lock(&zk_reclaim.mutex);
+	for (;;) {
+		while (zk_reclaim.count == 0)
+			pthread_cond_wait(&zk_reclaim.work, &zk_reclaim.mutex);
+
+		struct zk_reclaim_job const job = zk_reclaim.jobs[zk_reclaim.head];
+		zk_reclaim.head = (zk_reclaim.head + 1) % ZK_RECLAIM_QUEUE_SIZE;
+		zk_reclaim.count--;
+		pthread_mutex_unlock(&zk_reclaim.mutex);
+
+		job.free_func(job.container, job.func);
+
+		pthread_mutex_lock(&zk_reclaim.mutex);
+		if (--zk_reclaim.pending == 0)
+			pthread_cond_broadcast(&zk_reclaim.idle);
+	}
+	return NULL;
+}
+
+static bool zk_reclaim_start(void)
+{
+	pthread_t thread;
+	if (pthread_create(&thread, NULL, zk_reclaim_main, NULL) != 0)
+		return false;
+	pthread_detach(thread);
+	return true;
+}
+
+// Reclamation
+
+/**
+ * @brief Waits until every container submitted so far, by any thread, has been freed. Call it before shutdown, or
+ *        before code that needs the memory or the side effects of the destructors.
+ */
+void zk_reclaim_flush(void)
+{
+	pthread_mutex_lock(&zk_reclaim.mutex);
+	while (zk_reclaim.pending > 0)
+		pthread_cond_wait(&zk_reclaim.idle, &zk_reclaim.mutex);
+	pthread_mutex_unlock(&zk_reclaim.mutex);
+}
+
+/**
+ * @brief Returns the number of submitted containers not freed yet.
+ */
+size_t zk_reclaim_pending(void)
+{
+	pthread_mutex_lock(&zk_reclaim.mutex);
+	size_t const pending = zk_reclaim.pending;
+	pthread_mutex_unlock(&zk_reclaim.mutex);
+	return pending;
+}
+
+/**
+ * @brief Hands `container` to the reclaimer thread, which calls free_func(container, func). Returns without touching
+ *        the container, so the cost for the caller does not depend on its size.
+ *
+ * @param container Container detached from every other reference. It must not be used once submitted.
+ * @param free_func Function freeing the container, usually the wrapper of a `*_free()` function.
+ * @param func Destructor passed to `free_func`, may be NULL.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if arguments are invalid, ZK_ERROR_FULL if ZK_RECLAIM_QUEUE_SIZE
+ *         containers are already waiting or ZK_ERROR_ALLOC if the reclaimer thread cannot be started. On failure the
+ *         container still belongs to the caller.
+ */
+zk_status zk_reclaim_submit(void *const container, zk_reclaim_func const free_func, zk_destructor_t const func)
+{
+	if (container == NULL || free_func == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	zk_status status = ZK_OK;
+	pthread_mutex_lock(&zk_reclaim.mutex);
+	if (zk_reclaim.count == ZK_RECLAIM_QUEUE_SIZE) {
+		status = ZK_ERROR_FULL;
+	} else if (!zk_reclaim.started && !(zk_reclaim.started = zk_reclaim_start())) {
+		status = ZK_ERROR_ALLOC;
+	} else {
+		size_t const tail = (zk_reclaim.head + zk_reclaim.count) % ZK_RECLAIM_QUEUE_SIZE;
+		zk_reclaim.jobs[tail] = (struct zk_reclaim_job){ container, free_func, func };
+		zk_reclaim.count++;
+		zk_reclaim.pending++;
+		pthread_cond_signal(&zk_reclaim.work);
+	}
+	pthread_mutex_unlock(&zk_reclaim.mutex);
+	return status;
+}
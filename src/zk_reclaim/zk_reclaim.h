@@ -0,0 +1,28 @@
+#ifndef ZK_RECLAIM_H
+#define ZK_RECLAIM_H
+
+#include <stddef.h>
+
+#include "zk_common/zk_common.h"
+
+/**
+ * Maximum number of containers waiting for the reclaimer thread. Once reached, submissions fail with ZK_ERROR_FULL
+ * until the reclaimer catches up, so a burst of frees cannot queue an unbounded amount of memory.
+ */
+#ifndef ZK_RECLAIM_QUEUE_SIZE
+#define ZK_RECLAIM_QUEUE_SIZE 64
+#endif
+
+/**
+ * @brief Frees a whole container detached by its owner, applying `func` to its data. Runs on the reclaimer thread.
+ */
+typedef void (*zk_reclaim_func)(void *container, zk_destructor_t func);
+
+// Reclamation
+void zk_reclaim_flush(void);
+
+size_t zk_reclaim_pending(void);
+
+zk_status zk_reclaim_submit(void *const container, zk_reclaim_func const free_func, zk_destructor_t const func);
+
+#endif
@@ -0,0 +1,206 @@
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "zk_shard_slist/zk_shard_slist.h"
+
+/*
+ * Each shard is a zk_slist with a tail pointer on its own cache line. An append writes only the shard of its thread,
+ * so appends from different threads share no memory at all and need no atomic instruction.
+ *
+ * Combining moves the nodes of every shard into one zk_slist, shards end up empty. It reads the shards written by the
+ * other threads, so it runs once they are done appending and the caller has synchronized with them, for example by
+ * joining them. No lock is involved on either side.
+ */
+
+/**
+ * @brief Shard owned by one writer. `tail` makes appends O(1).
+ */
+struct zk_shard_slist_shard {
+	_Alignas(ZK_CACHE_LINE) zk_slist *head;
+	zk_slist *tail;
+	size_t size;
+};
+
+/**
+ * @brief Sharded list struct.
+ */
+struct zk_shard_slist {
+	_Alignas(ZK_CACHE_LINE) size_t count;
+	struct zk_shard_slist_shard shards[];
+};
+
+// Private functions
+static void zk_shard_slist_reset(struct zk_shard_slist_shard *const shard)
+{
+	shard->head = NULL;
+	shard->tail = NULL;
+	shard->size = 0;
+}
+
+// Constructor
+
+/**
+ * @brief Creates an empty list with `shards` shards.
+ *
+ * @param list_p Pointer to the list to create.
+ * @param shards Number of shards, usually the number of writer threads. Must be greater than 0.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if arguments are invalid or ZK_ERROR_ALLOC on allocation failure.
+ */
+zk_status zk_shard_slist_new(zk_shard_slist **list_p, size_t const shards)
+{
+	if (list_p == NULL || shards == 0 ||
+	    shards > (SIZE_MAX - sizeof(zk_shard_slist)) / sizeof(struct zk_shard_slist_shard))
+		return ZK_INVALID_ARGUMENT;
+
+	zk_shard_slist *list =
+		aligned_alloc(ZK_CACHE_LINE, sizeof(zk_shard_slist) + shards * sizeof(struct zk_shard_slist_shard));
+	if (list == NULL)
+		return ZK_ERROR_ALLOC;
+
+	list->count = shards;
+	for (size_t i = 0; i < shards; i++)
+		zk_shard_slist_reset(&list->shards[i]);
+
+	*list_p = list;
+	return ZK_OK;
+}
+
+// Destructor
+
+/**
+ * @brief Frees the list and the nodes of every shard.
+ *
+ * @param list_p Pointer to the list. It is set to NULL after the list is freed.
+ * @param func Pointer to the destructor function. If NULL, the data is not freed.
+ */
+void zk_shard_slist_free(zk_shard_slist **list_p, zk_destructor_t const func)
+{
+	if (list_p == NULL || *list_p == NULL)
+		return;
+
+	for (size_t i = 0; i < (*list_p)->count; i++)
+		zk_slist_free(&(*list_p)->shards[i].head, func);
+	free(*list_p);
+	*list_p = NULL;
+}
+
+// Capacity
+size_t zk_shard_slist_shards(const zk_shard_slist *const list)
+{
+	return list != NULL ? list->count : 0;
+}
+
+/**
+ * @brief Returns the number of elements in all shards.
+ *
+ * @note Time complexity: O(s), where s is the number of shards.
+ */
+size_t zk_shard_slist_size(const zk_shard_slist *const list)
+{
+	if (list == NULL)
+		return 0;
+
+	size_t size = 0;
+	for (size_t i = 0; i < list->count; i++)
+		size += list->shards[i].size;
+	return size;
+}
+
+// Modifiers
+
+/**
+ * @brief Stitches the shards together, shard 0 first, and returns the whole list. Every shard keeps its append order.
+ *        The shards are empty afterwards and the returned list belongs to the caller.
+ *
+ * @return The combined list, NULL if it is empty.
+ *
+ * @note Time complexity: O(s), where s is the number of shards.
+ * @note Writers must be done appending, see zk_shard_slist.
+ */
+zk_slist *zk_shard_slist_combine(zk_shard_slist *const list)
+{
+	if (list == NULL)
+		return NULL;
+
+	zk_slist *head = NULL;
+	zk_slist *tail = NULL;
+	for (size_t i = 0; i < list->count; i++) {
+		struct zk_shard_slist_shard *const shard = &list->shards[i];
+		if (shard->head == NULL)
+			continue;
+		if (tail == NULL)
+			head = shard->head;
+		else
+			tail->next = shard->head;
+		tail = shard->tail;
+		zk_shard_slist_reset(shard);
+	}
+	return head;
+}
+
+/**
+ * @brief Sorts every shard with zk_slist_sort() and merges them pairwise with zk_slist_merge(). Elements that compare
+ *        equal keep the shard order, then their append order. The shards are empty afterwards and the returned list
+ *        belongs to the caller.
+ *
+ * @param list Pointer to the list.
+ * @param func Pointer to the comparison function. If NULL, the shards are combined unsorted like
+ *             zk_shard_slist_combine().
+ *
+ * @return The combined sorted list, NULL if it is empty.
+ *
+ * @note Time complexity: O(n log n)
+ * @note Writers must be done appending, see zk_shard_slist.
+ */
+zk_slist *zk_shard_slist_combine_sorted(zk_shard_slist *const list, zk_compare_func const func)
+{
+	if (list == NULL || func == NULL)
+		return zk_shard_slist_combine(list);
+
+	for (size_t i = 0; i < list->count; i++)
+		list->shards[i].head = zk_slist_sort(list->shards[i].head, func);
+
+	// merge neighbours two by two, so every element goes through log2(s) merges
+	for (size_t width = 1; width < list->count; width *= 2) {
+		for (size_t i = 0; i + width < list->count; i += 2 * width) {
+			list->shards[i].head = zk_slist_merge(list->shards[i].head, list->shards[i + width].head, func);
+			list->shards[i + width].head = NULL;
+		}
+	}
+
+	zk_slist *head = list->shards[0].head;
+	for (size_t i = 0; i < list->count; i++)
+		zk_shard_slist_reset(&list->shards[i]);
+	return head;
+}
+
+/**
+ * @brief Appends `data` to `shard`.
+ *
+ * @param list Pointer to the list.
+ * @param shard Index of the shard, below zk_shard_slist_shards(). A shard must be used by one thread at a time.
+ * @param data Pointer to the data to append.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if arguments are invalid or ZK_ERROR_ALLOC on allocation failure.
+ *
+ * @note Time complexity: O(1)
+ */
+zk_status zk_shard_slist_push_back(zk_shard_slist *const list, size_t const shard, void *const data)
+{
+	if (list == NULL || shard >= list->count)
+		return ZK_INVALID_ARGUMENT;
+
+	zk_slist *node = zk_slist_new_node(data);
+	if (node == NULL)
+		return ZK_ERROR_ALLOC;
+
+	struct zk_shard_slist_shard *const target = &list->shards[shard];
+	if (target->tail == NULL)
+		target->head = node;
+	else
+		target->tail->next = node;
+	target->tail = node;
+	target->size++;
+	return ZK_OK;
+}
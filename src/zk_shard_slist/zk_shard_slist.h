@@ -0,0 +1,34 @@
+#ifndef ZK_SHARD_SLIST_H
+#define ZK_SHARD_SLIST_H
+
+#include <stddef.h>
+
+#include "zk_common/zk_common.h"
+#include "zk_slist/zk_slist.h"
+
+/**
+ * @brief List sharded by writer: every appending thread owns one zk_slist shard, appends to it in O(1) and never
+ *        touches the shards of the other threads. The shards are combined into a single zk_slist once the writers are
+ *        done.
+ */
+typedef struct zk_shard_slist zk_shard_slist;
+
+// Constructor
+zk_status zk_shard_slist_new(zk_shard_slist **list_p, size_t const shards);
+
+// Destructor
+void zk_shard_slist_free(zk_shard_slist **list_p, zk_destructor_t const func);
+
+// Capacity
+size_t zk_shard_slist_shards(const zk_shard_slist *const list);
+
+size_t zk_shard_slist_size(const zk_shard_slist *const list);
+
+// Modifiers
+zk_slist *zk_shard_slist_combine(zk_shard_slist *const list);
+
+zk_slist *zk_shard_slist_combine_sorted(zk_shard_slist *const list, zk_compare_func const func);
+
+zk_status zk_shard_slist_push_back(zk_shard_slist *const list, size_t const shard, void *const data);
+
+#endif
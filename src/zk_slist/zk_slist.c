@@ -1,6 +1,9 @@
 #include <stdlib.h>
 
 #include "zk_slist/zk_slist.h"
+#include "zk_node_cache/zk_node_cache.h"
+#include "zk_parallel/zk_parallel.h"
+#include "zk_reclaim/zk_reclaim.h"
 
 static void _zk_slist_free(zk_slist **node, zk_destructor_t func)
 {
@@ -9,7 +12,7 @@ static void _zk_slist_free(zk_slist **node, zk_destructor_t func)
 	if (func)
 		func((*node)->data);
 
-	free(*node);
+	zk_node_cache_free(*node, sizeof(zk_slist));
 	*node = NULL;
 }
 
@@ -21,6 +24,49 @@ static zk_slist *zk_slist_last(zk_slist *list)
 	return list;
 }
 
+// Returns the node ZK_PREFETCH_DISTANCE nodes after `node`, or `end` if the list is shorter.
+static zk_slist *zk_slist_prefetch_begin(zk_slist *node, const zk_slist *const end)
+{
+	for (size_t i = ZK_PREFETCH_DISTANCE; i > 0 && node != end; i--)
+		node = node->next;
+
+	return ZK_PREFETCH_DISTANCE ? node : (zk_slist *)end;
+}
+
+// Prefetches the data of `ahead` and the node after it, then returns that node.
+static zk_slist *zk_slist_prefetch_next(zk_slist *ahead, const zk_slist *const end)
+{
+	if (ZK_PREFETCH_DISTANCE == 0 || ahead == end)
+		return ahead;
+
+	ZK_PREFETCH(ahead->data);
+	ahead = ahead->next;
+	if (ahead != end)
+		ZK_PREFETCH(ahead);
+
+	return ahead;
+}
+
+// Stores `node` at `count` in the array, growing it with realloc() when it is full.
+static zk_status zk_slist_nodes_append(zk_slist ***nodes_p,
+                                       size_t *const capacity_p,
+                                       size_t const count,
+                                       zk_slist *node)
+{
+	if (count >= *capacity_p || !*nodes_p) {
+		size_t const capacity = count ? count * 2 : 8;
+		zk_slist **nodes = realloc(*nodes_p, capacity * sizeof(zk_slist *));
+		if (!nodes)
+			return ZK_ERROR_ALLOC;
+
+		*nodes_p = nodes;
+		*capacity_p = capacity;
+	}
+
+	(*nodes_p)[count] = node;
+	return ZK_OK;
+}
+
 static void zk_slist_split_left_right_tail(zk_slist **list_p, zk_slist **left_p, zk_slist **right_p, size_t l_r_size)
 {
 	zk_slist *end_node = NULL;
@@ -77,6 +123,66 @@ zk_slist *zk_slist_end(zk_slist *list)
 	return NULL;
 }
 
+/**
+ * @brief Counts the elements in the list for which the predicate returns true.
+ *
+ * @param list Pointer to the list.
+ * @param func Pointer to the predicate function.
+ * @param user_data Pointer to user data to be passed to the predicate. Can be NULL.
+ *
+ * @return Number of elements matching the predicate, 0 if `list` or `func` is NULL.
+ *
+ * @note Time complexity: O(n)
+ * @note Space complexity: O(1)
+ */
+size_t zk_slist_count_if(const zk_slist *const list, zk_predicate_func const func, void *const user_data)
+{
+	size_t count = 0;
+	if (func) {
+		for (const zk_slist *node = list; node; node = node->next)
+			count += func(node->data, user_data);
+	}
+	return count;
+}
+
+/**
+ * @brief Collects every element in the list for which the predicate returns true, in list order.
+ *
+ * @param list Pointer to the list.
+ * @param func Pointer to the predicate function.
+ * @param user_data Pointer to user data to be passed to the predicate. Can be NULL.
+ * @param nodes_p Pointer to the array receiving the matching nodes. `*nodes_p` is either NULL or an array allocated
+ *                with malloc() holding `*capacity_p` nodes, it is grown with realloc() as needed. The caller frees it.
+ * @param capacity_p Pointer to the capacity of `*nodes_p`, updated when the array grows.
+ * @param count_p Pointer receiving the number of matching nodes stored in `*nodes_p`.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if arguments are invalid or ZK_ERROR_ALLOC if the array could not be
+ *         grown, in which case `*nodes_p` and `*count_p` hold the matches collected so far.
+ *
+ * @note Time complexity: O(n)
+ * @note Space complexity: O(m), where m is the number of matches.
+ */
+zk_status zk_slist_find_all(zk_slist *list,
+                            zk_predicate_func const func,
+                            void *const user_data,
+                            zk_slist ***nodes_p,
+                            size_t *const capacity_p,
+                            size_t *const count_p)
+{
+	if (!func || !nodes_p || !capacity_p || !count_p)
+		return ZK_INVALID_ARGUMENT;
+
+	*count_p = 0;
+	for (; list; list = list->next) {
+		if (func(list->data, user_data)) {
+			if (zk_slist_nodes_append(nodes_p, capacity_p, *count_p, list) != ZK_OK)
+				return ZK_ERROR_ALLOC;
+			(*count_p)++;
+		}
+	}
+	return ZK_OK;
+}
+
 /**
  * @brief Finds the first element in the list that matches the given data.
  *
@@ -94,7 +200,9 @@ zk_slist *zk_slist_find(zk_slist *list, const void *const data, zk_compare_func
 	if (!list || !func)
 		return NULL;
 
+	zk_slist *ahead = zk_slist_prefetch_begin(list, NULL);
 	while (list) {
+		ahead = zk_slist_prefetch_next(ahead, NULL);
 		if (func(list->data, data) == 0)
 			break;
 		list = list->next;
@@ -102,6 +210,57 @@ zk_slist *zk_slist_find(zk_slist *list, const void *const data, zk_compare_func
 	return list;
 }
 
+/**
+ * @brief Finds the first element in the list that matches the given data, consulting `bloom` first so that definite
+ *        misses return without walking the list.
+ *
+ * @param list Pointer to the list.
+ * @param data Pointer to the data to find. It is hashed with the filter hash function, so it must be of the same kind
+ *             as the data stored in the list.
+ * @param func A pointer to a comparison function. On match, the function should return `0`.
+ * @param bloom Filter holding every element of the list, see zk_slist_push_back_bloom(), zk_slist_push_front_bloom()
+ *              and zk_slist_rebuild_bloom(). If NULL, this function behaves as zk_slist_find().
+ *
+ * @return Pointer to the first element in the list that matches the given data or NULL if no match is found.
+ *
+ * @note Time complexity: O(k) on a definite miss, where k is the number of filter hashes, O(n) otherwise.
+ * @note Space complexity: O(1)
+ */
+zk_slist *zk_slist_find_bloom(zk_slist *list,
+			      const void *const data,
+			      zk_compare_func const func,
+			      const zk_bloom *const bloom)
+{
+	if (!list || !func || !zk_bloom_contains(bloom, data))
+		return NULL;
+
+	return zk_slist_find(list, data, func);
+}
+
+/**
+ * @brief Finds the first element in the list for which the predicate returns true. The traversal stops at the first
+ *        match.
+ *
+ * @param list Pointer to the list.
+ * @param func Pointer to the predicate function.
+ * @param user_data Pointer to user data to be passed to the predicate. Can be NULL.
+ *
+ * @return Pointer to the first element matching the predicate or NULL if no match is found.
+ *
+ * @note Time complexity: O(k), where k is the position of the first match.
+ * @note Space complexity: O(1)
+ */
+zk_slist *zk_slist_find_if(zk_slist *list, zk_predicate_func const func, void *const user_data)
+{
+	if (!func)
+		return NULL;
+
+	while (list && !func(list->data, user_data))
+		list = list->next;
+
+	return list;
+}
+
 /**
  * @brief Find the element at the given index.
  *
@@ -138,17 +297,153 @@ zk_slist *zk_slist_find_index(zk_slist *list, size_t const index)
  *
  * @note Time complexity: O(n)
  * @note Space complexity: O(1)
+ * @note Nodes and data ZK_PREFETCH_DISTANCE elements ahead are prefetched while `func` runs.
  */
 void zk_slist_for_each(zk_slist *begin, zk_slist *const end, zk_for_each_func const func, void *const user_data)
 {
 	if (func) {
+		zk_slist *ahead = zk_slist_prefetch_begin(begin, end);
 		while (begin != end) {
+			ahead = zk_slist_prefetch_next(ahead, end);
 			func(begin->data, user_data);
 			begin = begin->next;
 		}
 	}
 }
 
+/**
+ * @brief Applies the given function to the elements of the list in batches. Data pointers are gathered in a stack
+ *        buffer of ZK_BATCH_SIZE entries and `func` is called once per full buffer, then once for the remainder.
+ *
+ * @param begin Iterator to the first element of the list.
+ * @param end Iterator to the element following the last element of the list.
+ * @param func Pointer to the function to be applied to each batch. Its `data` array is only valid during the call.
+ * @param user_data Pointer to user data to be passed to the function. Can be NULL.
+ *
+ * @note Time complexity: O(n)
+ * @note Space complexity: O(1)
+ */
+void zk_slist_for_each_batch(zk_slist *begin,
+                             zk_slist *const end,
+                             zk_for_each_batch_func const func,
+                             void *const user_data)
+{
+	if (func != NULL) {
+		void *batch[ZK_BATCH_SIZE];
+		size_t count = 0;
+		zk_slist *ahead = zk_slist_prefetch_begin(begin, end);
+		for (; begin != end; begin = begin->next) {
+			ahead = zk_slist_prefetch_next(ahead, end);
+			batch[count++] = begin->data;
+			if (count == ZK_BATCH_SIZE) {
+				func(batch, count, user_data);
+				count = 0;
+			}
+		}
+		if (count > 0)
+			func(batch, count, user_data);
+	}
+}
+
+/**
+ * @brief Applies the given function to each element in the list until it returns ZK_STOP, the remaining elements are
+ *        not visited.
+ *
+ * @param begin Iterator to the first element of the list.
+ * @param end Iterator to the element following the last element of the list.
+ * @param func Pointer to the function to be applied to each element. Returns ZK_CONTINUE to go on or ZK_STOP to end
+ *        the traversal.
+ * @param user_data Pointer to user data to be passed to the function. Can be NULL.
+ *
+ * @return The node for which `func` returned ZK_STOP, or NULL if every element was visited.
+ *
+ * @note Time complexity: O(k), where k is the position of the node at which the traversal stopped.
+ * @note Space complexity: O(1)
+ */
+zk_slist *zk_slist_for_each_until(zk_slist *begin,
+                                  zk_slist *const end,
+                                  zk_for_each_until_func const func,
+                                  void *const user_data)
+{
+	if (func != NULL) {
+		zk_slist *ahead = zk_slist_prefetch_begin(begin, end);
+		for (; begin != end; begin = begin->next) {
+			ahead = zk_slist_prefetch_next(ahead, end);
+			if (func(begin->data, user_data) == ZK_STOP)
+				return begin;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * @brief Range of the list run by one thread of zk_slist_for_each_parallel().
+ */
+struct zk_slist_chunk {
+	zk_slist *begin;
+	zk_slist *end;
+	zk_for_each_func func;
+	void *user_data;
+};
+
+static void zk_slist_chunk_run(void *task)
+{
+	struct zk_slist_chunk *chunk = task;
+	zk_slist_for_each(chunk->begin, chunk->end, chunk->func, chunk->user_data);
+}
+
+/**
+ * @brief Applies the given function to each element in the list on `threads` threads. The range is split into
+ *        chunks of similar length in a single walk, see zk_parallel_split(), then every chunk runs on its own thread,
+ *        started for this call, and the function returns once all chunks completed. Elements within a chunk are
+ *        visited in order, chunks run concurrently so `func` must be safe to call from several threads.
+ *
+ * @param begin Iterator to the first element of the list.
+ * @param end Iterator to the element following the last element of the list.
+ * @param func Pointer to the function to be applied to each element.
+ * @param user_data Array of `threads` user data pointers, chunk i passes `user_data[i]` to `func` so every thread
+ *        can reduce into its own slot without locking. Can be NULL, in which case `func` receives NULL.
+ * @param threads Maximum number of threads, the calling thread included. Fewer are used for short lists.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if arguments are invalid or ZK_ERROR_ALLOC if the chunks could not be
+ *         allocated, in which case `func` was not called.
+ *
+ * @note Time complexity: O(n / threads) per thread, plus O(n) on the calling thread to split the range.
+ * @note Space complexity: O(threads)
+ */
+zk_status zk_slist_for_each_parallel(zk_slist *begin,
+                                     zk_slist *const end,
+                                     zk_for_each_func const func,
+                                     void *const *const user_data,
+                                     size_t const threads)
+{
+	if (func == NULL || threads == 0)
+		return ZK_INVALID_ARGUMENT;
+
+	if (threads > SIZE_MAX / (sizeof(struct zk_slist_chunk) + sizeof(void *)) - 1)
+		return ZK_ERROR_ALLOC;
+
+	// the bounds of the chunks share their allocation
+	struct zk_slist_chunk *chunks = malloc(threads * sizeof(struct zk_slist_chunk) + (threads + 1) * sizeof(void *));
+	if (chunks == NULL)
+		return ZK_ERROR_ALLOC;
+	void **bounds = (void **)(chunks + threads);
+
+	size_t count = 0;
+	zk_status status = zk_parallel_split(begin, end, threads, bounds, &count);
+	for (size_t i = 0; status == ZK_OK && i < count; i++) {
+		chunks[i].begin = bounds[i];
+		chunks[i].end = bounds[i + 1];
+		chunks[i].func = func;
+		chunks[i].user_data = user_data != NULL ? user_data[i] : NULL;
+	}
+
+	if (status == ZK_OK && count > 0)
+		status = zk_parallel_run(chunks, sizeof(struct zk_slist_chunk), count, zk_slist_chunk_run);
+	free(chunks);
+	return status;
+}
+
 /**
  * @brief Frees the list and its nodes if `func` is provided.
  *
@@ -161,7 +456,9 @@ void zk_slist_for_each(zk_slist *begin, zk_slist *const end, zk_for_each_func co
 void zk_slist_free(zk_slist **list_p, zk_destructor_t const func)
 {
 	if (list_p) {
+		zk_slist *ahead = zk_slist_prefetch_begin(*list_p, NULL);
 		while (*list_p) {
+			ahead = zk_slist_prefetch_next(ahead, NULL);
 			zk_slist *node = *list_p;
 			*list_p = node->next;
 			_zk_slist_free(&node, func);
@@ -169,6 +466,97 @@ void zk_slist_free(zk_slist **list_p, zk_destructor_t const func)
 	}
 }
 
+/**
+ * @brief Frees a list whose nodes were all allocated from `arena`, then releases the arena with a single munmap().
+ *        This is the only way to release arena nodes, see zk_slist_new_node_arena().
+ *
+ * @param list_p Pointer to the list. It is set to NULL after the list is freed.
+ * @param func Pointer to the destructor function. If NULL, the data is not freed and the list is not even walked.
+ * @param arena_p Pointer to the arena the nodes come from. It is set to NULL. If it points to NULL, this function
+ *        behaves as zk_slist_free().
+ *
+ * @note Time complexity: O(1) if `func` is NULL, O(n) otherwise.
+ * @note Space complexity: O(1)
+ */
+void zk_slist_free_arena(zk_slist **list_p, zk_destructor_t const func, zk_arena **arena_p)
+{
+	if (!arena_p || !*arena_p) {
+		zk_slist_free(list_p, func);
+		return;
+	}
+
+	if (list_p) {
+		if (func) {
+			zk_slist *ahead = zk_slist_prefetch_begin(*list_p, NULL);
+			for (zk_slist *node = *list_p; node; node = node->next) {
+				ahead = zk_slist_prefetch_next(ahead, NULL);
+				func(node->data);
+			}
+		}
+		*list_p = NULL;
+	}
+	zk_arena_free(arena_p);
+}
+
+static void zk_slist_reclaim(void *list, zk_destructor_t func)
+{
+	zk_slist *detached = list;
+	zk_slist_free(&detached, func);
+}
+
+/**
+ * @brief Detaches the list in O(1) and frees it on the background reclaimer thread, see zk_reclaim. Use it to drop
+ *        large lists from latency sensitive threads, zk_reclaim_flush() waits until they are freed.
+ *
+ * @param list_p Pointer to the list. It is set to NULL once the list is handed over.
+ * @param func Pointer to the destructor function, called on the reclaimer thread. If NULL, the data is not freed.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if `list_p` is NULL, ZK_ERROR_FULL if the reclaimer queue is full or
+ *         ZK_ERROR_ALLOC if the reclaimer thread cannot be started. On failure the list is left untouched.
+ *
+ * @note Time complexity: O(1)
+ */
+zk_status zk_slist_free_async(zk_slist **list_p, zk_destructor_t const func)
+{
+	if (list_p == NULL)
+		return ZK_INVALID_ARGUMENT;
+	if (*list_p == NULL)
+		return ZK_OK;
+
+	zk_status const status = zk_reclaim_submit(*list_p, zk_slist_reclaim, func);
+	if (status == ZK_OK)
+		*list_p = NULL;
+	return status;
+}
+
+/**
+ * @brief Frees the nodes at the front of the list until the budget is exhausted. The rest of the list stays a valid
+ *        list, so the call can be repeated until it returns true while other work runs in between.
+ *
+ * @param list_p Pointer to the list. It is updated to the first node not freed yet, NULL once the list is freed.
+ * @param func Pointer to the destructor function. If NULL, the data is not freed.
+ * @param budget Maximum number of nodes and time spent in this call, see zk_budget.
+ *
+ * @return true once the list is completely freed, false if nodes are left.
+ *
+ * @note Time complexity: O(min(n, budget))
+ */
+bool zk_slist_free_budget(zk_slist **list_p, zk_destructor_t const func, zk_budget const budget)
+{
+	if (list_p == NULL)
+		return true;
+
+	zk_budget_meter meter = zk_budget_start(budget);
+	while (*list_p != NULL) {
+		zk_slist *node = *list_p;
+		*list_p = node->next;
+		_zk_slist_free(&node, func);
+		if (!zk_budget_spend(&meter))
+			break;
+	}
+	return *list_p == NULL;
+}
+
 /**
  * @brief Merges two sorted lists. Merges in ascending order if func(a, b) <= 0 and  in descending order if func(a, b) >
  *        0. As the merge happens in place, first and second lists are invalid after the merge as they are merged into
@@ -250,7 +638,34 @@ zk_slist *zk_slist_merge(zk_slist *list, zk_slist *other, zk_compare_func const
  */
 zk_slist *zk_slist_new_node(void *const data)
 {
-	zk_slist *node = malloc(sizeof(zk_slist));
+	zk_slist *node = zk_node_cache_alloc(sizeof(zk_slist));
+	if (!node)
+		return NULL;
+
+	node->data = data;
+	node->next = NULL;
+	return node;
+}
+
+/**
+ * @brief Creates a new node with data, allocated from `arena`. Nodes allocated from an arena are laid out next to each
+ *        other in huge pages, see zk_arena. A list built from arena nodes must only be released as a whole with
+ *        zk_slist_free_arena(). The functions that free nodes one by one, zk_slist_pop_front(), zk_slist_pop_back(),
+ *        zk_slist_free() and its budget and async variants, hand them to the node cache, which would reuse their
+ *        memory after the arena is unmapped.
+ *
+ * @param data Pointer to the data to be stored in the node. Caller is responsible for the memory management of the
+ * data.
+ * @param arena Arena to allocate the node from.
+ *
+ * @return Pointer to the new node or NULL if function fails. This function can only fail if `arena` is NULL or full.
+ *
+ * @note Time complexity: O(1)
+ * @note Space complexity: O(1)
+ */
+zk_slist *zk_slist_new_node_arena(void *const data, zk_arena *const arena)
+{
+	zk_slist *node = zk_arena_alloc(arena, sizeof(zk_slist));
 	if (!node)
 		return NULL;
 
@@ -337,6 +752,55 @@ zk_slist *zk_slist_push_back(zk_slist *list, void *const data)
 	return list;
 }
 
+/**
+ * @brief Appends new node with data to the list, allocating the node from `arena`. See zk_slist_new_node_arena().
+ *
+ * @param list Pointer to the list.
+ * @param data Pointer to the data to be appended. Caller is responsible for the memory management of the data.
+ * @param arena Arena to allocate the node from.
+ *
+ * @return Pointer to the new head of the list or NULL if function fails. This function can only fail if `arena` is
+ * NULL or full.
+ *
+ * @note Time complexity: O(n)
+ * @note Space complexity: O(1)
+ */
+zk_slist *zk_slist_push_back_arena(zk_slist *list, void *const data, zk_arena *const arena)
+{
+	zk_slist *tail = zk_slist_new_node_arena(data, arena);
+	if (!tail)
+		return NULL;
+
+	if (list)
+		zk_slist_last(list)->next = tail;
+	else
+		list = tail;
+
+	return list;
+}
+
+/**
+ * @brief Appends new node with data to the list and adds the data to `bloom`.
+ *
+ * @param list Pointer to the list.
+ * @param data Pointer to the data to be appended. Caller is responsible for the memory management of the data.
+ * @param bloom Filter kept in sync with the list. If NULL, this function behaves as zk_slist_push_back().
+ *
+ * @return Pointer to the new head of the list or NULL if function fails. This function can only fail in case of memory
+ * allocation failure, in which case the filter is left untouched.
+ *
+ * @note Time complexity: O(n)
+ * @note Space complexity: O(1)
+ */
+zk_slist *zk_slist_push_back_bloom(zk_slist *list, void *const data, zk_bloom *const bloom)
+{
+	list = zk_slist_push_back(list, data);
+	if (list && bloom)
+		zk_bloom_add(bloom, data);
+
+	return list;
+}
+
 /**
  * @brief Prepends new node with data to the list.
  *
@@ -359,6 +823,93 @@ zk_slist *zk_slist_push_front(zk_slist *list, void *const data)
 	return head;
 }
 
+/**
+ * @brief Prepends new node with data to the list, allocating the node from `arena`. See zk_slist_new_node_arena().
+ *
+ * @param list Pointer to the list.
+ * @param data Pointer to the data to be prepended. Caller is responsible for the memory management of the data.
+ * @param arena Arena to allocate the node from.
+ *
+ * @return Pointer to the new head of the list or NULL if function fails. This function can only fail if `arena` is
+ * NULL or full.
+ *
+ * @note Time complexity: O(1)
+ * @note Space complexity: O(1)
+ */
+zk_slist *zk_slist_push_front_arena(zk_slist *list, void *const data, zk_arena *const arena)
+{
+	zk_slist *head = zk_slist_new_node_arena(data, arena);
+	if (!head)
+		return NULL;
+
+	head->next = list;
+	return head;
+}
+
+/**
+ * @brief Prepends new node with data to the list and adds the data to `bloom`.
+ *
+ * @param list Pointer to the list.
+ * @param data Pointer to the data to be prepended. Caller is responsible for the memory management of the data.
+ * @param bloom Filter kept in sync with the list. If NULL, this function behaves as zk_slist_push_front().
+ *
+ * @return Pointer to the new head of the list or NULL if function fails. This function can only fail in case of memory
+ * allocation failure, in which case the filter is left untouched.
+ *
+ * @note Time complexity: O(1)
+ * @note Space complexity: O(1)
+ */
+zk_slist *zk_slist_push_front_bloom(zk_slist *list, void *const data, zk_bloom *const bloom)
+{
+	list = zk_slist_push_front(list, data);
+	if (list && bloom)
+		zk_bloom_add(bloom, data);
+
+	return list;
+}
+
+/**
+ * @brief Clears `bloom` and adds every element of the list to it. Removing elements leaves stale bits in the filter,
+ *        which only raises its false positive rate, so callers rebuild after removals when convenient.
+ *
+ * @param list Pointer to the list.
+ * @param bloom Filter to rebuild.
+ *
+ * @return ZK_OK on success or ZK_INVALID_ARGUMENT if `bloom` is NULL.
+ *
+ * @note Time complexity: O(n)
+ * @note Space complexity: O(1)
+ */
+zk_status zk_slist_rebuild_bloom(const zk_slist *const list, zk_bloom *const bloom)
+{
+	if (!bloom)
+		return ZK_INVALID_ARGUMENT;
+
+	zk_bloom_clear(bloom);
+	for (const zk_slist *node = list; node; node = node->next)
+		zk_bloom_add(bloom, node->data);
+
+	return ZK_OK;
+}
+
+/**
+ * @brief Reserves nodes for the calling thread, so that pushes made from it neither call malloc() nor fail until the
+ *        reserve is used up. Use it ahead of a latency sensitive section. The nodes are set aside and pre-faulted by
+ *        the node cache, see zk_node_cache_reserve().
+ *
+ * @param count Number of nodes to reserve. Nodes still reserved count towards it.
+ *
+ * @return ZK_OK on success or ZK_ERROR_ALLOC on allocation failure, in which case fewer nodes are reserved.
+ *
+ * @note The reserve belongs to the calling thread rather than to one list: it is shared by all lists whose nodes have
+ *       the size of a zk_slist node, zk_c_slist included. Nodes freed in the meantime are reused first.
+ * @note Time complexity: O(count)
+ */
+zk_status zk_slist_reserve(size_t const count)
+{
+	return zk_node_cache_reserve(sizeof(zk_slist), count);
+}
+
 /**
  * @brief Reverses the order of the elements in the list.
  *
@@ -2,7 +2,11 @@
 
 #include <stddef.h>
 
+#include "zk_arena/zk_arena.h"
+#include "zk_bloom/zk_bloom.h"
+#include "zk_budget/zk_budget.h"
 #include "zk_common/zk_common.h"
+#include "zk_iter/zk_iter.h"
 
 /**
  * @brief Singly linked list node.
@@ -13,32 +17,130 @@ struct zk_slist {
 };
 typedef struct zk_slist zk_slist;
 
+ZK_ITER_ASSERT_NODE_LAYOUT(zk_slist);
+
 zk_slist *zk_slist_begin(zk_slist *list);
 
 zk_slist *zk_slist_end(zk_slist *list);
 
+size_t zk_slist_count_if(const zk_slist *const list, zk_predicate_func const func, void *const user_data);
+
+zk_status zk_slist_find_all(zk_slist *list,
+                            zk_predicate_func const func,
+                            void *const user_data,
+                            zk_slist ***nodes_p,
+                            size_t *const capacity_p,
+                            size_t *const count_p);
+
 zk_slist *zk_slist_find(zk_slist *list, const void *const data, zk_compare_func const func);
 
+zk_slist *zk_slist_find_bloom(zk_slist *list,
+			      const void *const data,
+			      zk_compare_func const func,
+			      const zk_bloom *const bloom);
+
+zk_slist *zk_slist_find_if(zk_slist *list, zk_predicate_func const func, void *const user_data);
+
 zk_slist *zk_slist_find_index(zk_slist *list, size_t const index);
 
 void zk_slist_for_each(zk_slist *begin, zk_slist *const end, zk_for_each_func const func, void *const user_data);
 
+void zk_slist_for_each_batch(zk_slist *begin,
+                             zk_slist *const end,
+                             zk_for_each_batch_func const func,
+                             void *const user_data);
+
+zk_slist *zk_slist_for_each_until(zk_slist *begin,
+                                  zk_slist *const end,
+                                  zk_for_each_until_func const func,
+                                  void *const user_data);
+
+zk_status zk_slist_for_each_parallel(zk_slist *begin,
+                                     zk_slist *const end,
+                                     zk_for_each_func const func,
+                                     void *const *const user_data,
+                                     size_t const threads);
+
 void zk_slist_free(zk_slist **list_p, zk_destructor_t const func);
 
+void zk_slist_free_arena(zk_slist **list_p, zk_destructor_t const func, zk_arena **arena_p);
+
+zk_status zk_slist_free_async(zk_slist **list_p, zk_destructor_t const func);
+
+bool zk_slist_free_budget(zk_slist **list_p, zk_destructor_t const func, zk_budget const budget);
+
 zk_slist *zk_slist_merge(zk_slist *list, zk_slist *other, zk_compare_func const func);
 
 zk_slist *zk_slist_new_node(void *const data);
 
+zk_slist *zk_slist_new_node_arena(void *const data, zk_arena *const arena);
+
 zk_slist *zk_slist_pop_back(zk_slist *list, zk_destructor_t const func);
 
 zk_slist *zk_slist_pop_front(zk_slist *list, zk_destructor_t const func);
 
 zk_slist *zk_slist_push_back(zk_slist *list, void *const data);
 
+zk_slist *zk_slist_push_back_arena(zk_slist *list, void *const data, zk_arena *const arena);
+
+zk_slist *zk_slist_push_back_bloom(zk_slist *list, void *const data, zk_bloom *const bloom);
+
 zk_slist *zk_slist_push_front(zk_slist *list, void *const data);
 
+zk_slist *zk_slist_push_front_arena(zk_slist *list, void *const data, zk_arena *const arena);
+
+zk_slist *zk_slist_push_front_bloom(zk_slist *list, void *const data, zk_bloom *const bloom);
+
+zk_status zk_slist_rebuild_bloom(const zk_slist *const list, zk_bloom *const bloom);
+
+zk_status zk_slist_reserve(size_t const count);
+
 zk_slist *zk_slist_reverse(zk_slist *list);
 
 size_t zk_slist_size(const zk_slist *const list);
 
 zk_slist *zk_slist_sort(zk_slist *list, zk_compare_func const func);
+
+// Inline iteration
+
+/**
+ * @brief Iterates over every node of the list as a plain pointer loop, without calling through function pointers.
+ *
+ * @param NODE A `zk_slist *` variable that points to each node in turn.
+ * @param LIST The list to iterate.
+ */
+#define ZK_SLIST_FOREACH(NODE, LIST)                 \
+	for ((NODE) = _zk_slist_foreach_first(LIST); \
+	     (NODE) != NULL;                         \
+	     (NODE) = _zk_slist_foreach_next(LIST, NODE))
+
+/**
+ * @brief Same as ZK_SLIST_FOREACH() but the loop body may unlink and free NODE.
+ *
+ * @param NODE A `zk_slist *` variable that points to each node in turn.
+ * @param TMP A `zk_slist *` variable used to hold the next node.
+ * @param LIST The list to iterate.
+ */
+#define ZK_SLIST_FOREACH_SAFE(NODE, TMP, LIST)                                  \
+	for ((NODE) = _zk_slist_foreach_first(LIST);                            \
+	     (NODE) != NULL && ((TMP) = _zk_slist_foreach_next(LIST, NODE), 1); \
+	     (NODE) = (TMP))
+
+static inline zk_slist *_zk_slist_foreach_first(zk_slist *list)
+{
+	return list;
+}
+
+static inline zk_slist *_zk_slist_foreach_next(const zk_slist *const list, zk_slist *node)
+{
+	ZK_UNUSED(list);
+	return node->next;
+}
+
+/**
+ * @brief Returns an iterator on the first element of the list, see zk_iter.
+ */
+static inline zk_iter zk_slist_iter(zk_slist *list)
+{
+	return zk_iter_new(list, NULL);
+}
@@ -0,0 +1,244 @@
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "zk_spsc_queue/zk_spsc_queue.h"
+
+/*
+ * `tail` is only written by the producer and `head` only by the consumer. They count elements from the creation of the
+ * queue and are masked to index the ring, so the size is always tail - head. Each side keeps a private copy of the
+ * other side's index and only reloads it when the copy says the ring is full (producer) or empty (consumer), which
+ * keeps the two cache lines from bouncing between the cores on every operation.
+ */
+
+/**
+ * @brief SPSC queue. Producer and consumer state live on separate cache lines, the read-only part on a third one.
+ */
+struct zk_spsc_queue {
+	_Alignas(ZK_CACHE_LINE) size_t tail; // written by the producer
+	size_t head_cache; // producer's copy of head
+	_Alignas(ZK_CACHE_LINE) size_t head; // written by the consumer
+	size_t tail_cache; // consumer's copy of tail
+	_Alignas(ZK_CACHE_LINE) size_t mask;
+	void **slots;
+};
+
+// Private functions
+static size_t zk_spsc_queue_round_up_pow2(size_t n)
+{
+	size_t p = 1;
+	while (p < n)
+		p *= 2;
+	return p;
+}
+
+// Constructor
+
+/**
+ * @brief Creates an empty queue holding up to `capacity` elements, rounded up to a power of two.
+ *
+ * @param queue_p Pointer to the queue to create.
+ * @param capacity Minimum number of elements the queue can hold. Must be greater than 0.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if arguments are invalid or ZK_ERROR_ALLOC on allocation failure.
+ */
+zk_status zk_spsc_queue_new(zk_spsc_queue **queue_p, size_t const capacity)
+{
+	if (queue_p == NULL || capacity == 0 || capacity > SIZE_MAX / 2 / sizeof(void *))
+		return ZK_INVALID_ARGUMENT;
+
+	zk_spsc_queue *queue = aligned_alloc(ZK_CACHE_LINE, sizeof(zk_spsc_queue));
+	if (queue == NULL)
+		return ZK_ERROR_ALLOC;
+
+	size_t const size = zk_spsc_queue_round_up_pow2(capacity);
+	queue->slots = malloc(size * sizeof(void *));
+	if (queue->slots == NULL) {
+		free(queue);
+		return ZK_ERROR_ALLOC;
+	}
+	queue->tail = 0;
+	queue->head_cache = 0;
+	queue->head = 0;
+	queue->tail_cache = 0;
+	queue->mask = size - 1;
+
+	*queue_p = queue;
+	return ZK_OK;
+}
+
+// Destructor
+
+/**
+ * @brief Frees the queue. Must not run concurrently with the producer or the consumer.
+ *
+ * @param queue_p Pointer to the queue. It is set to NULL after the queue is freed.
+ * @param func Pointer to the destructor applied to the data left in the queue. If NULL, the data is not freed.
+ */
+void zk_spsc_queue_free(zk_spsc_queue **queue_p, zk_destructor_t const func)
+{
+	if (queue_p != NULL && *queue_p != NULL) {
+		zk_spsc_queue *queue = *queue_p;
+		if (func != NULL) {
+			for (size_t i = queue->head; i != queue->tail; i++)
+				func(queue->slots[i & queue->mask]);
+		}
+		free(queue->slots);
+		free(queue);
+		*queue_p = NULL;
+	}
+}
+
+// Element access
+
+/**
+ * @brief Reads the element at the front of the queue without removing it.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if arguments are invalid or the queue is empty.
+ *
+ * @note Consumer side.
+ */
+zk_status zk_spsc_queue_front(const zk_spsc_queue *const queue, void **data)
+{
+	if (queue == NULL || data == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	size_t const head = queue->head;
+	if (head == __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE))
+		return ZK_INVALID_ARGUMENT;
+
+	*data = queue->slots[head & queue->mask];
+	return ZK_OK;
+}
+
+// Capacity
+size_t zk_spsc_queue_capacity(const zk_spsc_queue *const queue)
+{
+	return queue != NULL ? queue->mask + 1 : 0;
+}
+
+/**
+ * @brief Returns the number of elements in the queue. While the other side runs the value may be stale by the time it
+ *        is used.
+ */
+size_t zk_spsc_queue_size(const zk_spsc_queue *const queue)
+{
+	if (queue == NULL)
+		return 0;
+	size_t const head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+	return __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE) - head;
+}
+
+// Modifiers
+
+/**
+ * @brief Removes up to `count` elements from the front of the queue and stores them in `data`, in FIFO order.
+ *
+ * @return The number of elements removed, 0 if the queue is empty.
+ *
+ * @note Consumer side. The consumer index is published once for the whole batch.
+ */
+size_t zk_spsc_queue_dequeue_batch(zk_spsc_queue *const queue, void **const data, size_t const count)
+{
+	if (queue == NULL || data == NULL)
+		return 0;
+
+	size_t const head = queue->head;
+	size_t available = queue->tail_cache - head;
+	if (available < count) {
+		queue->tail_cache = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+		available = queue->tail_cache - head;
+	}
+
+	size_t const n = available < count ? available : count;
+	for (size_t i = 0; i < n; i++)
+		data[i] = queue->slots[(head + i) & queue->mask];
+	__atomic_store_n(&queue->head, head + n, __ATOMIC_RELEASE);
+	return n;
+}
+
+/**
+ * @brief Removes the element at the front of the queue.
+ *
+ * @return true if an element was removed and stored in `data_p`, false if the queue is empty.
+ *
+ * @note Consumer side.
+ */
+bool zk_spsc_queue_dequeue(zk_spsc_queue *const queue, void **const data_p)
+{
+	return zk_spsc_queue_dequeue_batch(queue, data_p, 1) == 1;
+}
+
+/**
+ * @brief Adds up to `count` elements from `data` at the back of the queue, in order.
+ *
+ * @return The number of elements added, less than `count` if the queue became full.
+ *
+ * @note Producer side. The producer index is published once for the whole batch.
+ */
+size_t zk_spsc_queue_enqueue_batch(zk_spsc_queue *const queue, void *const *const data, size_t const count)
+{
+	if (queue == NULL || data == NULL)
+		return 0;
+
+	size_t const tail = queue->tail;
+	size_t const capacity = queue->mask + 1;
+	size_t available = capacity - (tail - queue->head_cache);
+	if (available < count) {
+		queue->head_cache = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+		available = capacity - (tail - queue->head_cache);
+	}
+
+	size_t const n = available < count ? available : count;
+	for (size_t i = 0; i < n; i++)
+		queue->slots[(tail + i) & queue->mask] = data[i];
+	__atomic_store_n(&queue->tail, tail + n, __ATOMIC_RELEASE);
+	return n;
+}
+
+/**
+ * @brief Adds `data` at the back of the queue.
+ *
+ * @return true if the element was added, false if the queue is full.
+ *
+ * @note Producer side.
+ */
+bool zk_spsc_queue_enqueue(zk_spsc_queue *const queue, void *const data)
+{
+	return zk_spsc_queue_enqueue_batch(queue, &data, 1) == 1;
+}
+
+/**
+ * @brief Removes the element at the front of the queue, like the pop_front of the lists.
+ *
+ * @param queue The queue.
+ * @param func Pointer to the destructor applied to the removed data. If NULL, the data is not freed.
+ *
+ * @return ZK_OK on success, also when the queue is empty, or ZK_INVALID_ARGUMENT if `queue` is NULL.
+ *
+ * @note Consumer side.
+ */
+zk_status zk_spsc_queue_pop_front(zk_spsc_queue *const queue, zk_destructor_t const func)
+{
+	if (queue == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	void *data;
+	if (zk_spsc_queue_dequeue(queue, &data) && func != NULL)
+		func(data);
+	return ZK_OK;
+}
+
+/**
+ * @brief Adds `data` at the back of the queue, like the push_back of the lists.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if `queue` is NULL or ZK_ERROR_FULL if the queue is full.
+ *
+ * @note Producer side.
+ */
+zk_status zk_spsc_queue_push_back(zk_spsc_queue *const queue, void *const data)
+{
+	if (queue == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	return zk_spsc_queue_enqueue(queue, data) ? ZK_OK : ZK_ERROR_FULL;
+}
@@ -0,0 +1,41 @@
+#ifndef ZK_SPSC_QUEUE_H
+#define ZK_SPSC_QUEUE_H
+
+#include <stddef.h>
+
+#include "zk_common/zk_common.h"
+
+/**
+ * @brief Bounded single-producer single-consumer FIFO queue of `void *`, backed by a ring buffer. One thread may push
+ *        while another one pops, without locks or allocation.
+ */
+typedef struct zk_spsc_queue zk_spsc_queue;
+
+// Constructor
+zk_status zk_spsc_queue_new(zk_spsc_queue **queue_p, size_t const capacity);
+
+// Destructor
+void zk_spsc_queue_free(zk_spsc_queue **queue_p, zk_destructor_t const func);
+
+// Element access
+zk_status zk_spsc_queue_front(const zk_spsc_queue *const queue, void **data);
+
+// Capacity
+size_t zk_spsc_queue_capacity(const zk_spsc_queue *const queue);
+
+size_t zk_spsc_queue_size(const zk_spsc_queue *const queue);
+
+// Modifiers
+bool zk_spsc_queue_dequeue(zk_spsc_queue *const queue, void **const data_p);
+
+size_t zk_spsc_queue_dequeue_batch(zk_spsc_queue *const queue, void **const data, size_t const count);
+
+bool zk_spsc_queue_enqueue(zk_spsc_queue *const queue, void *const data);
+
+size_t zk_spsc_queue_enqueue_batch(zk_spsc_queue *const queue, void *const *const data, size_t const count);
+
+zk_status zk_spsc_queue_pop_front(zk_spsc_queue *const queue, zk_destructor_t const func);
+
+zk_status zk_spsc_queue_push_back(zk_spsc_queue *const queue, void *const data);
+
+#endif
@@ -0,0 +1,152 @@
+#include "zk_view/zk_view.h"
+
+// Private functions
+static zk_view *zk_view_add_stage(zk_view *const view, struct zk_view_stage const stage)
+{
+	if (view != NULL && view->status == ZK_OK) {
+		if (view->count == ZK_VIEW_MAX_STAGES)
+			view->status = ZK_INVALID_ARGUMENT;
+		else
+			view->stages[view->count++] = stage;
+	}
+	return view;
+}
+
+// Constructor
+
+/**
+ * @brief Creates a view with no stage over the elements of `source`. zk_view_of() builds one from a container.
+ */
+zk_view zk_view_new(zk_iter const source)
+{
+	return (zk_view){ .source = source, .status = ZK_OK, .done = false, .count = 0 };
+}
+
+// Stages
+
+/**
+ * @brief Appends a stage that only lets through the elements for which `func` returns true.
+ *
+ * @return The view, so stages can be chained. A NULL `func` makes the view invalid.
+ */
+zk_view *zk_view_filter(zk_view *const view, zk_predicate_func const func, void *const user_data)
+{
+	if (view != NULL && func == NULL)
+		view->status = ZK_INVALID_ARGUMENT;
+	return zk_view_add_stage(view,
+	                         (struct zk_view_stage){ .kind = ZK_VIEW_FILTER, .filter = func, .user_data = user_data });
+}
+
+/**
+ * @brief Appends a stage that replaces every element with the pointer returned by `func`. The container is not
+ *        modified, the result is only seen by the following stages and the consumer.
+ *
+ * @return The view, so stages can be chained. A NULL `func` makes the view invalid.
+ */
+zk_view *zk_view_map(zk_view *const view, zk_map_func const func, void *const user_data)
+{
+	if (view != NULL && func == NULL)
+		view->status = ZK_INVALID_ARGUMENT;
+	return zk_view_add_stage(view, (struct zk_view_stage){ .kind = ZK_VIEW_MAP, .map = func, .user_data = user_data });
+}
+
+/**
+ * @brief Appends a stage that drops the first `n` elements reaching it.
+ */
+zk_view *zk_view_skip(zk_view *const view, size_t const n)
+{
+	return zk_view_add_stage(view, (struct zk_view_stage){ .kind = ZK_VIEW_SKIP, .remaining = n });
+}
+
+/**
+ * @brief Appends a stage that lets through at most `n` elements. Once they passed the traversal ends, the rest of the
+ *        source is never visited.
+ */
+zk_view *zk_view_take(zk_view *const view, size_t const n)
+{
+	if (view != NULL && n == 0)
+		view->done = true;
+	return zk_view_add_stage(view, (struct zk_view_stage){ .kind = ZK_VIEW_TAKE, .remaining = n });
+}
+
+// Consumers
+
+/**
+ * @brief Produces the next element of the view.
+ *
+ * @param view The view to advance.
+ * @param data_p Set to the element produced.
+ *
+ * @return true if an element was produced, false once the view is exhausted or if it is invalid.
+ *
+ * @note Time complexity: O(k * s) where k is the number of source elements visited and s the number of stages.
+ */
+bool zk_view_next(zk_view *const view, void **const data_p)
+{
+	if (view == NULL || data_p == NULL || view->status != ZK_OK)
+		return false;
+
+	while (!view->done && zk_iter_valid(view->source)) {
+		void *data = zk_iter_data(view->source);
+		view->source = zk_iter_next(view->source);
+
+		bool pass = true;
+		for (size_t i = 0; pass && i < view->count; i++) {
+			struct zk_view_stage *const stage = &view->stages[i];
+			switch (stage->kind) {
+			case ZK_VIEW_FILTER:
+				pass = stage->filter(data, stage->user_data);
+				break;
+			case ZK_VIEW_MAP:
+				data = stage->map(data, stage->user_data);
+				break;
+			case ZK_VIEW_SKIP:
+				if (stage->remaining > 0) {
+					stage->remaining--;
+					pass = false;
+				}
+				break;
+			case ZK_VIEW_TAKE:
+				// no later element can pass this stage once it is exhausted
+				if (--stage->remaining == 0)
+					view->done = true;
+				break;
+			}
+		}
+
+		if (pass) {
+			*data_p = data;
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Consumes the view, applying `func` to each element it produces.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if the view or `func` is invalid.
+ */
+zk_status zk_view_for_each(zk_view *const view, zk_for_each_func const func, void *const user_data)
+{
+	if (view == NULL || func == NULL || view->status != ZK_OK)
+		return ZK_INVALID_ARGUMENT;
+
+	void *data;
+	while (zk_view_next(view, &data))
+		func(data, user_data);
+
+	return ZK_OK;
+}
+
+/**
+ * @brief Consumes the view and returns the number of elements it produced, 0 if the view is invalid.
+ */
+size_t zk_view_count(zk_view *const view)
+{
+	size_t count = 0;
+	void *data;
+	while (zk_view_next(view, &data))
+		count++;
+	return count;
+}
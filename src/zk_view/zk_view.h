@@ -0,0 +1,75 @@
+#ifndef ZK_VIEW_H
+#define ZK_VIEW_H
+
+#include <stddef.h>
+
+#include "zk_common/zk_common.h"
+#include "zk_iter/zk_iter.h"
+
+/**
+ * Maximum number of stages a view can chain. Adding more makes the view invalid.
+ */
+#ifndef ZK_VIEW_MAX_STAGES
+#define ZK_VIEW_MAX_STAGES 8
+#endif
+
+enum zk_view_stage_kind {
+	ZK_VIEW_FILTER,
+	ZK_VIEW_MAP,
+	ZK_VIEW_SKIP,
+	ZK_VIEW_TAKE,
+};
+
+/**
+ * @brief One stage of a view pipeline.
+ */
+struct zk_view_stage {
+	enum zk_view_stage_kind kind;
+	union {
+		zk_predicate_func filter;
+		zk_map_func map;
+		size_t remaining; // elements left to skip or to take
+	};
+	void *user_data;
+};
+
+/**
+ * @brief Lazy pipeline over a container. Stages are recorded when the view is built and only run while the view is
+ *        consumed, in a single traversal of the source that does not allocate. A view is single pass: consuming it
+ *        advances its source, build a new one to traverse the container again.
+ *
+ * @code
+ * zk_view view = zk_view_of(list);
+ * zk_view_take(zk_view_map(zk_view_filter(&view, is_even, NULL), square, NULL), 10);
+ * zk_view_for_each(&view, print, NULL);
+ * @endcode
+ */
+struct zk_view {
+	zk_iter source;
+	zk_status status;
+	bool done;
+	size_t count;
+	struct zk_view_stage stages[ZK_VIEW_MAX_STAGES];
+};
+typedef struct zk_view zk_view;
+
+// Constructor
+zk_view zk_view_new(zk_iter const source);
+
+// Stages
+zk_view *zk_view_filter(zk_view *const view, zk_predicate_func const func, void *const user_data);
+
+zk_view *zk_view_map(zk_view *const view, zk_map_func const func, void *const user_data);
+
+zk_view *zk_view_skip(zk_view *const view, size_t const n);
+
+zk_view *zk_view_take(zk_view *const view, size_t const n);
+
+// Consumers
+size_t zk_view_count(zk_view *const view);
+
+zk_status zk_view_for_each(zk_view *const view, zk_for_each_func const func, void *const user_data);
+
+bool zk_view_next(zk_view *const view, void **const data_p);
+
+#endif
@@ -0,0 +1,249 @@
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "zk_ebr/zk_ebr.h"
+#include "zk_ws_deque/zk_ws_deque.h"
+
+/*
+ * Chase-Lev deque, with the memory orders of Le et al., "Correct and Efficient Work-Stealing for Weak Memory Models".
+ * `top` and `bottom` count elements since the creation of the deque and index a circular buffer. The owner works at
+ * the bottom without compare and swap, except to race the thieves for the last element. Thieves claim the top element
+ * with a compare and swap on `top`.
+ *
+ * When the buffer is full the owner copies it into one twice as large. Thieves may still read the old buffer, so it
+ * is retired through zk_ebr and thieves steal inside a critical section. The owner never needs one: only the owner
+ * replaces the buffer.
+ *
+ * The fences of the paper are expressed with sequentially consistent loads and stores, which also lets
+ * ThreadSanitizer check the deque.
+ */
+
+/**
+ * @brief Circular buffer. Slots are read by thieves while the owner writes other slots, through atomic builtins.
+ */
+struct zk_ws_deque_buffer {
+	size_t mask;
+	zk_ebr_node ebr;
+	void *slots[];
+};
+
+/**
+ * @brief Work-stealing deque. `top` is written by thieves and `bottom` by the owner, each gets its own cache line.
+ */
+struct zk_ws_deque {
+	_Alignas(ZK_CACHE_LINE) int64_t top;
+	_Alignas(ZK_CACHE_LINE) int64_t bottom;
+	struct zk_ws_deque_buffer *buffer;
+};
+
+// Private functions
+static struct zk_ws_deque_buffer *zk_ws_deque_buffer_new(size_t const size)
+{
+	struct zk_ws_deque_buffer *buffer = malloc(sizeof(struct zk_ws_deque_buffer) + size * sizeof(void *));
+	if (buffer != NULL)
+		buffer->mask = size - 1;
+	return buffer;
+}
+
+static void zk_ws_deque_buffer_free(void *ebr)
+{
+	free(ZK_EBR_ENTRY(ebr, struct zk_ws_deque_buffer, ebr));
+}
+
+static void *zk_ws_deque_get(struct zk_ws_deque_buffer *const buffer, int64_t const i)
+{
+	return __atomic_load_n(&buffer->slots[(size_t)i & buffer->mask], __ATOMIC_RELAXED);
+}
+
+static void zk_ws_deque_put(struct zk_ws_deque_buffer *const buffer, int64_t const i, void *const data)
+{
+	__atomic_store_n(&buffer->slots[(size_t)i & buffer->mask], data, __ATOMIC_RELAXED);
+}
+
+// Owner side: replaces the buffer with one twice as large holding the elements in [top, bottom).
+static struct zk_ws_deque_buffer *zk_ws_deque_grow(zk_ws_deque *const deque,
+                                                   struct zk_ws_deque_buffer *const buffer,
+                                                   int64_t const top,
+                                                   int64_t const bottom)
+{
+	size_t const size = buffer->mask + 1;
+	if (size > SIZE_MAX / 2 / sizeof(void *))
+		return NULL;
+
+	struct zk_ws_deque_buffer *grown = zk_ws_deque_buffer_new(2 * size);
+	if (grown == NULL)
+		return NULL;
+	for (int64_t i = top; i < bottom; i++)
+		zk_ws_deque_put(grown, i, zk_ws_deque_get(buffer, i));
+	__atomic_store_n(&deque->buffer, grown, __ATOMIC_RELEASE);
+	zk_ebr_retire(&buffer->ebr, zk_ws_deque_buffer_free);
+	return grown;
+}
+
+// Constructor
+
+/**
+ * @brief Creates an empty deque.
+ *
+ * @param deque_p Pointer to the deque to create.
+ * @param capacity Initial number of elements the deque holds before growing, rounded up to a power of two. Must be
+ *                 greater than 0.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if arguments are invalid or ZK_ERROR_ALLOC on allocation failure.
+ */
+zk_status zk_ws_deque_new(zk_ws_deque **deque_p, size_t const capacity)
+{
+	if (deque_p == NULL || capacity == 0 || capacity > SIZE_MAX / 4 / sizeof(void *))
+		return ZK_INVALID_ARGUMENT;
+
+	zk_ws_deque *deque = aligned_alloc(ZK_CACHE_LINE, sizeof(zk_ws_deque));
+	if (deque == NULL)
+		return ZK_ERROR_ALLOC;
+
+	size_t size = 1;
+	while (size < capacity)
+		size *= 2;
+	deque->buffer = zk_ws_deque_buffer_new(size);
+	if (deque->buffer == NULL) {
+		free(deque);
+		return ZK_ERROR_ALLOC;
+	}
+	deque->top = 0;
+	deque->bottom = 0;
+
+	*deque_p = deque;
+	return ZK_OK;
+}
+
+// Destructor
+
+/**
+ * @brief Frees the deque. Must not run concurrently with other operations on the deque. Also waits for the buffers
+ *        replaced by the calling thread to be reclaimed, see zk_ebr_barrier().
+ *
+ * @param deque_p Pointer to the deque. It is set to NULL after the deque is freed.
+ * @param func Pointer to the destructor applied to the data left in the deque. If NULL, the data is not freed.
+ */
+void zk_ws_deque_free(zk_ws_deque **deque_p, zk_destructor_t const func)
+{
+	if (deque_p == NULL || *deque_p == NULL)
+		return;
+
+	zk_ws_deque *deque = *deque_p;
+	if (func != NULL) {
+		for (int64_t i = deque->top; i < deque->bottom; i++)
+			func(zk_ws_deque_get(deque->buffer, i));
+	}
+	free(deque->buffer);
+	free(deque);
+	*deque_p = NULL;
+	zk_ebr_barrier();
+}
+
+// Capacity
+
+/**
+ * @brief Returns the number of elements in the deque. While other threads use the deque the value may be stale by the
+ *        time it is used.
+ */
+size_t zk_ws_deque_size(const zk_ws_deque *const deque)
+{
+	if (deque == NULL)
+		return 0;
+	int64_t const top = __atomic_load_n(&deque->top, __ATOMIC_ACQUIRE);
+	int64_t const bottom = __atomic_load_n(&deque->bottom, __ATOMIC_ACQUIRE);
+	return bottom > top ? (size_t)(bottom - top) : 0;
+}
+
+// Modifiers
+
+/**
+ * @brief Removes the element at the bottom of the deque, the one pushed last.
+ *
+ * @return true if an element was removed and stored in `data_p`, false if the deque is empty.
+ *
+ * @note Owner side only.
+ */
+bool zk_ws_deque_pop_bottom(zk_ws_deque *const deque, void **const data_p)
+{
+	if (deque == NULL || data_p == NULL)
+		return false;
+
+	int64_t const bottom = __atomic_load_n(&deque->bottom, __ATOMIC_RELAXED) - 1;
+	struct zk_ws_deque_buffer *buffer = __atomic_load_n(&deque->buffer, __ATOMIC_RELAXED);
+	// the new bottom must be visible to the thieves before top is read
+	__atomic_store_n(&deque->bottom, bottom, __ATOMIC_SEQ_CST);
+	int64_t top = __atomic_load_n(&deque->top, __ATOMIC_SEQ_CST);
+
+	if (top > bottom) {
+		__atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+		return false;
+	}
+
+	void *data = zk_ws_deque_get(buffer, bottom);
+	if (top == bottom) {
+		// last element, race the thieves for it
+		bool const won = __atomic_compare_exchange_n(&deque->top, &top, top + 1, false, __ATOMIC_SEQ_CST,
+		                                             __ATOMIC_RELAXED);
+		__atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+		if (!won)
+			return false;
+	}
+	*data_p = data;
+	return true;
+}
+
+/**
+ * @brief Adds `data` at the bottom of the deque, growing its buffer if it is full.
+ *
+ * @return ZK_OK on success, ZK_INVALID_ARGUMENT if `deque` is NULL or ZK_ERROR_ALLOC if the buffer cannot grow.
+ *
+ * @note Owner side only.
+ */
+zk_status zk_ws_deque_push_bottom(zk_ws_deque *const deque, void *const data)
+{
+	if (deque == NULL)
+		return ZK_INVALID_ARGUMENT;
+
+	int64_t const bottom = __atomic_load_n(&deque->bottom, __ATOMIC_RELAXED);
+	int64_t const top = __atomic_load_n(&deque->top, __ATOMIC_ACQUIRE);
+	struct zk_ws_deque_buffer *buffer = __atomic_load_n(&deque->buffer, __ATOMIC_RELAXED);
+
+	if ((size_t)(bottom - top) > buffer->mask) {
+		buffer = zk_ws_deque_grow(deque, buffer, top, bottom);
+		if (buffer == NULL)
+			return ZK_ERROR_ALLOC;
+	}
+	zk_ws_deque_put(buffer, bottom, data);
+	__atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELEASE);
+	return ZK_OK;
+}
+
+/**
+ * @brief Removes the element at the top of the deque, the oldest one.
+ *
+ * @return true if an element was removed and stored in `data_p`, false if the deque is empty or another thread took
+ *         the top element first. Schedulers usually move on to another victim in both cases.
+ *
+ * @note Any thread other than the owner.
+ */
+bool zk_ws_deque_steal(zk_ws_deque *const deque, void **const data_p)
+{
+	if (deque == NULL || data_p == NULL)
+		return false;
+
+	zk_ebr_enter();
+	int64_t top = __atomic_load_n(&deque->top, __ATOMIC_SEQ_CST);
+	int64_t const bottom = __atomic_load_n(&deque->bottom, __ATOMIC_SEQ_CST);
+	bool stolen = false;
+	if (top < bottom) {
+		struct zk_ws_deque_buffer *buffer = __atomic_load_n(&deque->buffer, __ATOMIC_ACQUIRE);
+		void *data = zk_ws_deque_get(buffer, top);
+		stolen = __atomic_compare_exchange_n(&deque->top, &top, top + 1, false, __ATOMIC_SEQ_CST,
+		                                     __ATOMIC_RELAXED);
+		if (stolen)
+			*data_p = data;
+	}
+	zk_ebr_exit();
+	return stolen;
+}
@@ -0,0 +1,30 @@
+#ifndef ZK_WS_DEQUE_H
+#define ZK_WS_DEQUE_H
+
+#include <stddef.h>
+
+#include "zk_common/zk_common.h"
+
+/**
+ * @brief Work-stealing deque (Chase-Lev deque) of `void *`. Its owner thread pushes and pops at the bottom, like a
+ *        stack, while any other thread may steal from the top. Grows as needed.
+ */
+typedef struct zk_ws_deque zk_ws_deque;
+
+// Constructor
+zk_status zk_ws_deque_new(zk_ws_deque **deque_p, size_t const capacity);
+
+// Destructor
+void zk_ws_deque_free(zk_ws_deque **deque_p, zk_destructor_t const func);
+
+// Capacity
+size_t zk_ws_deque_size(const zk_ws_deque *const deque);
+
+// Modifiers
+bool zk_ws_deque_pop_bottom(zk_ws_deque *const deque, void **const data_p);
+
+zk_status zk_ws_deque_push_bottom(zk_ws_deque *const deque, void *const data);
+
+bool zk_ws_deque_steal(zk_ws_deque *const deque, void **const data_p);
+
+#endif
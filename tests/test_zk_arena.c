@@ -0,0 +1,103 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "unity.h"
+#include "zk/zklib.h"
+
+void setUp(void)
+{
+	// set stuff up here
+}
+
+void tearDown(void)
+{
+	// clean stuff up here
+}
+
+/*--------------- Test Constructor ---------------*/
+void test_zk_arena_new_when_arguments_are_invalid(void)
+{
+	zk_arena *arena = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_arena_new(NULL, 1024));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_arena_new(&arena, 0));
+	TEST_ASSERT_NULL(arena);
+	TEST_ASSERT_EQUAL(ZK_ERROR_ALLOC, zk_arena_new(&arena, SIZE_MAX));
+	TEST_ASSERT_NULL(arena);
+}
+
+void test_zk_arena_new_rounds_up_to_huge_pages(void)
+{
+	zk_arena *arena = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_arena_new(&arena, 1));
+	TEST_ASSERT_TRUE(zk_arena_capacity(arena) >= 1);
+	TEST_ASSERT_TRUE(zk_arena_capacity(arena) < ZK_ARENA_HUGE_PAGE_SIZE);
+	TEST_ASSERT_EQUAL(0, zk_arena_size(arena));
+	TEST_ASSERT_TRUE(zk_arena_get_pages(arena) <= ZK_ARENA_PAGES_DEFAULT);
+
+	zk_arena_free(&arena);
+	TEST_ASSERT_NULL(arena);
+	zk_arena_free(&arena);
+	zk_arena_free(NULL);
+}
+
+/*--------------- Test Allocation ---------------*/
+void test_zk_arena_alloc_is_contiguous_and_aligned(void)
+{
+	zk_arena *arena = NULL;
+	TEST_ASSERT_EQUAL(ZK_OK, zk_arena_new(&arena, 1024));
+
+	unsigned char *first = zk_arena_alloc(arena, 16);
+	unsigned char *second = zk_arena_alloc(arena, 1);
+	unsigned char *third = zk_arena_alloc(arena, 24);
+	TEST_ASSERT_NOT_NULL(first);
+	TEST_ASSERT_EQUAL_PTR(first + 16, second);
+	TEST_ASSERT_EQUAL_PTR(second + _Alignof(max_align_t), third);
+	TEST_ASSERT_EQUAL(0, (uintptr_t)third % _Alignof(max_align_t));
+	memset(third, 0xff, 24);
+
+	TEST_ASSERT_TRUE(zk_arena_contains(arena, first));
+	TEST_ASSERT_TRUE(zk_arena_contains(arena, third + 23));
+	TEST_ASSERT_FALSE(zk_arena_contains(arena, &arena));
+	TEST_ASSERT_FALSE(zk_arena_contains(NULL, first));
+
+	TEST_ASSERT_NULL(zk_arena_alloc(arena, 0));
+	TEST_ASSERT_NULL(zk_arena_alloc(NULL, 16));
+
+	zk_arena_free(&arena);
+}
+
+void test_zk_arena_alloc_until_full(void)
+{
+	zk_arena *arena = NULL;
+	TEST_ASSERT_EQUAL(ZK_OK, zk_arena_new(&arena, 1024));
+
+	size_t const capacity = zk_arena_capacity(arena);
+	size_t count = 0;
+	unsigned char *node;
+	while ((node = zk_arena_alloc(arena, 16)) != NULL) {
+		node[15] = 1;
+		count++;
+	}
+	TEST_ASSERT_EQUAL(capacity / 16, count);
+	TEST_ASSERT_EQUAL(capacity, zk_arena_size(arena));
+	TEST_ASSERT_NULL(zk_arena_alloc(arena, 1));
+
+	zk_arena_free(&arena);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+
+	/*--------------- Test Constructor ---------------*/
+	RUN_TEST(test_zk_arena_new_when_arguments_are_invalid);
+	RUN_TEST(test_zk_arena_new_rounds_up_to_huge_pages);
+
+	/*--------------- Test Allocation ---------------*/
+	RUN_TEST(test_zk_arena_alloc_is_contiguous_and_aligned);
+	RUN_TEST(test_zk_arena_alloc_until_full);
+
+	return UNITY_END();
+}
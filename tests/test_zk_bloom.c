@@ -0,0 +1,151 @@
+#include <stdlib.h>
+
+#include "unity.h"
+#include "zk_bloom/zk_bloom.h"
+
+void setUp(void)
+{
+	// set stuff up here
+}
+
+void tearDown(void)
+{
+	// clean stuff up here
+}
+
+static size_t hash_int(const void *const data)
+{
+	return (size_t)*(const int *)data * 2654435761u;
+}
+
+/*--------------- Test Constructor ---------------*/
+void test_zk_bloom_new_when_arguments_are_invalid(void)
+{
+	zk_bloom *bloom = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_bloom_new(NULL, 10, 0.01, hash_int));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_bloom_new(&bloom, 0, 0.01, hash_int));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_bloom_new(&bloom, 10, 0.0, hash_int));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_bloom_new(&bloom, 10, 1.0, hash_int));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_bloom_new(&bloom, 10, 0.01, NULL));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_bloom_new_with_size(&bloom, 4, 10, hash_int));
+	TEST_ASSERT_NULL(bloom);
+}
+
+void test_zk_bloom_new_sizes_filter_for_fp_rate(void)
+{
+	zk_bloom *bloom = NULL;
+	zk_bloom_stats stats;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_bloom_new(&bloom, 1000, 0.01, hash_int));
+	TEST_ASSERT_EQUAL(ZK_OK, zk_bloom_get_stats(bloom, &stats));
+
+	TEST_ASSERT_EQUAL(1000, stats.capacity);
+	TEST_ASSERT_EQUAL(0, stats.count);
+	// 1000 elements at 1% need at least 9586 bits, rounded up to a power of two
+	TEST_ASSERT_EQUAL(16384, stats.bits);
+	TEST_ASSERT_EQUAL(2048, stats.bytes);
+	TEST_ASSERT(stats.hashes >= 7);
+	TEST_ASSERT(stats.fp_rate <= 0.01);
+	TEST_ASSERT(stats.estimated_fp_rate == 0.0);
+
+	zk_bloom_free(&bloom);
+	TEST_ASSERT_NULL(bloom);
+}
+
+void test_zk_bloom_new_with_size_respects_memory_budget(void)
+{
+	zk_bloom *bloom = NULL;
+	zk_bloom_stats stats;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_bloom_new_with_size(&bloom, 1000, 1000, hash_int));
+	TEST_ASSERT_EQUAL(ZK_OK, zk_bloom_get_stats(bloom, &stats));
+
+	TEST_ASSERT_EQUAL(512, stats.bytes);
+	TEST_ASSERT_EQUAL(4096, stats.bits);
+	TEST_ASSERT_EQUAL(3, stats.hashes);
+	TEST_ASSERT(stats.fp_rate > 0.1 && stats.fp_rate < 0.2);
+
+	zk_bloom_free(&bloom);
+}
+
+/*--------------- Test Lookup ---------------*/
+void test_zk_bloom_contains_has_no_false_negatives(void)
+{
+	zk_bloom *bloom = NULL;
+	int data[500];
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_bloom_new(&bloom, 500, 0.01, hash_int));
+	for (int i = 0; i < 500; i++) {
+		data[i] = i * 3;
+		TEST_ASSERT_EQUAL(ZK_OK, zk_bloom_add(bloom, &data[i]));
+	}
+
+	for (int i = 0; i < 500; i++)
+		TEST_ASSERT(zk_bloom_contains(bloom, &data[i]));
+
+	zk_bloom_free(&bloom);
+}
+
+void test_zk_bloom_contains_false_positive_rate_is_close_to_target(void)
+{
+	zk_bloom *bloom = NULL;
+	zk_bloom_stats stats;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_bloom_new(&bloom, 1000, 0.01, hash_int));
+	for (int i = 0; i < 1000; i++)
+		zk_bloom_add(bloom, &i);
+
+	int false_positives = 0;
+	for (int i = 1000; i < 11000; i++)
+		false_positives += zk_bloom_contains(bloom, &i);
+
+	TEST_ASSERT(false_positives < 200);
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_bloom_get_stats(bloom, &stats));
+	TEST_ASSERT_EQUAL(1000, stats.count);
+	TEST_ASSERT(stats.estimated_fp_rate > 0.0 && stats.estimated_fp_rate < 0.02);
+
+	zk_bloom_free(&bloom);
+}
+
+void test_zk_bloom_contains_when_bloom_is_null(void)
+{
+	int data = 1;
+	TEST_ASSERT(zk_bloom_contains(NULL, &data));
+}
+
+/*--------------- Test Modifiers ---------------*/
+void test_zk_bloom_clear(void)
+{
+	zk_bloom *bloom = NULL;
+	zk_bloom_stats stats;
+	int data = 42;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_bloom_new(&bloom, 10, 0.01, hash_int));
+	TEST_ASSERT_EQUAL(ZK_OK, zk_bloom_add(bloom, &data));
+	TEST_ASSERT(zk_bloom_contains(bloom, &data));
+
+	zk_bloom_clear(bloom);
+	TEST_ASSERT(!zk_bloom_contains(bloom, &data));
+	TEST_ASSERT_EQUAL(ZK_OK, zk_bloom_get_stats(bloom, &stats));
+	TEST_ASSERT_EQUAL(0, stats.count);
+
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_bloom_add(NULL, &data));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_bloom_get_stats(NULL, &stats));
+
+	zk_bloom_free(&bloom);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_zk_bloom_new_when_arguments_are_invalid);
+	RUN_TEST(test_zk_bloom_new_sizes_filter_for_fp_rate);
+	RUN_TEST(test_zk_bloom_new_with_size_respects_memory_budget);
+	RUN_TEST(test_zk_bloom_contains_has_no_false_negatives);
+	RUN_TEST(test_zk_bloom_contains_false_positive_rate_is_close_to_target);
+	RUN_TEST(test_zk_bloom_contains_when_bloom_is_null);
+	RUN_TEST(test_zk_bloom_clear);
+	return UNITY_END();
+}
@@ -0,0 +1,213 @@
+#include <stdlib.h>
+
+#include "unity.h"
+#include "zk/zklib.h"
+
+#define N_ELEMENTS 100
+
+void setUp(void)
+{
+	// set stuff up here
+}
+
+void tearDown(void)
+{
+	// clean stuff up here
+}
+
+static int ints[N_ELEMENTS];
+
+static void add_int(void *data, void *user_data)
+{
+	*(int64_t *)user_data += *(int *)data;
+}
+
+static int compare_int(const void *const a, const void *const b)
+{
+	int const x = *(const int *)a;
+	int const y = *(const int *)b;
+	return (x > y) - (x < y);
+}
+
+static void count_freed(void *data)
+{
+	(*(size_t *)data)++;
+}
+
+static size_t count_nodes(zk_iter it)
+{
+	size_t count = 0;
+	for (; zk_iter_valid(it); it = zk_iter_next(it))
+		count++;
+	return count;
+}
+
+/*--------------- Test Iterators ---------------*/
+void test_zk_iter_for_each_budget_when_arguments_are_invalid(void)
+{
+	zk_slist *list = zk_slist_push_back(NULL, &ints[0]);
+	zk_iter cursor = zk_iter_begin(list);
+	int64_t sum = 0;
+
+	TEST_ASSERT_TRUE(zk_iter_for_each_budget(NULL, add_int, &sum, (zk_budget){ 0 }));
+	TEST_ASSERT_TRUE(zk_iter_for_each_budget(&cursor, NULL, &sum, (zk_budget){ 0 }));
+	TEST_ASSERT_EQUAL_PTR(list, zk_iter_node(cursor));
+
+	cursor = zk_iter_begin((zk_slist *)NULL);
+	TEST_ASSERT_TRUE(zk_iter_for_each_budget(&cursor, add_int, &sum, (zk_budget){ .nodes = 1 }));
+	TEST_ASSERT_EQUAL(0, sum);
+
+	zk_slist_free(&list, NULL);
+}
+
+void test_zk_iter_for_each_budget_resumes_over_zk_slist(void)
+{
+	zk_slist *list = NULL;
+	for (int i = 0; i < N_ELEMENTS; i++)
+		list = zk_slist_push_front(list, &ints[i]);
+
+	zk_iter cursor = zk_iter_begin(list);
+	int64_t sum = 0;
+	size_t calls = 0;
+	while (!zk_iter_for_each_budget(&cursor, add_int, &sum, (zk_budget){ .nodes = 7 })) {
+		calls++;
+		TEST_ASSERT_EQUAL(N_ELEMENTS - calls * 7, count_nodes(cursor));
+	}
+	TEST_ASSERT_EQUAL(N_ELEMENTS / 7, calls);
+	TEST_ASSERT_FALSE(zk_iter_valid(cursor));
+	TEST_ASSERT_EQUAL(zk_sum_int(list), sum);
+
+	zk_slist_free(&list, NULL);
+}
+
+void test_zk_iter_for_each_budget_resumes_over_zk_c_dlist(void)
+{
+	zk_c_dlist *list = NULL;
+	for (int i = 0; i < N_ELEMENTS; i++)
+		zk_c_dlist_push_back(&list, &ints[i]);
+
+	// one call covering the whole lap, then several calls, must see every element once
+	zk_iter cursor = zk_iter_begin(list);
+	int64_t sum = 0;
+	TEST_ASSERT_TRUE(zk_iter_for_each_budget(&cursor, add_int, &sum, (zk_budget){ .nodes = N_ELEMENTS }));
+	TEST_ASSERT_EQUAL(zk_sum_int(list), sum);
+
+	cursor = zk_iter_begin(list);
+	sum = 0;
+	size_t calls = 1;
+	while (!zk_iter_for_each_budget(&cursor, add_int, &sum, (zk_budget){ .nodes = 30 }))
+		calls++;
+	TEST_ASSERT_EQUAL(4, calls);
+	TEST_ASSERT_EQUAL(zk_sum_int(list), sum);
+
+	zk_c_dlist_free(&list, NULL);
+}
+
+void test_zk_iter_for_each_budget_with_time_limit(void)
+{
+	zk_dlist *list = NULL;
+	for (int i = 0; i < N_ELEMENTS; i++)
+		zk_dlist_push_back(&list, &ints[i]);
+
+	zk_iter cursor = zk_iter_begin(list);
+	int64_t sum = 0;
+	// every call visits at least one node, so a 1 ns budget still completes
+	while (!zk_iter_for_each_budget(&cursor, add_int, &sum, (zk_budget){ .ns = 1 }))
+		;
+	TEST_ASSERT_EQUAL(zk_sum_int(list), sum);
+
+	cursor = zk_iter_begin(list);
+	sum = 0;
+	TEST_ASSERT_TRUE(zk_iter_for_each_budget(&cursor, add_int, &sum, (zk_budget){ .ns = UINT64_C(1000000000) }));
+	TEST_ASSERT_EQUAL(zk_sum_int(list), sum);
+
+	zk_dlist_free(&list, NULL);
+}
+
+/*--------------- Test Lookup ---------------*/
+void test_zk_iter_find_budget_over_zk_c_slist(void)
+{
+	zk_c_slist *list = NULL;
+	for (int i = 0; i < N_ELEMENTS; i++)
+		zk_c_slist_push_back(&list, &ints[i % 10]);
+
+	// every value appears 10 times, resuming after each match finds all of them
+	int const key = 3;
+	size_t matches = 0;
+	size_t calls = 0;
+	zk_iter cursor = zk_iter_begin(list);
+	for (;;) {
+		calls++;
+		if (!zk_iter_find_budget(&cursor, &key, compare_int, (zk_budget){ .nodes = 4 }))
+			continue;
+		if (!zk_iter_valid(cursor))
+			break;
+		TEST_ASSERT_EQUAL(key, *(int *)zk_iter_data(cursor));
+		matches++;
+		cursor = zk_iter_next(cursor);
+	}
+	TEST_ASSERT_EQUAL(10, matches);
+	TEST_ASSERT_TRUE(calls > N_ELEMENTS / 4);
+
+	int const missing = -1;
+	cursor = zk_iter_begin(list);
+	TEST_ASSERT_TRUE(zk_iter_find_budget(&cursor, &missing, compare_int, (zk_budget){ 0 }));
+	TEST_ASSERT_FALSE(zk_iter_valid(cursor));
+	TEST_ASSERT_TRUE(zk_iter_find_budget(NULL, &missing, compare_int, (zk_budget){ 0 }));
+
+	zk_c_slist_free(&list, NULL);
+}
+
+/*--------------- Test Destructor ---------------*/
+void test_zk_free_budget_over_every_list(void)
+{
+	zk_dlist *dlist = NULL;
+	zk_c_slist *c_slist = NULL;
+	zk_c_dlist *c_dlist = NULL;
+	size_t freed[3] = { 0, 0, 0 };
+
+	for (int i = 0; i < N_ELEMENTS; i++) {
+		zk_dlist_push_back(&dlist, &freed[0]);
+		zk_c_slist_push_back(&c_slist, &freed[1]);
+		zk_c_dlist_push_back(&c_dlist, &freed[2]);
+	}
+
+	for (size_t step = 1; step <= 10; step++) {
+		bool const done = step == 10;
+		TEST_ASSERT_EQUAL(done, zk_free_budget(&dlist, count_freed, (zk_budget){ .nodes = 10 }));
+		TEST_ASSERT_EQUAL(done, zk_free_budget(&c_slist, count_freed, (zk_budget){ .nodes = 10 }));
+		TEST_ASSERT_EQUAL(done, zk_free_budget(&c_dlist, count_freed, (zk_budget){ .nodes = 10 }));
+		for (size_t i = 0; i < 3; i++)
+			TEST_ASSERT_EQUAL(step * 10, freed[i]);
+		// the lists left are still valid lists
+		TEST_ASSERT_EQUAL(N_ELEMENTS - step * 10, count_nodes(zk_iter_begin(dlist)));
+		TEST_ASSERT_EQUAL(N_ELEMENTS - step * 10, count_nodes(zk_iter_begin(c_slist)));
+		TEST_ASSERT_EQUAL(N_ELEMENTS - step * 10, count_nodes(zk_iter_begin(c_dlist)));
+	}
+	TEST_ASSERT_NULL(dlist);
+	TEST_ASSERT_NULL(c_slist);
+	TEST_ASSERT_NULL(c_dlist);
+	TEST_ASSERT_TRUE(zk_free_budget((zk_dlist **)NULL, NULL, (zk_budget){ 0 }));
+}
+
+int main(void)
+{
+	for (int i = 0; i < N_ELEMENTS; i++)
+		ints[i] = i;
+
+	UNITY_BEGIN();
+
+	/*--------------- Test Iterators ---------------*/
+	RUN_TEST(test_zk_iter_for_each_budget_when_arguments_are_invalid);
+	RUN_TEST(test_zk_iter_for_each_budget_resumes_over_zk_slist);
+	RUN_TEST(test_zk_iter_for_each_budget_resumes_over_zk_c_dlist);
+	RUN_TEST(test_zk_iter_for_each_budget_with_time_limit);
+
+	/*--------------- Test Lookup ---------------*/
+	RUN_TEST(test_zk_iter_find_budget_over_zk_c_slist);
+
+	/*--------------- Test Destructor ---------------*/
+	RUN_TEST(test_zk_free_budget_over_every_list);
+
+	return UNITY_END();
+}
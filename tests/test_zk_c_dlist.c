@@ -4,6 +4,7 @@
 #include "common/test_common.h"
 #include "unity.h"
 #include "zk/zklib.h"
+#include "zk_node_cache/zk_node_cache.h"
 
 void setUp(void)
 {
@@ -58,6 +59,23 @@ void test_zk_c_dlist_new_node_when_data_is_not_null(void)
 	free(list);
 }
 
+// tests for zk_c_dlist_reserve()
+void test_zk_c_dlist_reserve_serves_the_next_pushes(void)
+{
+	zk_c_dlist *list = NULL;
+	int data = 0;
+
+	zk_node_cache_trim();
+	TEST_ASSERT_EQUAL(ZK_OK, zk_c_dlist_reserve(16));
+	TEST_ASSERT_EQUAL(16, zk_node_cache_reserved(sizeof(zk_c_dlist)));
+	for (int i = 0; i < 16; i++)
+		TEST_ASSERT_EQUAL(ZK_OK, zk_c_dlist_push_back(&list, &data));
+	TEST_ASSERT_EQUAL(0, zk_node_cache_reserved(sizeof(zk_c_dlist)));
+
+	zk_c_dlist_free(&list, NULL);
+	zk_node_cache_trim();
+}
+
 /*--------------- Test Destructor ---------------*/
 // tests for zk_free()
 void test_zk_free_a_null_list_should_just_return(void)
@@ -105,6 +123,31 @@ void test_zk_free_for_a_null_list_should_just_return(void)
 	TEST_ASSERT_NULL(list);
 }
 
+// tests for zk_free_async()
+void test_zk_free_async_for_list_of_strings(void)
+{
+	int number_of_nodes = 100;
+	zk_c_dlist *list = NULL;
+
+	for (int i = 0; i < number_of_nodes; i++) {
+		zk_push_back(&list, strdup("a"));
+		TEST_ASSERT_NOT_NULL(list);
+	}
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_free_async(&list, free));
+	TEST_ASSERT_NULL(list);
+	zk_reclaim_flush();
+	TEST_ASSERT_EQUAL(0, zk_reclaim_pending());
+}
+
+void test_zk_free_async_for_a_null_list_should_just_return(void)
+{
+	zk_c_dlist *list = NULL;
+	TEST_ASSERT_EQUAL(ZK_OK, zk_free_async(&list, free));
+	TEST_ASSERT_NULL(list);
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_free_async((zk_c_dlist **)NULL, free));
+}
+
 /*--------------- Test Iterators ---------------*/
 
 // tests for for zk_begin()
@@ -259,6 +302,371 @@ void test_zk_for_each_when_func_is_not_null(void)
 	TEST_ASSERT_NULL(list);
 }
 
+// tests for ZK_FOREACH() and ZK_FOREACH_SAFE()
+void test_zk_foreach_macro_when_list_is_null(void)
+{
+	zk_c_dlist *list = NULL;
+	zk_c_dlist *node = NULL;
+	zk_c_dlist *tmp = NULL;
+	int visited = 0;
+
+	ZK_C_DLIST_FOREACH(node, list)
+	{
+		visited++;
+	}
+	ZK_FOREACH(node, list)
+	{
+		visited++;
+	}
+	ZK_FOREACH_SAFE(node, tmp, list)
+	{
+		visited++;
+	}
+
+	TEST_ASSERT_EQUAL(0, visited);
+}
+
+void test_zk_foreach_macro_visits_elements_in_order(void)
+{
+	zk_c_dlist *list = NULL;
+	zk_c_dlist *node = NULL;
+	int nodes_data[] = { 1, 2, 3, 4, 5 };
+
+	// single element list
+	TEST_ASSERT_EQUAL(ZK_OK, zk_push_back(&list, &nodes_data[0]));
+	int i = 0;
+	ZK_FOREACH(node, list)
+	{
+		TEST_ASSERT_EQUAL_PTR(&nodes_data[i], node->data);
+		i++;
+	}
+	TEST_ASSERT_EQUAL(1, i);
+
+	for (i = 1; i < 5; i++) {
+		TEST_ASSERT_EQUAL(ZK_OK, zk_push_back(&list, &nodes_data[i]));
+	}
+
+	i = 0;
+	ZK_C_DLIST_FOREACH(node, list)
+	{
+		TEST_ASSERT_EQUAL_PTR(&nodes_data[i], node->data);
+		i++;
+	}
+	TEST_ASSERT_EQUAL(5, i);
+
+	int sum = 0;
+	ZK_FOREACH(node, list)
+	{
+		sum += *(int *)node->data;
+	}
+	TEST_ASSERT_EQUAL(15, sum);
+
+	zk_free(&list, NULL);
+}
+
+void test_zk_foreach_safe_macro_frees_nodes(void)
+{
+	zk_c_dlist *list = NULL;
+	zk_c_dlist *node = NULL;
+	zk_c_dlist *tmp = NULL;
+
+	for (int i = 0; i < 5; i++) {
+		struct dummy_node_data *node_data = malloc(sizeof(struct dummy_node_data));
+		node_data->value = i;
+		node_data->string = strdup("node");
+		TEST_ASSERT_EQUAL(ZK_OK, zk_push_back(&list, node_data));
+	}
+
+	int freed = 0;
+	ZK_C_DLIST_FOREACH_SAFE(node, tmp, list)
+	{
+		dummy_node_data_free(node->data);
+		free(node);
+		freed++;
+	}
+	TEST_ASSERT_EQUAL(5, freed);
+}
+
+void test_zk_foreach_safe_macro_pops_front(void)
+{
+	zk_c_dlist *list = NULL;
+	zk_c_dlist *node = NULL;
+	zk_c_dlist *tmp = NULL;
+	int nodes_data[] = { 1, 2, 3, 4, 5 };
+
+	for (int i = 0; i < 5; i++) {
+		TEST_ASSERT_EQUAL(ZK_OK, zk_push_back(&list, &nodes_data[i]));
+	}
+
+	int i = 0;
+	ZK_FOREACH_SAFE(node, tmp, list)
+	{
+		TEST_ASSERT_EQUAL_PTR(&nodes_data[i], node->data);
+		TEST_ASSERT_EQUAL(ZK_OK, zk_pop_front(&list, NULL));
+		i++;
+	}
+	TEST_ASSERT_EQUAL(5, i);
+	TEST_ASSERT_NULL(list);
+}
+
+// tests for zk_for_each_batch()
+struct batch_stats {
+	size_t calls;
+	size_t elements;
+	size_t largest;
+	int next;
+	bool in_order;
+};
+
+static void batch_stats_update(void **data, size_t const count, void *user_data)
+{
+	struct batch_stats *stats = user_data;
+	stats->calls++;
+	stats->elements += count;
+	if (count > stats->largest)
+		stats->largest = count;
+	for (size_t i = 0; i < count; i++) {
+		stats->in_order = stats->in_order && *(int *)data[i] == stats->next;
+		stats->next++;
+	}
+}
+
+void test_zk_for_each_batch_when_list_is_null(void)
+{
+	zk_c_dlist *list = NULL;
+	struct batch_stats stats = { .in_order = true };
+
+	zk_for_each_batch(list, batch_stats_update, &stats);
+
+	TEST_ASSERT_EQUAL(0, stats.calls);
+}
+
+void test_zk_for_each_batch_when_func_is_null(void)
+{
+	zk_c_dlist *list = NULL;
+	int data = 0;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_push_back(&list, &data));
+	zk_for_each_batch(list, NULL, NULL);
+
+	zk_free(&list, NULL);
+}
+
+void test_zk_for_each_batch_when_list_has_one_element(void)
+{
+	zk_c_dlist *list = NULL;
+	struct batch_stats stats = { .in_order = true };
+	int data = 0;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_push_back(&list, &data));
+	zk_for_each_batch(list, batch_stats_update, &stats);
+
+	TEST_ASSERT_EQUAL(1, stats.calls);
+	TEST_ASSERT_EQUAL(1, stats.elements);
+	TEST_ASSERT_TRUE(stats.in_order);
+
+	zk_free(&list, NULL);
+}
+
+void test_zk_for_each_batch_when_list_has_n_elements(void)
+{
+	// sizes around the batch boundary, including one where the last element starts a new batch
+	size_t const sizes[] = { ZK_BATCH_SIZE - 1, ZK_BATCH_SIZE, ZK_BATCH_SIZE + 1, 2 * ZK_BATCH_SIZE + 3 };
+	int data[2 * ZK_BATCH_SIZE + 3];
+
+	for (size_t i = 0; i < 2 * ZK_BATCH_SIZE + 3; i++)
+		data[i] = (int)i;
+
+	for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+		zk_c_dlist *list = NULL;
+		struct batch_stats stats = { .in_order = true };
+
+		for (size_t i = 0; i < sizes[s]; i++)
+			TEST_ASSERT_EQUAL(ZK_OK, zk_push_back(&list, &data[i]));
+
+		zk_for_each_batch(list, batch_stats_update, &stats);
+
+		TEST_ASSERT_EQUAL((sizes[s] + ZK_BATCH_SIZE - 1) / ZK_BATCH_SIZE, stats.calls);
+		TEST_ASSERT_EQUAL(sizes[s], stats.elements);
+		TEST_ASSERT_TRUE(stats.largest <= ZK_BATCH_SIZE);
+		TEST_ASSERT_TRUE(stats.in_order);
+
+		zk_free(&list, NULL);
+	}
+}
+
+// tests for zk_for_each_until()
+struct until_search {
+	int target;
+	size_t visited;
+};
+
+static zk_iteration until_stop_at_target(void *data, void *user_data)
+{
+	struct until_search *search = user_data;
+	search->visited++;
+	return *(int *)data == search->target ? ZK_STOP : ZK_CONTINUE;
+}
+
+void test_zk_for_each_until_when_list_is_null(void)
+{
+	zk_c_dlist *list = NULL;
+	struct until_search search = { .target = 0 };
+
+	TEST_ASSERT_NULL(zk_for_each_until(list, until_stop_at_target, &search));
+	TEST_ASSERT_EQUAL(0, search.visited);
+}
+
+void test_zk_for_each_until_when_func_is_null(void)
+{
+	zk_c_dlist *list = NULL;
+	int data = 0;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_push_back(&list, &data));
+	TEST_ASSERT_NULL(zk_for_each_until(list, NULL, NULL));
+
+	zk_free(&list, NULL);
+}
+
+void test_zk_for_each_until_stops_early(void)
+{
+	zk_c_dlist *list = NULL;
+	int data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	struct until_search search = { .target = 3 };
+
+	for (int i = 0; i < 10; i++)
+		TEST_ASSERT_EQUAL(ZK_OK, zk_push_back(&list, &data[i]));
+
+	zk_c_dlist *node = zk_for_each_until(list, until_stop_at_target, &search);
+
+	TEST_ASSERT_NOT_NULL(node);
+	TEST_ASSERT_EQUAL_PTR(&data[3], node->data);
+	TEST_ASSERT_EQUAL(4, search.visited);
+
+	zk_free(&list, NULL);
+}
+
+void test_zk_for_each_until_stops_at_last_element(void)
+{
+	zk_c_dlist *list = NULL;
+	int data[] = { 0, 1, 2, 3, 4 };
+	struct until_search search = { .target = 4 };
+
+	for (int i = 0; i < 5; i++)
+		TEST_ASSERT_EQUAL(ZK_OK, zk_push_back(&list, &data[i]));
+
+	zk_c_dlist *node = zk_for_each_until(list, until_stop_at_target, &search);
+
+	TEST_ASSERT_NOT_NULL(node);
+	TEST_ASSERT_EQUAL_PTR(&data[4], node->data);
+	TEST_ASSERT_EQUAL(5, search.visited);
+
+	search.target = -1;
+	search.visited = 0;
+	TEST_ASSERT_NULL(zk_for_each_until(list, until_stop_at_target, &search));
+	TEST_ASSERT_EQUAL(5, search.visited);
+
+	zk_free(&list, NULL);
+}
+
+// tests for zk_find_if(), zk_count_if() and zk_find_all()
+static int predicate_calls = 0;
+
+static bool is_multiple_of(const void *const data, void *user_data)
+{
+	predicate_calls++;
+	return *(const int *)data % *(int *)user_data == 0;
+}
+
+void test_zk_find_if_when_list_is_null(void)
+{
+	zk_c_dlist *list = NULL;
+	int divisor = 2;
+
+	TEST_ASSERT_NULL(zk_find_if(list, is_multiple_of, &divisor));
+	TEST_ASSERT_EQUAL(0, zk_count_if(list, is_multiple_of, &divisor));
+}
+
+void test_zk_find_if_stops_at_first_match(void)
+{
+	zk_c_dlist *list = NULL;
+	int nodes_data[] = { 1, 3, 4, 5, 6 };
+	void *data = NULL;
+
+	for (int i = 0; i < 5; i++) {
+		TEST_ASSERT_EQUAL(ZK_OK, zk_push_back(&list, &nodes_data[i]));
+	}
+
+	int divisor = 2;
+	predicate_calls = 0;
+	zk_c_dlist *found = zk_find_if(list, is_multiple_of, &divisor);
+	TEST_ASSERT_NOT_NULL(found);
+	TEST_ASSERT_EQUAL(ZK_OK, zk_get_data(found, &data));
+	TEST_ASSERT_EQUAL_PTR(&nodes_data[2], data);
+	TEST_ASSERT_EQUAL(3, predicate_calls);
+
+	// last element is checked too
+	divisor = 6;
+	found = zk_find_if(list, is_multiple_of, &divisor);
+	TEST_ASSERT_NOT_NULL(found);
+	TEST_ASSERT_EQUAL(ZK_OK, zk_get_data(found, &data));
+	TEST_ASSERT_EQUAL_PTR(&nodes_data[4], data);
+
+	divisor = 7;
+	TEST_ASSERT_NULL(zk_find_if(list, is_multiple_of, &divisor));
+	TEST_ASSERT_NULL(zk_find_if(list, NULL, &divisor));
+
+	zk_free(&list, NULL);
+}
+
+void test_zk_count_if_when_list_has_n_elements(void)
+{
+	zk_c_dlist *list = NULL;
+	int nodes_data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+
+	for (int i = 0; i < 11; i++) {
+		TEST_ASSERT_EQUAL(ZK_OK, zk_push_back(&list, &nodes_data[i]));
+	}
+
+	int divisor = 2;
+	TEST_ASSERT_EQUAL(6, zk_count_if(list, is_multiple_of, &divisor));
+	divisor = 5;
+	TEST_ASSERT_EQUAL(3, zk_count_if(list, is_multiple_of, &divisor));
+	TEST_ASSERT_EQUAL(0, zk_count_if(list, NULL, &divisor));
+
+	zk_free(&list, NULL);
+}
+
+void test_zk_find_all_when_list_has_n_elements(void)
+{
+	zk_c_dlist *list = NULL;
+	zk_c_dlist **nodes = NULL;
+	size_t capacity = 0, count = 0;
+	int nodes_data[30];
+	void *data = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_find_all(list, NULL, NULL, &nodes, &capacity, &count));
+	TEST_ASSERT_EQUAL(ZK_OK, zk_find_all(list, is_multiple_of, NULL, &nodes, &capacity, &count));
+	TEST_ASSERT_EQUAL(0, count);
+
+	for (int i = 0; i < 30; i++) {
+		nodes_data[i] = i;
+		TEST_ASSERT_EQUAL(ZK_OK, zk_push_back(&list, &nodes_data[i]));
+	}
+
+	int divisor = 3;
+	TEST_ASSERT_EQUAL(ZK_OK, zk_find_all(list, is_multiple_of, &divisor, &nodes, &capacity, &count));
+	TEST_ASSERT_EQUAL(10, count);
+	TEST_ASSERT(capacity >= count);
+	for (size_t i = 0; i < count; i++) {
+		TEST_ASSERT_EQUAL(ZK_OK, zk_get_data(nodes[i], &data));
+		TEST_ASSERT_EQUAL_PTR(&nodes_data[i * 3], data);
+	}
+
+	free(nodes);
+	zk_free(&list, NULL);
+}
+
 /*--------------- Test Modifiers ---------------*/
 // tests for zk_pop_back()
 
@@ -911,6 +1319,10 @@ int main(void)
 		RUN_TEST(test_zk_c_dlist_new_node_when_data_is_not_null);
 	}
 
+	{ // tests for zk_c_dlist_reserve()
+		RUN_TEST(test_zk_c_dlist_reserve_serves_the_next_pushes);
+	}
+
 	/*--------------- Test Destructor ---------------*/
 
 	{ // tests for zk_free()
@@ -920,6 +1332,11 @@ int main(void)
 		RUN_TEST(test_zk_free_for_a_null_list_should_just_return);
 	}
 
+	{ // tests for zk_free_async()
+		RUN_TEST(test_zk_free_async_for_list_of_strings);
+		RUN_TEST(test_zk_free_async_for_a_null_list_should_just_return);
+	}
+
 	// /*--------------- Test Iterators ---------------*/
 
 	{ // tests for zk_begin()
@@ -940,6 +1357,34 @@ int main(void)
 		RUN_TEST(test_zk_for_each_when_func_is_not_null);
 	}
 
+	{ // tests for ZK_FOREACH() and ZK_FOREACH_SAFE()
+		RUN_TEST(test_zk_foreach_macro_when_list_is_null);
+		RUN_TEST(test_zk_foreach_macro_visits_elements_in_order);
+		RUN_TEST(test_zk_foreach_safe_macro_frees_nodes);
+		RUN_TEST(test_zk_foreach_safe_macro_pops_front);
+	}
+
+	{ // tests for zk_for_each_batch()
+		RUN_TEST(test_zk_for_each_batch_when_list_is_null);
+		RUN_TEST(test_zk_for_each_batch_when_func_is_null);
+		RUN_TEST(test_zk_for_each_batch_when_list_has_one_element);
+		RUN_TEST(test_zk_for_each_batch_when_list_has_n_elements);
+	}
+
+	{ // tests for zk_for_each_until()
+		RUN_TEST(test_zk_for_each_until_when_list_is_null);
+		RUN_TEST(test_zk_for_each_until_when_func_is_null);
+		RUN_TEST(test_zk_for_each_until_stops_early);
+		RUN_TEST(test_zk_for_each_until_stops_at_last_element);
+	}
+
+	{ // tests for zk_find_if(), zk_count_if() and zk_find_all()
+		RUN_TEST(test_zk_find_if_when_list_is_null);
+		RUN_TEST(test_zk_find_if_stops_at_first_match);
+		RUN_TEST(test_zk_count_if_when_list_has_n_elements);
+		RUN_TEST(test_zk_find_all_when_list_has_n_elements);
+	}
+
 	// /*--------------- Test Modifiers ---------------*/
 
 	{ // tests for zk_pop_back()
@@ -0,0 +1,233 @@
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "zk_ebr/zk_ebr.h"
+
+#define N_READERS 3
+#define N_SWAPS   20000
+#define MAGIC     0x5a5a5a5au
+
+struct object {
+	unsigned magic;
+	zk_ebr_node ebr;
+};
+
+static size_t destroyed;
+
+void setUp(void)
+{
+	// set stuff up here
+	zk_ebr_barrier();
+	__atomic_store_n(&destroyed, 0, __ATOMIC_RELAXED);
+}
+
+void tearDown(void)
+{
+	// clean stuff up here
+}
+
+static void free_object(void *ebr)
+{
+	struct object *object = ZK_EBR_ENTRY(ebr, struct object, ebr);
+	object->magic = 0;
+	free(object);
+	__atomic_fetch_add(&destroyed, 1, __ATOMIC_RELAXED);
+}
+
+static struct object *new_object(void)
+{
+	struct object *object = malloc(sizeof(struct object));
+	object->magic = MAGIC;
+	return object;
+}
+
+/*--------------- Test Reclamation ---------------*/
+void test_zk_ebr_retire_when_arguments_are_invalid(void)
+{
+	zk_ebr_retire(NULL, free_object);
+	TEST_ASSERT_EQUAL(0, zk_ebr_pending());
+
+	// a NULL destructor retires the node without calling anything
+	struct object object = { .magic = MAGIC };
+	zk_ebr_retire(&object.ebr, NULL);
+	zk_ebr_barrier();
+	TEST_ASSERT_EQUAL(0, zk_ebr_pending());
+	TEST_ASSERT_EQUAL(0, destroyed);
+}
+
+void test_zk_ebr_barrier_reclaims_retired_nodes(void)
+{
+	for (int i = 0; i < 5; i++)
+		zk_ebr_retire(&new_object()->ebr, free_object);
+	TEST_ASSERT_EQUAL(5, zk_ebr_pending());
+
+	zk_ebr_barrier();
+	TEST_ASSERT_EQUAL(0, zk_ebr_pending());
+	TEST_ASSERT_EQUAL(5, destroyed);
+}
+
+void test_zk_ebr_critical_section_delays_reclamation(void)
+{
+	zk_ebr_enter();
+	zk_ebr_enter();
+	zk_ebr_retire(&new_object()->ebr, free_object);
+	zk_ebr_exit();
+
+	// still inside the outer critical section: the barrier cannot wait and nothing is reclaimed
+	zk_ebr_barrier();
+	zk_ebr_collect();
+	TEST_ASSERT_EQUAL(1, zk_ebr_pending());
+	TEST_ASSERT_EQUAL(0, destroyed);
+
+	zk_ebr_exit();
+	zk_ebr_barrier();
+	TEST_ASSERT_EQUAL(0, zk_ebr_pending());
+	TEST_ASSERT_EQUAL(1, destroyed);
+}
+
+void test_zk_ebr_garbage_is_bounded(void)
+{
+	size_t max_pending = 0;
+
+	for (size_t i = 0; i < 20 * ZK_EBR_THRESHOLD; i++) {
+		zk_ebr_retire(&new_object()->ebr, free_object);
+		if (zk_ebr_pending() > max_pending)
+			max_pending = zk_ebr_pending();
+	}
+	TEST_ASSERT_TRUE(max_pending <= 3 * ZK_EBR_THRESHOLD);
+
+	zk_ebr_barrier();
+	TEST_ASSERT_EQUAL(20 * ZK_EBR_THRESHOLD, destroyed);
+}
+
+struct blocker {
+	bool entered;
+	bool release;
+};
+
+static void *block_reclamation(void *arg)
+{
+	struct blocker *blocker = arg;
+	zk_ebr_enter();
+	__atomic_store_n(&blocker->entered, true, __ATOMIC_RELEASE);
+	while (!__atomic_load_n(&blocker->release, __ATOMIC_ACQUIRE))
+		sched_yield();
+	zk_ebr_exit();
+	return NULL;
+}
+
+void test_zk_ebr_reader_of_other_thread_delays_reclamation(void)
+{
+	struct blocker blocker = { false, false };
+	pthread_t thread;
+
+	pthread_create(&thread, NULL, block_reclamation, &blocker);
+	while (!__atomic_load_n(&blocker.entered, __ATOMIC_ACQUIRE))
+		sched_yield();
+
+	for (size_t i = 0; i < 4 * ZK_EBR_THRESHOLD; i++)
+		zk_ebr_retire(&new_object()->ebr, free_object);
+	zk_ebr_collect();
+	TEST_ASSERT_EQUAL(0, destroyed);
+	TEST_ASSERT_EQUAL(4 * ZK_EBR_THRESHOLD, zk_ebr_pending());
+
+	__atomic_store_n(&blocker.release, true, __ATOMIC_RELEASE);
+	pthread_join(thread, NULL);
+	zk_ebr_barrier();
+	TEST_ASSERT_EQUAL(4 * ZK_EBR_THRESHOLD, destroyed);
+}
+
+static void *retire_and_exit(void *arg)
+{
+	ZK_UNUSED(arg);
+	for (int i = 0; i < 10; i++)
+		zk_ebr_retire(&new_object()->ebr, free_object);
+	return NULL;
+}
+
+void test_zk_ebr_nodes_of_exited_threads_are_reclaimed(void)
+{
+	pthread_t thread;
+
+	pthread_create(&thread, NULL, retire_and_exit, NULL);
+	pthread_join(thread, NULL);
+
+	zk_ebr_barrier();
+	TEST_ASSERT_EQUAL(10, destroyed);
+}
+
+/*
+ * A writer keeps replacing a shared object and retires the old one while readers check the object they load inside a
+ * critical section. A reclaimed object is poisoned before being freed, and address sanitizer reports any access to it.
+ */
+struct stress_context {
+	struct object *current;
+	bool done;
+	bool valid[N_READERS];
+};
+
+struct stress_reader {
+	struct stress_context *ctx;
+	size_t index;
+};
+
+static void *stress_read(void *arg)
+{
+	struct stress_reader *reader = arg;
+	struct stress_context *ctx = reader->ctx;
+	bool valid = true;
+
+	while (!__atomic_load_n(&ctx->done, __ATOMIC_ACQUIRE)) {
+		zk_ebr_enter();
+		struct object *object = __atomic_load_n(&ctx->current, __ATOMIC_ACQUIRE);
+		for (int i = 0; i < 8; i++)
+			valid &= __atomic_load_n(&object->magic, __ATOMIC_RELAXED) == MAGIC;
+		zk_ebr_exit();
+	}
+	ctx->valid[reader->index] = valid;
+	return NULL;
+}
+
+void test_zk_ebr_concurrent_readers(void)
+{
+	struct stress_context ctx = { .current = new_object(), .done = false };
+	struct stress_reader readers[N_READERS];
+	pthread_t threads[N_READERS];
+
+	for (size_t t = 0; t < N_READERS; t++) {
+		readers[t] = (struct stress_reader){ &ctx, t };
+		pthread_create(&threads[t], NULL, stress_read, &readers[t]);
+	}
+	for (size_t i = 0; i < N_SWAPS; i++) {
+		struct object *old = __atomic_exchange_n(&ctx.current, new_object(), __ATOMIC_ACQ_REL);
+		zk_ebr_retire(&old->ebr, free_object);
+	}
+	__atomic_store_n(&ctx.done, true, __ATOMIC_RELEASE);
+	for (size_t t = 0; t < N_READERS; t++) {
+		pthread_join(threads[t], NULL);
+		TEST_ASSERT_TRUE(ctx.valid[t]);
+	}
+
+	zk_ebr_retire(&ctx.current->ebr, free_object);
+	zk_ebr_barrier();
+	TEST_ASSERT_EQUAL(N_SWAPS + 1, destroyed);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+
+	/*--------------- Test Reclamation ---------------*/
+	RUN_TEST(test_zk_ebr_retire_when_arguments_are_invalid);
+	RUN_TEST(test_zk_ebr_barrier_reclaims_retired_nodes);
+	RUN_TEST(test_zk_ebr_critical_section_delays_reclamation);
+	RUN_TEST(test_zk_ebr_garbage_is_bounded);
+	RUN_TEST(test_zk_ebr_reader_of_other_thread_delays_reclamation);
+	RUN_TEST(test_zk_ebr_nodes_of_exited_threads_are_reclaimed);
+	RUN_TEST(test_zk_ebr_concurrent_readers);
+
+	return UNITY_END();
+}
@@ -0,0 +1,134 @@
+#include <stdlib.h>
+
+#include "unity.h"
+#include "zk/zklib.h"
+
+#define N_ELEMENTS 100
+
+void setUp(void)
+{
+	// set stuff up here
+}
+
+void tearDown(void)
+{
+	// clean stuff up here
+}
+
+static int ints[N_ELEMENTS];
+static double doubles[N_ELEMENTS];
+
+static void *keep_max(void *acc, void *data, void *user_data)
+{
+	ZK_UNUSED(user_data);
+	return acc == NULL || *(int *)data > *(int *)acc ? data : acc;
+}
+
+static int64_t add_scaled(int64_t acc, const void *const data, void *user_data)
+{
+	return acc + *(const int *)data * *(int *)user_data;
+}
+
+static double add_half(double acc, const void *const data, void *user_data)
+{
+	ZK_UNUSED(user_data);
+	return acc + *(const double *)data / 2.0;
+}
+
+/*--------------- Test Reduction ---------------*/
+void test_zk_fold_when_list_is_null(void)
+{
+	zk_slist *slist = NULL;
+	zk_c_dlist *c_dlist = NULL;
+	int init = 42;
+
+	TEST_ASSERT_EQUAL_PTR(&init, zk_fold(slist, &init, keep_max, NULL));
+	TEST_ASSERT_EQUAL(7, zk_fold_int(c_dlist, 7, add_scaled, NULL));
+	TEST_ASSERT(zk_fold_double(slist, 1.5, add_half, NULL) == 1.5);
+	TEST_ASSERT_EQUAL(0, zk_sum_int(slist));
+	TEST_ASSERT(zk_sum_double(c_dlist) == 0.0);
+}
+
+void test_zk_fold_when_func_is_null(void)
+{
+	zk_slist *list = NULL;
+	list = zk_slist_push_back(list, &ints[0]);
+
+	TEST_ASSERT_NULL(zk_fold(list, NULL, NULL, NULL));
+	TEST_ASSERT_EQUAL(3, zk_fold_int(list, 3, NULL, NULL));
+	TEST_ASSERT(zk_fold_double(list, 3.0, NULL, NULL) == 3.0);
+
+	zk_slist_free(&list, NULL);
+}
+
+void test_zk_fold_over_zk_slist(void)
+{
+	zk_slist *list = NULL;
+	for (int i = 0; i < N_ELEMENTS; i++)
+		list = zk_slist_push_front(list, &ints[i]);
+
+	int scale = 2;
+	TEST_ASSERT_EQUAL_PTR(&ints[N_ELEMENTS - 1], zk_fold(list, NULL, keep_max, NULL));
+	TEST_ASSERT_EQUAL(1 + 2 * 4950, zk_fold_int(list, 1, add_scaled, &scale));
+	TEST_ASSERT_EQUAL(4950, zk_sum_int(list));
+
+	zk_slist_free(&list, NULL);
+}
+
+void test_zk_fold_over_zk_dlist(void)
+{
+	zk_dlist *list = NULL;
+	for (int i = 0; i < N_ELEMENTS; i++)
+		TEST_ASSERT_EQUAL(ZK_OK, zk_dlist_push_back(&list, &doubles[i]));
+
+	TEST_ASSERT(zk_fold_double(list, 0.0, add_half, NULL) == 2475.0);
+	TEST_ASSERT(zk_sum_double(list) == 4950.0);
+
+	zk_dlist_free(&list, NULL);
+}
+
+void test_zk_fold_over_zk_c_slist(void)
+{
+	zk_c_slist *list = NULL;
+	for (int i = 0; i < N_ELEMENTS; i++)
+		TEST_ASSERT_EQUAL(ZK_OK, zk_c_slist_push_back(&list, &ints[i]));
+
+	int scale = -1;
+	TEST_ASSERT_EQUAL_PTR(&ints[N_ELEMENTS - 1], zk_fold(list, NULL, keep_max, NULL));
+	TEST_ASSERT_EQUAL(-4950, zk_fold_int(list, 0, add_scaled, &scale));
+	TEST_ASSERT_EQUAL(4950, zk_sum_int(list));
+
+	zk_c_slist_free(&list, NULL);
+}
+
+void test_zk_fold_over_zk_c_dlist(void)
+{
+	zk_c_dlist *list = NULL;
+	for (int i = 0; i < N_ELEMENTS; i++)
+		TEST_ASSERT_EQUAL(ZK_OK, zk_c_dlist_push_front(&list, &doubles[i]));
+
+	TEST_ASSERT(zk_fold_double(list, 1.0, add_half, NULL) == 2476.0);
+	TEST_ASSERT(zk_sum_double(list) == 4950.0);
+
+	zk_c_dlist_free(&list, NULL);
+}
+
+int main(void)
+{
+	for (int i = 0; i < N_ELEMENTS; i++) {
+		ints[i] = i;
+		doubles[i] = i;
+	}
+
+	UNITY_BEGIN();
+
+	/*--------------- Test Reduction ---------------*/
+	RUN_TEST(test_zk_fold_when_list_is_null);
+	RUN_TEST(test_zk_fold_when_func_is_null);
+	RUN_TEST(test_zk_fold_over_zk_slist);
+	RUN_TEST(test_zk_fold_over_zk_dlist);
+	RUN_TEST(test_zk_fold_over_zk_c_slist);
+	RUN_TEST(test_zk_fold_over_zk_c_dlist);
+
+	return UNITY_END();
+}
@@ -0,0 +1,139 @@
+#include <stdlib.h>
+
+#include "unity.h"
+#include "zk/zklib.h"
+
+#define N_ELEMENTS 5
+
+void setUp(void)
+{
+	// set stuff up here
+}
+
+void tearDown(void)
+{
+	// clean stuff up here
+}
+
+static int data[N_ELEMENTS] = { 0, 1, 2, 3, 4 };
+
+// walks the iterator and checks that it yields data[0..n) in order
+static void assert_iter_yields(zk_iter it, size_t const n)
+{
+	size_t i = 0;
+	for (; zk_iter_valid(it); it = zk_iter_next(it)) {
+		TEST_ASSERT_TRUE(i < n);
+		TEST_ASSERT_EQUAL_PTR(&data[i], zk_iter_data(it));
+		i++;
+	}
+	TEST_ASSERT_EQUAL(n, i);
+}
+
+/*--------------- Test Constructor ---------------*/
+void test_zk_iter_begin_when_list_is_null(void)
+{
+	zk_slist *slist = NULL;
+	zk_dlist *dlist = NULL;
+	zk_c_slist *c_slist = NULL;
+	zk_c_dlist *c_dlist = NULL;
+
+	TEST_ASSERT_FALSE(zk_iter_valid(zk_iter_begin(slist)));
+	TEST_ASSERT_FALSE(zk_iter_valid(zk_iter_begin(dlist)));
+	TEST_ASSERT_FALSE(zk_iter_valid(zk_iter_begin(c_slist)));
+	TEST_ASSERT_FALSE(zk_iter_valid(zk_iter_begin(c_dlist)));
+}
+
+/*--------------- Test Iterators ---------------*/
+void test_zk_iter_over_zk_slist(void)
+{
+	for (size_t n = 1; n <= N_ELEMENTS; n++) {
+		zk_slist *list = NULL;
+		for (size_t i = 0; i < n; i++)
+			list = zk_slist_push_back(list, &data[i]);
+
+		zk_iter const it = zk_iter_begin(list);
+		TEST_ASSERT_EQUAL_PTR(list, zk_iter_node(it));
+		assert_iter_yields(it, n);
+
+		zk_slist_free(&list, NULL);
+	}
+}
+
+void test_zk_iter_over_zk_dlist(void)
+{
+	for (size_t n = 1; n <= N_ELEMENTS; n++) {
+		zk_dlist *list = NULL;
+		for (size_t i = 0; i < n; i++)
+			TEST_ASSERT_EQUAL(ZK_OK, zk_dlist_push_back(&list, &data[i]));
+
+		zk_iter const it = zk_iter_begin(list);
+		TEST_ASSERT_EQUAL_PTR(list, zk_iter_node(it));
+		assert_iter_yields(it, n);
+
+		zk_dlist_free(&list, NULL);
+	}
+}
+
+void test_zk_iter_over_zk_c_slist(void)
+{
+	for (size_t n = 1; n <= N_ELEMENTS; n++) {
+		zk_c_slist *list = NULL;
+		for (size_t i = 0; i < n; i++)
+			TEST_ASSERT_EQUAL(ZK_OK, zk_c_slist_push_back(&list, &data[i]));
+
+		zk_iter const it = zk_iter_begin(list);
+		TEST_ASSERT_EQUAL_PTR(zk_c_slist_begin(list), zk_iter_node(it));
+		assert_iter_yields(it, n);
+
+		zk_c_slist_free(&list, NULL);
+	}
+}
+
+void test_zk_iter_over_zk_c_dlist(void)
+{
+	for (size_t n = 1; n <= N_ELEMENTS; n++) {
+		zk_c_dlist *list = NULL;
+		for (size_t i = 0; i < n; i++)
+			TEST_ASSERT_EQUAL(ZK_OK, zk_c_dlist_push_back(&list, &data[i]));
+
+		zk_iter const it = zk_iter_begin(list);
+		TEST_ASSERT_EQUAL_PTR(list, zk_iter_node(it));
+		assert_iter_yields(it, n);
+
+		zk_c_dlist_free(&list, NULL);
+	}
+}
+
+void test_zk_iter_is_a_value(void)
+{
+	zk_c_slist *list = NULL;
+	for (size_t i = 0; i < N_ELEMENTS; i++)
+		TEST_ASSERT_EQUAL(ZK_OK, zk_c_slist_push_back(&list, &data[i]));
+
+	zk_iter const first = zk_iter_begin(list);
+	zk_iter const second = zk_iter_next(first);
+
+	// advancing returns a new iterator and leaves the original untouched
+	TEST_ASSERT_EQUAL_PTR(&data[0], zk_iter_data(first));
+	TEST_ASSERT_EQUAL_PTR(&data[1], zk_iter_data(second));
+	assert_iter_yields(first, N_ELEMENTS);
+
+	zk_c_slist_free(&list, NULL);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+
+	/*--------------- Test Constructor ---------------*/
+	RUN_TEST(test_zk_iter_begin_when_list_is_null);
+
+	/*--------------- Test Iterators ---------------*/
+	RUN_TEST(test_zk_iter_over_zk_slist);
+	RUN_TEST(test_zk_iter_over_zk_dlist);
+	RUN_TEST(test_zk_iter_over_zk_c_slist);
+	RUN_TEST(test_zk_iter_over_zk_c_dlist);
+	RUN_TEST(test_zk_iter_is_a_value);
+
+	return UNITY_END();
+}
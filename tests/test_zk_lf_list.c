@@ -0,0 +1,301 @@
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "zk_lf_list/zk_lf_list.h"
+
+#define N_THREADS    4
+#define N_KEYS       64
+#define N_OPS_THREAD 20000
+
+void setUp(void)
+{
+	// set stuff up here
+}
+
+void tearDown(void)
+{
+	// clean stuff up here
+}
+
+static int compare_int(const void *const a, const void *const b)
+{
+	int const x = *(const int *)a;
+	int const y = *(const int *)b;
+	return (x > y) - (x < y);
+}
+
+static int compare_key(const void *const a, const void *const b)
+{
+	uintptr_t const x = (uintptr_t)a;
+	uintptr_t const y = (uintptr_t)b;
+	return (x > y) - (x < y);
+}
+
+struct collect {
+	int values[16];
+	size_t count;
+};
+
+static void collect_int(void *data, void *user_data)
+{
+	struct collect *collect = user_data;
+	collect->values[collect->count++] = *(int *)data;
+}
+
+static int *new_int(int const value)
+{
+	int *data = malloc(sizeof(int));
+	*data = value;
+	return data;
+}
+
+/*--------------- Test Constructor ---------------*/
+void test_zk_lf_list_new_when_arguments_are_invalid(void)
+{
+	zk_lf_list *list = NULL;
+	int value = 0;
+
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_lf_list_new(NULL, compare_int, NULL));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_lf_list_new(&list, NULL, NULL));
+	TEST_ASSERT_NULL(list);
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_lf_list_insert(NULL, &value));
+	TEST_ASSERT_FALSE(zk_lf_list_remove(NULL, &value));
+	TEST_ASSERT_FALSE(zk_lf_list_contains(NULL, &value));
+	TEST_ASSERT_EQUAL(0, zk_lf_list_size(NULL));
+	zk_lf_list_for_each(NULL, collect_int, NULL);
+}
+
+void test_zk_lf_list_new_and_free(void)
+{
+	zk_lf_list *list = NULL;
+	int value = 0;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_lf_list_new(&list, compare_int, NULL));
+	TEST_ASSERT_NOT_NULL(list);
+	TEST_ASSERT_EQUAL(0, zk_lf_list_size(list));
+	TEST_ASSERT_FALSE(zk_lf_list_contains(list, &value));
+
+	zk_lf_list_free(&list);
+	TEST_ASSERT_NULL(list);
+	zk_lf_list_free(&list);
+	zk_lf_list_free(NULL);
+}
+
+/*--------------- Test Modifiers ---------------*/
+void test_zk_lf_list_insert_keeps_order_and_rejects_duplicates(void)
+{
+	zk_lf_list *list = NULL;
+	int values[] = { 5, 1, 4, 1, 9, 2, 6 };
+	int const expected[] = { 1, 2, 4, 5, 6, 9 };
+	struct collect collect = { .count = 0 };
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_lf_list_new(&list, compare_int, NULL));
+	for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+		TEST_ASSERT_EQUAL(i == 3 ? ZK_ERROR_EXISTS : ZK_OK, zk_lf_list_insert(list, &values[i]));
+	TEST_ASSERT_EQUAL(6, zk_lf_list_size(list));
+
+	zk_lf_list_for_each(list, collect_int, &collect);
+	TEST_ASSERT_EQUAL(6, collect.count);
+	for (size_t i = 0; i < 6; i++)
+		TEST_ASSERT_EQUAL(expected[i], collect.values[i]);
+
+	zk_lf_list_free(&list);
+}
+
+void test_zk_lf_list_remove(void)
+{
+	zk_lf_list *list = NULL;
+	int values[] = { 3, 1, 2 };
+	int const missing = 7;
+	int const one = 1;
+	int const three = 3;
+	struct collect collect = { .count = 0 };
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_lf_list_new(&list, compare_int, NULL));
+	TEST_ASSERT_FALSE(zk_lf_list_remove(list, &missing));
+	for (size_t i = 0; i < 3; i++)
+		zk_lf_list_insert(list, &values[i]);
+
+	TEST_ASSERT_FALSE(zk_lf_list_remove(list, &missing));
+	TEST_ASSERT_TRUE(zk_lf_list_remove(list, &one));
+	TEST_ASSERT_FALSE(zk_lf_list_contains(list, &one));
+	TEST_ASSERT_FALSE(zk_lf_list_remove(list, &one));
+	TEST_ASSERT_TRUE(zk_lf_list_remove(list, &three));
+	TEST_ASSERT_EQUAL(ZK_OK, zk_lf_list_insert(list, &values[0]));
+	TEST_ASSERT_TRUE(zk_lf_list_contains(list, &three));
+	TEST_ASSERT_EQUAL(2, zk_lf_list_size(list));
+
+	zk_lf_list_for_each(list, collect_int, &collect);
+	TEST_ASSERT_EQUAL(2, collect.count);
+	TEST_ASSERT_EQUAL(2, collect.values[0]);
+	TEST_ASSERT_EQUAL(3, collect.values[1]);
+
+	zk_lf_list_free(&list);
+}
+
+void test_zk_lf_list_free_applies_destructor(void)
+{
+	zk_lf_list *list = NULL;
+	int const two = 2;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_lf_list_new(&list, compare_int, free));
+	for (int i = 0; i < 5; i++)
+		zk_lf_list_insert(list, new_int(i));
+	TEST_ASSERT_TRUE(zk_lf_list_remove(list, &two));
+
+	// leak checkers report the values if the destructor is not applied to both live and removed data
+	zk_lf_list_free(&list);
+}
+
+/*
+ * All threads insert and remove the same few keys. Every successful insert of a key must be matched by the removal
+ * that follows it in the linearization order, so for each key the successful inserts minus the successful removes of
+ * all threads is 1 if the key is in the final list and 0 otherwise.
+ */
+struct stress_context {
+	zk_lf_list *list;
+	size_t thread;
+	long balance[N_KEYS];
+	bool valid;
+};
+
+static void *stress_shared_keys(void *arg)
+{
+	struct stress_context *ctx = arg;
+	uint64_t seed = ctx->thread * 0x9e3779b97f4a7c15u + 1;
+
+	for (size_t op = 0; op < N_OPS_THREAD; op++) {
+		seed = seed * 6364136223846793005u + 1442695040888963407u;
+		size_t const i = (size_t)(seed >> 33) % N_KEYS;
+		void *const key = (void *)(uintptr_t)(i + 1);
+
+		if ((seed >> 20) & 1) {
+			zk_status const status = zk_lf_list_insert(ctx->list, key);
+			if (status == ZK_OK)
+				ctx->balance[i]++;
+			else if (status != ZK_ERROR_EXISTS)
+				ctx->valid = false;
+		} else if (zk_lf_list_remove(ctx->list, key)) {
+			ctx->balance[i]--;
+		}
+	}
+	return NULL;
+}
+
+struct stress_check {
+	uintptr_t last;
+	size_t count;
+	bool sorted;
+};
+
+static void stress_check(void *data, void *user_data)
+{
+	struct stress_check *check = user_data;
+	if ((uintptr_t)data <= check->last)
+		check->sorted = false;
+	check->last = (uintptr_t)data;
+	check->count++;
+}
+
+void test_zk_lf_list_concurrent_shared_keys(void)
+{
+	zk_lf_list *list = NULL;
+	pthread_t threads[N_THREADS];
+	struct stress_context ctx[N_THREADS];
+	struct stress_check check = { .sorted = true };
+	size_t expected = 0;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_lf_list_new(&list, compare_key, NULL));
+	for (size_t t = 0; t < N_THREADS; t++) {
+		ctx[t] = (struct stress_context){ .list = list, .thread = t, .valid = true };
+		pthread_create(&threads[t], NULL, stress_shared_keys, &ctx[t]);
+	}
+	for (size_t t = 0; t < N_THREADS; t++)
+		pthread_join(threads[t], NULL);
+
+	for (size_t i = 0; i < N_KEYS; i++) {
+		long balance = 0;
+		for (size_t t = 0; t < N_THREADS; t++)
+			balance += ctx[t].balance[i];
+		TEST_ASSERT_EQUAL(zk_lf_list_contains(list, (void *)(uintptr_t)(i + 1)) ? 1 : 0, balance);
+		expected += (size_t)balance;
+	}
+	for (size_t t = 0; t < N_THREADS; t++)
+		TEST_ASSERT_TRUE(ctx[t].valid);
+
+	zk_lf_list_for_each(list, stress_check, &check);
+	TEST_ASSERT_TRUE(check.sorted);
+	TEST_ASSERT_EQUAL(expected, check.count);
+	TEST_ASSERT_EQUAL(expected, zk_lf_list_size(list));
+
+	zk_lf_list_free(&list);
+}
+
+/*
+ * Each thread owns the keys equal to its index modulo N_THREADS, interleaved with the keys of the other threads. Only
+ * the owner changes a key, so every operation result is known in advance.
+ */
+static void *stress_owned_keys(void *arg)
+{
+	struct stress_context *ctx = arg;
+	uint64_t seed = ctx->thread * 0x9e3779b97f4a7c15u + 1;
+
+	for (size_t op = 0; op < N_OPS_THREAD; op++) {
+		seed = seed * 6364136223846793005u + 1442695040888963407u;
+		size_t const i = (size_t)(seed >> 33) % N_KEYS;
+		void *const key = (void *)(uintptr_t)(1 + i * N_THREADS + ctx->thread);
+		bool const present = ctx->balance[i] != 0;
+
+		if (zk_lf_list_contains(ctx->list, key) != present)
+			ctx->valid = false;
+		if (present ? !zk_lf_list_remove(ctx->list, key) : zk_lf_list_insert(ctx->list, key) != ZK_OK)
+			ctx->valid = false;
+		ctx->balance[i] = !present;
+	}
+	return NULL;
+}
+
+void test_zk_lf_list_concurrent_owned_keys(void)
+{
+	zk_lf_list *list = NULL;
+	pthread_t threads[N_THREADS];
+	struct stress_context ctx[N_THREADS];
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_lf_list_new(&list, compare_key, NULL));
+	for (size_t t = 0; t < N_THREADS; t++) {
+		ctx[t] = (struct stress_context){ .list = list, .thread = t, .valid = true };
+		pthread_create(&threads[t], NULL, stress_owned_keys, &ctx[t]);
+	}
+	for (size_t t = 0; t < N_THREADS; t++)
+		pthread_join(threads[t], NULL);
+
+	for (size_t t = 0; t < N_THREADS; t++) {
+		TEST_ASSERT_TRUE(ctx[t].valid);
+		for (size_t i = 0; i < N_KEYS; i++) {
+			void *const key = (void *)(uintptr_t)(1 + i * N_THREADS + t);
+			TEST_ASSERT_EQUAL(ctx[t].balance[i] != 0, zk_lf_list_contains(list, key));
+		}
+	}
+
+	zk_lf_list_free(&list);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+
+	/*--------------- Test Constructor ---------------*/
+	RUN_TEST(test_zk_lf_list_new_when_arguments_are_invalid);
+	RUN_TEST(test_zk_lf_list_new_and_free);
+
+	/*--------------- Test Modifiers ---------------*/
+	RUN_TEST(test_zk_lf_list_insert_keeps_order_and_rejects_duplicates);
+	RUN_TEST(test_zk_lf_list_remove);
+	RUN_TEST(test_zk_lf_list_free_applies_destructor);
+	RUN_TEST(test_zk_lf_list_concurrent_shared_keys);
+	RUN_TEST(test_zk_lf_list_concurrent_owned_keys);
+
+	return UNITY_END();
+}
@@ -0,0 +1,166 @@
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "zk_lf_queue/zk_lf_queue.h"
+
+#define N_PRODUCERS       3
+#define N_CONSUMERS       3
+#define N_ELEMENTS_THREAD 20000
+
+void setUp(void)
+{
+	// set stuff up here
+}
+
+void tearDown(void)
+{
+	// clean stuff up here
+}
+
+/*--------------- Test Constructor ---------------*/
+void test_zk_lf_queue_new_when_arguments_are_invalid(void)
+{
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_lf_queue_new(NULL));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_lf_queue_push(NULL, NULL));
+	TEST_ASSERT_FALSE(zk_lf_queue_pop(NULL, NULL));
+}
+
+void test_zk_lf_queue_new_and_free(void)
+{
+	zk_lf_queue *queue = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_lf_queue_new(&queue));
+	TEST_ASSERT_NOT_NULL(queue);
+
+	zk_lf_queue_free(&queue, NULL);
+	TEST_ASSERT_NULL(queue);
+	zk_lf_queue_free(&queue, NULL);
+	zk_lf_queue_free(NULL, NULL);
+}
+
+/*--------------- Test Modifiers ---------------*/
+void test_zk_lf_queue_push_and_pop_are_fifo(void)
+{
+	zk_lf_queue *queue = NULL;
+	int data[] = { 0, 1, 2, 3, 4 };
+	void *popped = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_lf_queue_new(&queue));
+	TEST_ASSERT_FALSE(zk_lf_queue_pop(queue, &popped));
+
+	for (int round = 0; round < 3; round++) {
+		for (int i = 0; i < 5; i++)
+			TEST_ASSERT_EQUAL(ZK_OK, zk_lf_queue_push(queue, &data[i]));
+		for (int i = 0; i < 5; i++) {
+			TEST_ASSERT_TRUE(zk_lf_queue_pop(queue, &popped));
+			TEST_ASSERT_EQUAL_PTR(&data[i], popped);
+		}
+		TEST_ASSERT_FALSE(zk_lf_queue_pop(queue, &popped));
+	}
+
+	zk_lf_queue_free(&queue, NULL);
+}
+
+void test_zk_lf_queue_free_applies_destructor(void)
+{
+	zk_lf_queue *queue = NULL;
+	void *popped = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_lf_queue_new(&queue));
+	for (int i = 0; i < 5; i++)
+		TEST_ASSERT_EQUAL(ZK_OK, zk_lf_queue_push(queue, malloc(sizeof(int))));
+	TEST_ASSERT_TRUE(zk_lf_queue_pop(queue, &popped));
+	free(popped);
+
+	// leak checkers report the data if the destructor is not applied
+	zk_lf_queue_free(&queue, free);
+}
+
+struct stress_context {
+	zk_lf_queue *queue;
+	int *values;
+	unsigned char *seen;
+	size_t thread;
+	bool ordered;
+};
+
+static void *stress_producer(void *arg)
+{
+	struct stress_context *ctx = arg;
+	for (size_t i = 0; i < N_ELEMENTS_THREAD; i++)
+		zk_lf_queue_push(ctx->queue, &ctx->values[ctx->thread * N_ELEMENTS_THREAD + i]);
+	return NULL;
+}
+
+// pops its share of the values and checks that each producer's values come out in push order
+static void *stress_consumer(void *arg)
+{
+	struct stress_context *ctx = arg;
+	int last[N_PRODUCERS];
+	void *popped = NULL;
+
+	for (size_t p = 0; p < N_PRODUCERS; p++)
+		last[p] = -1;
+
+	for (size_t i = 0; i < N_ELEMENTS_THREAD * N_PRODUCERS / N_CONSUMERS; i++) {
+		while (!zk_lf_queue_pop(ctx->queue, &popped))
+			;
+		int const value = *(int *)popped;
+		size_t const producer = (size_t)value / N_ELEMENTS_THREAD;
+		if (value <= last[producer])
+			ctx->ordered = false;
+		last[producer] = value;
+		__atomic_add_fetch(&ctx->seen[value], 1, __ATOMIC_RELAXED);
+	}
+	return NULL;
+}
+
+void test_zk_lf_queue_concurrent_producers_and_consumers(void)
+{
+	zk_lf_queue *queue = NULL;
+	size_t const n = N_PRODUCERS * N_ELEMENTS_THREAD;
+	int *values = malloc(n * sizeof(int));
+	unsigned char *seen = calloc(n, 1);
+	pthread_t threads[N_PRODUCERS + N_CONSUMERS];
+	struct stress_context ctx[N_PRODUCERS + N_CONSUMERS];
+
+	for (size_t i = 0; i < n; i++)
+		values[i] = (int)i;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_lf_queue_new(&queue));
+	for (size_t t = 0; t < N_PRODUCERS + N_CONSUMERS; t++) {
+		ctx[t] = (struct stress_context){ queue, values, seen, t, true };
+		pthread_create(&threads[t], NULL, t < N_PRODUCERS ? stress_producer : stress_consumer, &ctx[t]);
+	}
+	for (size_t t = 0; t < N_PRODUCERS + N_CONSUMERS; t++)
+		pthread_join(threads[t], NULL);
+
+	// every value pushed was popped exactly once, in push order per producer
+	void *popped = NULL;
+	TEST_ASSERT_FALSE(zk_lf_queue_pop(queue, &popped));
+	for (size_t i = 0; i < n; i++)
+		TEST_ASSERT_EQUAL(1, seen[i]);
+	for (size_t t = N_PRODUCERS; t < N_PRODUCERS + N_CONSUMERS; t++)
+		TEST_ASSERT_TRUE(ctx[t].ordered);
+
+	zk_lf_queue_free(&queue, NULL);
+	free(seen);
+	free(values);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+
+	/*--------------- Test Constructor ---------------*/
+	RUN_TEST(test_zk_lf_queue_new_when_arguments_are_invalid);
+	RUN_TEST(test_zk_lf_queue_new_and_free);
+
+	/*--------------- Test Modifiers ---------------*/
+	RUN_TEST(test_zk_lf_queue_push_and_pop_are_fifo);
+	RUN_TEST(test_zk_lf_queue_free_applies_destructor);
+	RUN_TEST(test_zk_lf_queue_concurrent_producers_and_consumers);
+
+	return UNITY_END();
+}
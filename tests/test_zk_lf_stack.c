@@ -0,0 +1,173 @@
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "zk_lf_stack/zk_lf_stack.h"
+
+#define N_THREADS         4
+#define N_ELEMENTS_THREAD 20000
+
+void setUp(void)
+{
+	// set stuff up here
+}
+
+void tearDown(void)
+{
+	// clean stuff up here
+}
+
+/*--------------- Test Constructor ---------------*/
+void test_zk_lf_stack_new_when_arguments_are_invalid(void)
+{
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_lf_stack_new(NULL));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_lf_stack_push(NULL, NULL));
+	TEST_ASSERT_FALSE(zk_lf_stack_pop(NULL, NULL));
+	TEST_ASSERT_NULL(zk_lf_stack_pop_all(NULL));
+}
+
+void test_zk_lf_stack_new_and_free(void)
+{
+	zk_lf_stack *stack = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_lf_stack_new(&stack));
+	TEST_ASSERT_NOT_NULL(stack);
+
+	zk_lf_stack_free(&stack, NULL);
+	TEST_ASSERT_NULL(stack);
+	zk_lf_stack_free(&stack, NULL);
+	zk_lf_stack_free(NULL, NULL);
+}
+
+/*--------------- Test Modifiers ---------------*/
+void test_zk_lf_stack_push_and_pop_are_lifo(void)
+{
+	zk_lf_stack *stack = NULL;
+	int data[] = { 0, 1, 2, 3, 4 };
+	void *popped = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_lf_stack_new(&stack));
+	TEST_ASSERT_FALSE(zk_lf_stack_pop(stack, &popped));
+
+	for (int i = 0; i < 5; i++)
+		TEST_ASSERT_EQUAL(ZK_OK, zk_lf_stack_push(stack, &data[i]));
+	for (int i = 4; i >= 0; i--) {
+		TEST_ASSERT_TRUE(zk_lf_stack_pop(stack, &popped));
+		TEST_ASSERT_EQUAL_PTR(&data[i], popped);
+	}
+	TEST_ASSERT_FALSE(zk_lf_stack_pop(stack, &popped));
+
+	// nodes freed by the pops are reused
+	TEST_ASSERT_EQUAL(ZK_OK, zk_lf_stack_push(stack, &data[0]));
+	TEST_ASSERT_TRUE(zk_lf_stack_pop(stack, &popped));
+	TEST_ASSERT_EQUAL_PTR(&data[0], popped);
+
+	zk_lf_stack_free(&stack, NULL);
+}
+
+void test_zk_lf_stack_pop_all_detaches_the_chain(void)
+{
+	zk_lf_stack *stack = NULL;
+	int data[] = { 0, 1, 2, 3, 4 };
+	void *popped = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_lf_stack_new(&stack));
+	TEST_ASSERT_NULL(zk_lf_stack_pop_all(stack));
+
+	for (int i = 0; i < 5; i++)
+		TEST_ASSERT_EQUAL(ZK_OK, zk_lf_stack_push(stack, &data[i]));
+
+	zk_slist *list = zk_lf_stack_pop_all(stack);
+	TEST_ASSERT_FALSE(zk_lf_stack_pop(stack, &popped));
+	TEST_ASSERT_EQUAL(5, zk_slist_size(list));
+	int i = 4;
+	for (zk_slist *node = list; node != NULL; node = node->next)
+		TEST_ASSERT_EQUAL_PTR(&data[i--], node->data);
+
+	zk_lf_stack_recycle(stack, &list);
+	TEST_ASSERT_NULL(list);
+
+	zk_lf_stack_free(&stack, NULL);
+}
+
+void test_zk_lf_stack_free_applies_destructor(void)
+{
+	zk_lf_stack *stack = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_lf_stack_new(&stack));
+	for (int i = 0; i < 5; i++)
+		TEST_ASSERT_EQUAL(ZK_OK, zk_lf_stack_push(stack, malloc(sizeof(int))));
+
+	// leak checkers report the data if the destructor is not applied
+	zk_lf_stack_free(&stack, free);
+}
+
+struct stress_context {
+	zk_lf_stack *stack;
+	int *values;
+	unsigned char *seen;
+	size_t thread;
+};
+
+// pushes its own values and pops as many, which may come from any thread
+static void *stress_worker(void *arg)
+{
+	struct stress_context *ctx = arg;
+	void *popped = NULL;
+
+	for (size_t i = 0; i < N_ELEMENTS_THREAD; i++) {
+		zk_lf_stack_push(ctx->stack, &ctx->values[ctx->thread * N_ELEMENTS_THREAD + i]);
+		if (i % 2 == 1) {
+			for (int j = 0; j < 2; j++) {
+				while (!zk_lf_stack_pop(ctx->stack, &popped))
+					;
+				__atomic_add_fetch(&ctx->seen[(int *)popped - ctx->values], 1, __ATOMIC_RELAXED);
+			}
+		}
+	}
+	return NULL;
+}
+
+void test_zk_lf_stack_concurrent_push_and_pop(void)
+{
+	zk_lf_stack *stack = NULL;
+	int *values = malloc(N_THREADS * N_ELEMENTS_THREAD * sizeof(int));
+	unsigned char *seen = calloc(N_THREADS * N_ELEMENTS_THREAD, 1);
+	pthread_t threads[N_THREADS];
+	struct stress_context ctx[N_THREADS];
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_lf_stack_new(&stack));
+	for (size_t t = 0; t < N_THREADS; t++) {
+		ctx[t] = (struct stress_context){ stack, values, seen, t };
+		pthread_create(&threads[t], NULL, stress_worker, &ctx[t]);
+	}
+	for (size_t t = 0; t < N_THREADS; t++)
+		pthread_join(threads[t], NULL);
+
+	// every value pushed was popped exactly once
+	void *popped = NULL;
+	TEST_ASSERT_FALSE(zk_lf_stack_pop(stack, &popped));
+	for (size_t i = 0; i < N_THREADS * N_ELEMENTS_THREAD; i++)
+		TEST_ASSERT_EQUAL(1, seen[i]);
+
+	zk_lf_stack_free(&stack, NULL);
+	free(seen);
+	free(values);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+
+	/*--------------- Test Constructor ---------------*/
+	RUN_TEST(test_zk_lf_stack_new_when_arguments_are_invalid);
+	RUN_TEST(test_zk_lf_stack_new_and_free);
+
+	/*--------------- Test Modifiers ---------------*/
+	RUN_TEST(test_zk_lf_stack_push_and_pop_are_lifo);
+	RUN_TEST(test_zk_lf_stack_pop_all_detaches_the_chain);
+	RUN_TEST(test_zk_lf_stack_free_applies_destructor);
+	RUN_TEST(test_zk_lf_stack_concurrent_push_and_pop);
+
+	return UNITY_END();
+}
@@ -0,0 +1,258 @@
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "zk_lock_dlist/zk_lock_dlist.h"
+
+#define N_THREADS      4
+#define N_KEYS_THREAD  64
+#define N_OPS_THREAD   20000
+
+void setUp(void)
+{
+	// set stuff up here
+}
+
+void tearDown(void)
+{
+	// clean stuff up here
+}
+
+static int compare_int(const void *const a, const void *const b)
+{
+	int const x = *(const int *)a;
+	int const y = *(const int *)b;
+	return (x > y) - (x < y);
+}
+
+static int compare_key(const void *const a, const void *const b)
+{
+	uintptr_t const x = (uintptr_t)a;
+	uintptr_t const y = (uintptr_t)b;
+	return (x > y) - (x < y);
+}
+
+struct collect {
+	int values[16];
+	size_t count;
+};
+
+static void collect_int(void *data, void *user_data)
+{
+	struct collect *collect = user_data;
+	collect->values[collect->count++] = *(int *)data;
+}
+
+static int *new_int(int const value)
+{
+	int *data = malloc(sizeof(int));
+	*data = value;
+	return data;
+}
+
+/*--------------- Test Constructor ---------------*/
+void test_zk_lock_dlist_new_when_arguments_are_invalid(void)
+{
+	zk_lock_dlist *list = NULL;
+	int value = 0;
+
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_lock_dlist_new(NULL, compare_int));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_lock_dlist_new(&list, NULL));
+	TEST_ASSERT_NULL(list);
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_lock_dlist_insert(NULL, &value));
+	TEST_ASSERT_FALSE(zk_lock_dlist_remove(NULL, &value, NULL));
+	TEST_ASSERT_FALSE(zk_lock_dlist_contains(NULL, &value));
+	TEST_ASSERT_EQUAL(0, zk_lock_dlist_size(NULL));
+	zk_lock_dlist_for_each(NULL, collect_int, NULL);
+}
+
+void test_zk_lock_dlist_new_and_free(void)
+{
+	zk_lock_dlist *list = NULL;
+	int value = 0;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_lock_dlist_new(&list, compare_int));
+	TEST_ASSERT_NOT_NULL(list);
+	TEST_ASSERT_EQUAL(0, zk_lock_dlist_size(list));
+	TEST_ASSERT_FALSE(zk_lock_dlist_contains(list, &value));
+
+	zk_lock_dlist_free(&list, NULL);
+	TEST_ASSERT_NULL(list);
+	zk_lock_dlist_free(&list, NULL);
+	zk_lock_dlist_free(NULL, NULL);
+}
+
+/*--------------- Test Modifiers ---------------*/
+void test_zk_lock_dlist_insert_keeps_order(void)
+{
+	zk_lock_dlist *list = NULL;
+	int values[] = { 5, 1, 4, 1, 9, 2, 6 };
+	int const expected[] = { 1, 1, 2, 4, 5, 6, 9 };
+	struct collect collect = { .count = 0 };
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_lock_dlist_new(&list, compare_int));
+	for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+		TEST_ASSERT_EQUAL(ZK_OK, zk_lock_dlist_insert(list, &values[i]));
+	TEST_ASSERT_EQUAL(7, zk_lock_dlist_size(list));
+
+	zk_lock_dlist_for_each(list, collect_int, &collect);
+	TEST_ASSERT_EQUAL(7, collect.count);
+	for (size_t i = 0; i < 7; i++)
+		TEST_ASSERT_EQUAL(expected[i], collect.values[i]);
+
+	zk_lock_dlist_free(&list, NULL);
+}
+
+void test_zk_lock_dlist_remove(void)
+{
+	zk_lock_dlist *list = NULL;
+	int values[] = { 3, 1, 2, 3 };
+	int const expected[] = { 2, 3 };
+	int const missing = 7;
+	int const one = 1;
+	int const three = 3;
+	struct collect collect = { .count = 0 };
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_lock_dlist_new(&list, compare_int));
+	TEST_ASSERT_FALSE(zk_lock_dlist_remove(list, &missing, NULL));
+	for (size_t i = 0; i < 4; i++)
+		zk_lock_dlist_insert(list, &values[i]);
+
+	TEST_ASSERT_FALSE(zk_lock_dlist_remove(list, &missing, NULL));
+	TEST_ASSERT_TRUE(zk_lock_dlist_remove(list, &one, NULL));
+	TEST_ASSERT_FALSE(zk_lock_dlist_contains(list, &one));
+	TEST_ASSERT_FALSE(zk_lock_dlist_remove(list, &one, NULL));
+
+	// duplicates are removed one at a time
+	TEST_ASSERT_TRUE(zk_lock_dlist_remove(list, &three, NULL));
+	TEST_ASSERT_TRUE(zk_lock_dlist_contains(list, &three));
+	zk_lock_dlist_insert(list, &values[0]);
+	TEST_ASSERT_TRUE(zk_lock_dlist_remove(list, &three, NULL));
+	TEST_ASSERT_EQUAL(2, zk_lock_dlist_size(list));
+
+	zk_lock_dlist_for_each(list, collect_int, &collect);
+	TEST_ASSERT_EQUAL(2, collect.count);
+	for (size_t i = 0; i < 2; i++)
+		TEST_ASSERT_EQUAL(expected[i], collect.values[i]);
+
+	zk_lock_dlist_free(&list, NULL);
+}
+
+void test_zk_lock_dlist_free_applies_destructors(void)
+{
+	zk_lock_dlist *list = NULL;
+	int const two = 2;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_lock_dlist_new(&list, compare_int));
+	for (int i = 0; i < 5; i++)
+		zk_lock_dlist_insert(list, new_int(i));
+	TEST_ASSERT_TRUE(zk_lock_dlist_remove(list, &two, free));
+
+	// leak checkers report the values if either destructor is not applied
+	zk_lock_dlist_free(&list, free);
+}
+
+/*
+ * Each thread owns the keys equal to its index modulo N_THREADS and randomly inserts and removes them. Keys of all
+ * threads interleave, so neighbouring nodes are updated by different threads. Only the owner changes a key, so every
+ * lookup of a thread must agree with the presence it tracks, and the final list must hold the union of the keys each
+ * thread left in.
+ */
+struct stress_context {
+	zk_lock_dlist *list;
+	size_t thread;
+	bool present[N_KEYS_THREAD];
+	bool consistent;
+};
+
+static uintptr_t stress_key(size_t const thread, size_t const i)
+{
+	return 1 + i * N_THREADS + thread;
+}
+
+static void *stress_worker(void *arg)
+{
+	struct stress_context *ctx = arg;
+	uint64_t seed = ctx->thread * 0x9e3779b97f4a7c15u + 1;
+
+	for (size_t op = 0; op < N_OPS_THREAD; op++) {
+		seed = seed * 6364136223846793005u + 1442695040888963407u;
+		size_t const i = (size_t)(seed >> 33) % N_KEYS_THREAD;
+		void *const key = (void *)stress_key(ctx->thread, i);
+
+		if (zk_lock_dlist_contains(ctx->list, key) != ctx->present[i])
+			ctx->consistent = false;
+		if (ctx->present[i]) {
+			if (!zk_lock_dlist_remove(ctx->list, key, NULL))
+				ctx->consistent = false;
+		} else if (zk_lock_dlist_insert(ctx->list, key) != ZK_OK) {
+			ctx->consistent = false;
+		}
+		ctx->present[i] = !ctx->present[i];
+	}
+	return NULL;
+}
+
+struct stress_check {
+	uintptr_t last;
+	size_t count;
+	bool sorted;
+};
+
+static void stress_check(void *data, void *user_data)
+{
+	struct stress_check *check = user_data;
+	if ((uintptr_t)data <= check->last)
+		check->sorted = false;
+	check->last = (uintptr_t)data;
+	check->count++;
+}
+
+void test_zk_lock_dlist_concurrent_insert_and_remove(void)
+{
+	zk_lock_dlist *list = NULL;
+	pthread_t threads[N_THREADS];
+	struct stress_context ctx[N_THREADS];
+	struct stress_check check = { .sorted = true };
+	size_t expected = 0;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_lock_dlist_new(&list, compare_key));
+	for (size_t t = 0; t < N_THREADS; t++) {
+		ctx[t] = (struct stress_context){ .list = list, .thread = t, .consistent = true };
+		pthread_create(&threads[t], NULL, stress_worker, &ctx[t]);
+	}
+	for (size_t t = 0; t < N_THREADS; t++)
+		pthread_join(threads[t], NULL);
+
+	for (size_t t = 0; t < N_THREADS; t++) {
+		TEST_ASSERT_TRUE(ctx[t].consistent);
+		for (size_t i = 0; i < N_KEYS_THREAD; i++) {
+			TEST_ASSERT_EQUAL(ctx[t].present[i], zk_lock_dlist_contains(list, (void *)stress_key(t, i)));
+			expected += ctx[t].present[i];
+		}
+	}
+	zk_lock_dlist_for_each(list, stress_check, &check);
+	TEST_ASSERT_TRUE(check.sorted);
+	TEST_ASSERT_EQUAL(expected, check.count);
+	TEST_ASSERT_EQUAL(expected, zk_lock_dlist_size(list));
+
+	zk_lock_dlist_free(&list, NULL);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+
+	/*--------------- Test Constructor ---------------*/
+	RUN_TEST(test_zk_lock_dlist_new_when_arguments_are_invalid);
+	RUN_TEST(test_zk_lock_dlist_new_and_free);
+
+	/*--------------- Test Modifiers ---------------*/
+	RUN_TEST(test_zk_lock_dlist_insert_keeps_order);
+	RUN_TEST(test_zk_lock_dlist_remove);
+	RUN_TEST(test_zk_lock_dlist_free_applies_destructors);
+	RUN_TEST(test_zk_lock_dlist_concurrent_insert_and_remove);
+
+	return UNITY_END();
+}
@@ -0,0 +1,280 @@
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "zk_mpsc_queue/zk_mpsc_queue.h"
+
+#define N_PRODUCERS       4
+#define N_ELEMENTS_THREAD 20000
+
+struct item {
+	int value;
+	zk_mpsc_node node;
+};
+
+void setUp(void)
+{
+	// set stuff up here
+}
+
+void tearDown(void)
+{
+	// clean stuff up here
+}
+
+static void free_item(void *node)
+{
+	free(ZK_MPSC_ENTRY(node, struct item, node));
+}
+
+static void collect_item(void *node, void *user_data)
+{
+	int **out = user_data;
+	**out = ZK_MPSC_ENTRY(node, struct item, node)->value;
+	(*out)++;
+}
+
+/*--------------- Test Constructor ---------------*/
+void test_zk_mpsc_queue_new_when_arguments_are_invalid(void)
+{
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_mpsc_queue_new(NULL));
+	TEST_ASSERT_NULL(zk_mpsc_queue_pop(NULL));
+	TEST_ASSERT_EQUAL(0, zk_mpsc_queue_drain(NULL, collect_item, NULL));
+	zk_mpsc_queue_push(NULL, NULL);
+}
+
+void test_zk_mpsc_queue_new_and_free(void)
+{
+	zk_mpsc_queue *queue = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_mpsc_queue_new(&queue));
+	TEST_ASSERT_NOT_NULL(queue);
+	TEST_ASSERT_NULL(zk_mpsc_queue_pop(queue));
+
+	zk_mpsc_queue_free(&queue, NULL);
+	TEST_ASSERT_NULL(queue);
+	zk_mpsc_queue_free(&queue, NULL);
+	zk_mpsc_queue_free(NULL, NULL);
+}
+
+/*--------------- Test Modifiers ---------------*/
+void test_zk_mpsc_queue_push_and_pop_are_fifo(void)
+{
+	zk_mpsc_queue *queue = NULL;
+	struct item items[5];
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_mpsc_queue_new(&queue));
+	for (int round = 0; round < 3; round++) {
+		for (int i = 0; i < 5; i++) {
+			items[i].value = i;
+			zk_mpsc_queue_push(queue, &items[i].node);
+		}
+		for (int i = 0; i < 5; i++) {
+			zk_mpsc_node *node = zk_mpsc_queue_pop(queue);
+			TEST_ASSERT_EQUAL_PTR(&items[i].node, node);
+			TEST_ASSERT_EQUAL(i, ZK_MPSC_ENTRY(node, struct item, node)->value);
+		}
+		TEST_ASSERT_NULL(zk_mpsc_queue_pop(queue));
+	}
+
+	zk_mpsc_queue_free(&queue, NULL);
+}
+
+void test_zk_mpsc_queue_drain(void)
+{
+	zk_mpsc_queue *queue = NULL;
+	struct item items[5];
+	int out[5];
+	int *cursor = out;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_mpsc_queue_new(&queue));
+	TEST_ASSERT_EQUAL(0, zk_mpsc_queue_drain(queue, collect_item, &cursor));
+
+	for (int i = 0; i < 5; i++) {
+		items[i].value = i;
+		zk_mpsc_queue_push(queue, &items[i].node);
+	}
+	TEST_ASSERT_EQUAL(0, zk_mpsc_queue_drain(queue, NULL, NULL));
+	TEST_ASSERT_EQUAL(5, zk_mpsc_queue_drain(queue, collect_item, &cursor));
+	for (int i = 0; i < 5; i++)
+		TEST_ASSERT_EQUAL(i, out[i]);
+	TEST_ASSERT_NULL(zk_mpsc_queue_pop(queue));
+
+	zk_mpsc_queue_free(&queue, NULL);
+}
+
+static void requeue_item(void *node, void *user_data)
+{
+	zk_mpsc_queue_push(user_data, node);
+}
+
+void test_zk_mpsc_queue_drain_stops_at_nodes_queued_on_entry(void)
+{
+	zk_mpsc_queue *queue = NULL;
+	struct item items[5];
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_mpsc_queue_new(&queue));
+	for (int round = 0; round < 3; round++) {
+		for (int i = 0; i < 5; i++) {
+			items[i].value = i;
+			zk_mpsc_queue_push(queue, &items[i].node);
+		}
+		// every node drained is pushed again, a drain that follows the new nodes would never return
+		TEST_ASSERT_EQUAL(5, zk_mpsc_queue_drain(queue, requeue_item, queue));
+		TEST_ASSERT_EQUAL(5, zk_mpsc_queue_drain(queue, requeue_item, queue));
+		for (int i = 0; i < 5; i++)
+			TEST_ASSERT_EQUAL_PTR(&items[i].node, zk_mpsc_queue_pop(queue));
+		TEST_ASSERT_NULL(zk_mpsc_queue_pop(queue));
+		TEST_ASSERT_EQUAL(0, zk_mpsc_queue_drain(queue, requeue_item, queue));
+	}
+
+	zk_mpsc_queue_free(&queue, NULL);
+}
+
+void test_zk_mpsc_queue_free_applies_destructor(void)
+{
+	zk_mpsc_queue *queue = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_mpsc_queue_new(&queue));
+	for (int i = 0; i < 5; i++) {
+		struct item *item = malloc(sizeof(struct item));
+		item->value = i;
+		zk_mpsc_queue_push(queue, &item->node);
+	}
+	free_item(zk_mpsc_queue_pop(queue));
+
+	// leak checkers report the items if the destructor is not applied
+	zk_mpsc_queue_free(&queue, free_item);
+}
+
+struct stress_context {
+	zk_mpsc_queue *queue;
+	struct item *items;
+	size_t thread;
+};
+
+static void *stress_producer(void *arg)
+{
+	struct stress_context *ctx = arg;
+	for (size_t i = 0; i < N_ELEMENTS_THREAD; i++)
+		zk_mpsc_queue_push(ctx->queue, &ctx->items[ctx->thread * N_ELEMENTS_THREAD + i].node);
+	return NULL;
+}
+
+struct stress_consumer {
+	int last[N_PRODUCERS];
+	size_t count;
+	bool ordered;
+};
+
+static void stress_consume(void *node, void *user_data)
+{
+	struct stress_consumer *consumer = user_data;
+	int const value = ZK_MPSC_ENTRY(node, struct item, node)->value;
+	size_t const producer = (size_t)value / N_ELEMENTS_THREAD;
+	if (value <= consumer->last[producer])
+		consumer->ordered = false;
+	consumer->last[producer] = value;
+	consumer->count++;
+}
+
+void test_zk_mpsc_queue_concurrent_producers(void)
+{
+	zk_mpsc_queue *queue = NULL;
+	size_t const n = N_PRODUCERS * N_ELEMENTS_THREAD;
+	struct item *items = malloc(n * sizeof(struct item));
+	pthread_t threads[N_PRODUCERS];
+	struct stress_context ctx[N_PRODUCERS];
+	struct stress_consumer consumer = { .ordered = true };
+
+	for (size_t i = 0; i < n; i++)
+		items[i].value = (int)i;
+	for (size_t p = 0; p < N_PRODUCERS; p++)
+		consumer.last[p] = -1;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_mpsc_queue_new(&queue));
+	for (size_t t = 0; t < N_PRODUCERS; t++) {
+		ctx[t] = (struct stress_context){ queue, items, t };
+		pthread_create(&threads[t], NULL, stress_producer, &ctx[t]);
+	}
+	// the consumer drains while the producers run
+	while (consumer.count < n)
+		zk_mpsc_queue_drain(queue, stress_consume, &consumer);
+	for (size_t t = 0; t < N_PRODUCERS; t++)
+		pthread_join(threads[t], NULL);
+
+	TEST_ASSERT_EQUAL(n, consumer.count);
+	TEST_ASSERT_TRUE(consumer.ordered);
+	TEST_ASSERT_NULL(zk_mpsc_queue_pop(queue));
+
+	zk_mpsc_queue_free(&queue, NULL);
+	free(items);
+}
+
+struct flood_context {
+	zk_mpsc_queue *queue;
+	bool stop;
+	size_t pushed;
+};
+
+static void *flood_producer(void *arg)
+{
+	struct flood_context *ctx = arg;
+	while (!__atomic_load_n(&ctx->stop, __ATOMIC_ACQUIRE)) {
+		struct item *item = malloc(sizeof(struct item));
+		item->value = (int)ctx->pushed;
+		zk_mpsc_queue_push(ctx->queue, &item->node);
+		__atomic_store_n(&ctx->pushed, ctx->pushed + 1, __ATOMIC_RELEASE);
+	}
+	return NULL;
+}
+
+static void slow_free_item(void *node, void *user_data)
+{
+	ZK_UNUSED(user_data);
+	// slower than the producer, so that the queue never runs empty during the drain
+	for (volatile int spin = 0; spin < 1000; spin++)
+		;
+	free_item(node);
+}
+
+void test_zk_mpsc_queue_drain_returns_while_producer_pushes(void)
+{
+	zk_mpsc_queue *queue = NULL;
+	pthread_t thread;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_mpsc_queue_new(&queue));
+	struct flood_context ctx = { .queue = queue };
+	pthread_create(&thread, NULL, flood_producer, &ctx);
+	while (__atomic_load_n(&ctx.pushed, __ATOMIC_ACQUIRE) < 1000)
+		;
+
+	size_t const drained = zk_mpsc_queue_drain(queue, slow_free_item, NULL);
+	size_t const pushed = __atomic_load_n(&ctx.pushed, __ATOMIC_ACQUIRE);
+	__atomic_store_n(&ctx.stop, true, __ATOMIC_RELEASE);
+	pthread_join(thread, NULL);
+
+	TEST_ASSERT_TRUE(drained > 0);
+	TEST_ASSERT_TRUE(drained <= pushed);
+
+	zk_mpsc_queue_free(&queue, free_item);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+
+	/*--------------- Test Constructor ---------------*/
+	RUN_TEST(test_zk_mpsc_queue_new_when_arguments_are_invalid);
+	RUN_TEST(test_zk_mpsc_queue_new_and_free);
+
+	/*--------------- Test Modifiers ---------------*/
+	RUN_TEST(test_zk_mpsc_queue_push_and_pop_are_fifo);
+	RUN_TEST(test_zk_mpsc_queue_drain);
+	RUN_TEST(test_zk_mpsc_queue_drain_stops_at_nodes_queued_on_entry);
+	RUN_TEST(test_zk_mpsc_queue_free_applies_destructor);
+	RUN_TEST(test_zk_mpsc_queue_concurrent_producers);
+	RUN_TEST(test_zk_mpsc_queue_drain_returns_while_producer_pushes);
+
+	return UNITY_END();
+}
@@ -0,0 +1,195 @@
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "zk/zklib.h"
+#include "zk_node_cache/zk_node_cache.h"
+
+#define N_NODES (4 * ZK_BATCH_SIZE)
+
+void setUp(void)
+{
+	// set stuff up here
+}
+
+void tearDown(void)
+{
+	zk_node_cache_trim();
+}
+
+static bool contains(void *const *const nodes, size_t const count, const void *const node)
+{
+	for (size_t i = 0; i < count; i++) {
+		if (nodes[i] == node)
+			return true;
+	}
+	return false;
+}
+
+/*--------------- Test Allocation ---------------*/
+void test_zk_node_cache_alloc_and_free_any_size(void)
+{
+	size_t const sizes[] = { 1, 16, 17, 24, 40, ZK_NODE_CACHE_MAX_SIZE, ZK_NODE_CACHE_MAX_SIZE + 1, 4096 };
+
+	for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+		unsigned char *node = zk_node_cache_alloc(sizes[i]);
+		TEST_ASSERT_NOT_NULL(node);
+		// the whole size is usable, leak and overflow checkers see any mismatch with malloc()
+		for (size_t j = 0; j < sizes[i]; j++)
+			node[j] = (unsigned char)j;
+		zk_node_cache_free(node, sizes[i]);
+	}
+	zk_node_cache_free(NULL, 16);
+}
+
+void test_zk_node_cache_reuses_the_last_node_of_the_same_class(void)
+{
+	void *small = zk_node_cache_alloc(16);
+	void *large = zk_node_cache_alloc(24);
+
+	zk_node_cache_free(small, 16);
+	zk_node_cache_free(large, 24);
+	TEST_ASSERT_EQUAL_PTR(large, zk_node_cache_alloc(24));
+	TEST_ASSERT_EQUAL_PTR(small, zk_node_cache_alloc(16));
+
+	// nodes from malloc() join the cache too
+	void *node = malloc(24);
+	zk_node_cache_free(node, 24);
+	TEST_ASSERT_EQUAL_PTR(node, zk_node_cache_alloc(24));
+
+	zk_node_cache_free(small, 16);
+	zk_node_cache_free(large, 24);
+	free(node);
+}
+
+static void *alloc_nodes(void *arg)
+{
+	void **nodes = arg;
+	for (size_t i = 0; i < N_NODES; i++)
+		nodes[i] = zk_node_cache_alloc(24);
+	return NULL;
+}
+
+static void *free_nodes(void *arg)
+{
+	void **nodes = arg;
+	for (size_t i = 0; i < N_NODES; i++)
+		zk_node_cache_free(nodes[i], 24);
+	return NULL;
+}
+
+void test_zk_node_cache_exchanges_batches_through_the_depot(void)
+{
+	void *nodes[N_NODES];
+	void *reused[N_NODES];
+	pthread_t thread;
+
+	// a thread frees more nodes than its magazine holds, the overflow and the rest at exit go to the depot
+	for (size_t i = 0; i < N_NODES; i++)
+		nodes[i] = malloc(24);
+	pthread_create(&thread, NULL, free_nodes, nodes);
+	pthread_join(thread, NULL);
+
+	// another thread takes them back batch by batch
+	pthread_create(&thread, NULL, alloc_nodes, reused);
+	pthread_join(thread, NULL);
+	for (size_t i = 0; i < N_NODES; i++)
+		TEST_ASSERT_TRUE(contains(nodes, N_NODES, reused[i]));
+
+	for (size_t i = 0; i < N_NODES; i++)
+		zk_node_cache_free(reused[i], 24);
+}
+
+void test_zk_node_cache_is_used_by_lists(void)
+{
+	zk_dlist *dlist = NULL;
+	zk_c_dlist *c_dlist = NULL;
+	int value = 0;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_dlist_push_back(&dlist, &value));
+	zk_dlist *node = dlist;
+	TEST_ASSERT_EQUAL(ZK_OK, zk_dlist_pop_back(&dlist, NULL));
+
+	// the node just freed by a zk_dlist serves the next node of the same size
+	TEST_ASSERT_EQUAL(ZK_OK, zk_c_dlist_push_back(&c_dlist, &value));
+	TEST_ASSERT_EQUAL_PTR(node, c_dlist);
+
+	zk_slist *slist = zk_slist_push_front(NULL, &value);
+	zk_slist *slist_node = slist;
+	zk_slist_free(&slist, NULL);
+	slist = zk_slist_new_node(&value);
+	TEST_ASSERT_EQUAL_PTR(slist_node, slist);
+
+	zk_slist_free(&slist, NULL);
+	zk_c_dlist_free(&c_dlist, NULL);
+}
+
+/*--------------- Test Reserve ---------------*/
+void test_zk_node_cache_reserve_when_size_is_invalid(void)
+{
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_node_cache_reserve(0, 8));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_node_cache_reserve(ZK_NODE_CACHE_MAX_SIZE + 1, 8));
+	TEST_ASSERT_EQUAL(0, zk_node_cache_reserved(0));
+	TEST_ASSERT_EQUAL(0, zk_node_cache_reserved(ZK_NODE_CACHE_MAX_SIZE + 1));
+}
+
+void test_zk_node_cache_reserve_serves_the_next_allocations(void)
+{
+	void *nodes[N_NODES];
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_node_cache_reserve(24, N_NODES));
+	// the reserve is per size class
+	TEST_ASSERT_EQUAL(N_NODES, zk_node_cache_reserved(20));
+	TEST_ASSERT_EQUAL(0, zk_node_cache_reserved(16));
+
+	for (size_t i = 0; i < N_NODES; i++) {
+		nodes[i] = zk_node_cache_alloc(24);
+		TEST_ASSERT_NOT_NULL(nodes[i]);
+		TEST_ASSERT_EQUAL(N_NODES - i - 1, zk_node_cache_reserved(24));
+	}
+
+	for (size_t i = 0; i < N_NODES; i++)
+		zk_node_cache_free(nodes[i], 24);
+}
+
+void test_zk_node_cache_reserve_is_kept_while_freed_nodes_are_reused(void)
+{
+	TEST_ASSERT_EQUAL(ZK_OK, zk_node_cache_reserve(16, 4));
+	for (size_t i = 0; i < N_NODES; i++) {
+		void *node = zk_node_cache_alloc(16);
+		zk_node_cache_free(node, 16);
+	}
+	// the first allocation used the reserve, the others the node it freed
+	TEST_ASSERT_EQUAL(3, zk_node_cache_reserved(16));
+}
+
+void test_zk_node_cache_trim_releases_the_reserve(void)
+{
+	TEST_ASSERT_EQUAL(ZK_OK, zk_node_cache_reserve(16, 8));
+	zk_node_cache_trim();
+	TEST_ASSERT_EQUAL(0, zk_node_cache_reserved(16));
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+
+	/*--------------- Test Allocation ---------------*/
+	RUN_TEST(test_zk_node_cache_alloc_and_free_any_size);
+#if ZK_NODE_CACHE
+	RUN_TEST(test_zk_node_cache_reuses_the_last_node_of_the_same_class);
+	RUN_TEST(test_zk_node_cache_exchanges_batches_through_the_depot);
+	RUN_TEST(test_zk_node_cache_is_used_by_lists);
+#endif
+
+	/*--------------- Test Reserve ---------------*/
+	RUN_TEST(test_zk_node_cache_reserve_when_size_is_invalid);
+	RUN_TEST(test_zk_node_cache_reserve_serves_the_next_allocations);
+#if ZK_NODE_CACHE
+	RUN_TEST(test_zk_node_cache_reserve_is_kept_while_freed_nodes_are_reused);
+#endif
+	RUN_TEST(test_zk_node_cache_trim_releases_the_reserve);
+
+	return UNITY_END();
+}
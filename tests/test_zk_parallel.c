@@ -0,0 +1,172 @@
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "zk_iter/zk_iter.h"
+#include "zk_parallel/zk_parallel.h"
+
+#define N_TASKS 8
+#define N_NODES 100003
+
+struct task {
+	size_t index;
+	size_t runs;
+	pthread_t thread;
+};
+
+void setUp(void)
+{
+	// set stuff up here
+}
+
+void tearDown(void)
+{
+	// clean stuff up here
+}
+
+static void run_task(void *data)
+{
+	struct task *task = data;
+	task->runs++;
+	task->thread = pthread_self();
+}
+
+/*--------------- Test Execution ---------------*/
+void test_zk_parallel_run_when_arguments_are_invalid(void)
+{
+	struct task tasks[1] = { 0 };
+
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_parallel_run(NULL, sizeof(struct task), 1, run_task));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_parallel_run(tasks, 0, 1, run_task));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_parallel_run(tasks, sizeof(struct task), 0, run_task));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_parallel_run(tasks, sizeof(struct task), 1, NULL));
+	TEST_ASSERT_EQUAL(0, tasks[0].runs);
+}
+
+void test_zk_parallel_run_single_task_runs_on_calling_thread(void)
+{
+	struct task tasks[1] = { 0 };
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_parallel_run(tasks, sizeof(struct task), 1, run_task));
+
+	TEST_ASSERT_EQUAL(1, tasks[0].runs);
+	TEST_ASSERT(pthread_equal(tasks[0].thread, pthread_self()));
+}
+
+void test_zk_parallel_run_runs_every_task_once(void)
+{
+	struct task tasks[N_TASKS] = { 0 };
+
+	for (size_t i = 0; i < N_TASKS; i++)
+		tasks[i].index = i;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_parallel_run(tasks, sizeof(struct task), N_TASKS, run_task));
+
+	for (size_t i = 0; i < N_TASKS; i++) {
+		TEST_ASSERT_EQUAL(i, tasks[i].index);
+		TEST_ASSERT_EQUAL(1, tasks[i].runs);
+	}
+	// the first task runs on the calling thread, the others on workers
+	TEST_ASSERT(pthread_equal(tasks[0].thread, pthread_self()));
+	for (size_t i = 1; i < N_TASKS; i++)
+		TEST_ASSERT(!pthread_equal(tasks[i].thread, pthread_self()));
+}
+
+/*--------------- Test Split ---------------*/
+static struct zk_iter_node *new_chain(size_t const n)
+{
+	struct zk_iter_node *nodes = calloc(n, sizeof(struct zk_iter_node));
+	for (size_t i = 0; i + 1 < n; i++)
+		nodes[i].next = &nodes[i + 1];
+	return nodes;
+}
+
+static size_t chunk_length(struct zk_iter_node *begin, const void *const end)
+{
+	size_t length = 0;
+	for (; begin != end; begin = begin->next)
+		length++;
+	return length;
+}
+
+void test_zk_parallel_split_when_arguments_are_invalid(void)
+{
+	void *bounds[2];
+	size_t count = 0;
+
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_parallel_split(NULL, NULL, 0, bounds, &count));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_parallel_split(NULL, NULL, 1, NULL, &count));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_parallel_split(NULL, NULL, 1, bounds, NULL));
+}
+
+void test_zk_parallel_split_empty_range(void)
+{
+	void *bounds[5];
+	size_t count = 1;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_parallel_split(NULL, NULL, 4, bounds, &count));
+	TEST_ASSERT_EQUAL(0, count);
+	TEST_ASSERT_NULL(bounds[0]);
+}
+
+void test_zk_parallel_split_short_range_exactly(void)
+{
+	struct zk_iter_node *nodes = new_chain(10);
+	void *bounds[17];
+	size_t count = 0;
+
+	// a range ending before the last node
+	TEST_ASSERT_EQUAL(ZK_OK, zk_parallel_split(nodes, &nodes[9], 4, bounds, &count));
+	TEST_ASSERT_EQUAL(4, count);
+	TEST_ASSERT_EQUAL_PTR(nodes, bounds[0]);
+	TEST_ASSERT_EQUAL_PTR(&nodes[9], bounds[4]);
+	for (size_t i = 0; i < count; i++) {
+		size_t const length = chunk_length(bounds[i], bounds[i + 1]);
+		TEST_ASSERT(length == 2 || length == 3);
+	}
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_parallel_split(nodes, NULL, 16, bounds, &count));
+	TEST_ASSERT_EQUAL(10, count);
+
+	free(nodes);
+}
+
+void test_zk_parallel_split_long_range_in_one_walk(void)
+{
+	struct zk_iter_node *nodes = new_chain(N_NODES);
+	void *bounds[N_TASKS + 1];
+	size_t count = 0;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_parallel_split(nodes, NULL, N_TASKS, bounds, &count));
+	TEST_ASSERT_EQUAL(N_TASKS, count);
+	TEST_ASSERT_NULL(bounds[N_TASKS]);
+
+	size_t total = 0;
+	size_t const tolerance = N_NODES / (ZK_PARALLEL_SPLIT_MARKS / 2 * N_TASKS - 1);
+	for (size_t i = 0; i < count; i++) {
+		size_t const length = chunk_length(bounds[i], bounds[i + 1]);
+		TEST_ASSERT(length + tolerance >= N_NODES / N_TASKS && length <= N_NODES / N_TASKS + tolerance);
+		total += length;
+	}
+	TEST_ASSERT_EQUAL(N_NODES, total);
+
+	free(nodes);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+
+	/*--------------- Test Execution ---------------*/
+	RUN_TEST(test_zk_parallel_run_when_arguments_are_invalid);
+	RUN_TEST(test_zk_parallel_run_single_task_runs_on_calling_thread);
+	RUN_TEST(test_zk_parallel_run_runs_every_task_once);
+
+	/*--------------- Test Split ---------------*/
+	RUN_TEST(test_zk_parallel_split_when_arguments_are_invalid);
+	RUN_TEST(test_zk_parallel_split_empty_range);
+	RUN_TEST(test_zk_parallel_split_short_range_exactly);
+	RUN_TEST(test_zk_parallel_split_long_range_in_one_walk);
+
+	return UNITY_END();
+}
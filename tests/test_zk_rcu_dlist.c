@@ -0,0 +1,317 @@
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "zk_ebr/zk_ebr.h"
+#include "zk_rcu_dlist/zk_rcu_dlist.h"
+
+#define N_READERS 3
+#define N_ROUTES  16
+#define N_UPDATES 5000
+#define MAGIC     0x600dcafe
+
+struct route {
+	unsigned magic;
+	int key;
+	int value;
+};
+
+static size_t destroyed;
+
+void setUp(void)
+{
+	// set stuff up here
+	__atomic_store_n(&destroyed, 0, __ATOMIC_RELAXED);
+}
+
+void tearDown(void)
+{
+	// clean stuff up here
+}
+
+static struct route *new_route(int const key, int const value)
+{
+	struct route *route = malloc(sizeof(struct route));
+	route->magic = MAGIC;
+	route->key = key;
+	route->value = value;
+	return route;
+}
+
+static void free_route(void *data)
+{
+	struct route *route = data;
+	route->magic = 0;
+	free(route);
+	__atomic_fetch_add(&destroyed, 1, __ATOMIC_RELAXED);
+}
+
+static int compare_key(const void *const a, const void *const b)
+{
+	return ((const struct route *)a)->key - ((const struct route *)b)->key;
+}
+
+struct collect {
+	int keys[16];
+	size_t count;
+};
+
+static void collect_key(void *data, void *user_data)
+{
+	struct collect *collect = user_data;
+	collect->keys[collect->count++] = ((struct route *)data)->key;
+}
+
+/*--------------- Test Constructor ---------------*/
+void test_zk_rcu_dlist_new_when_arguments_are_invalid(void)
+{
+	struct route route = { MAGIC, 1, 1 };
+
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_rcu_dlist_new(NULL));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_rcu_dlist_push_back(NULL, &route));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_rcu_dlist_push_front(NULL, &route));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_rcu_dlist_replace(NULL, &route, compare_key, &route, NULL));
+	TEST_ASSERT_FALSE(zk_rcu_dlist_remove(NULL, &route, compare_key, NULL));
+	TEST_ASSERT_NULL(zk_rcu_dlist_find(NULL, &route, compare_key));
+	TEST_ASSERT_EQUAL(0, zk_rcu_dlist_size(NULL));
+	zk_rcu_dlist_for_each(NULL, collect_key, NULL);
+}
+
+void test_zk_rcu_dlist_new_and_free(void)
+{
+	zk_rcu_dlist *list = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_rcu_dlist_new(&list));
+	TEST_ASSERT_NOT_NULL(list);
+	TEST_ASSERT_EQUAL(0, zk_rcu_dlist_size(list));
+
+	zk_rcu_dlist_free(&list, NULL);
+	TEST_ASSERT_NULL(list);
+	zk_rcu_dlist_free(&list, NULL);
+	zk_rcu_dlist_free(NULL, NULL);
+}
+
+void test_zk_rcu_dlist_from_dlist(void)
+{
+	struct route routes[3] = { { MAGIC, 1, 10 }, { MAGIC, 2, 20 }, { MAGIC, 3, 30 } };
+	zk_rcu_dlist *list = NULL;
+	zk_dlist *dlist = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_rcu_dlist_from_dlist(NULL, &dlist));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_rcu_dlist_from_dlist(&list, NULL));
+
+	// an empty zk_dlist gives an empty list
+	TEST_ASSERT_EQUAL(ZK_OK, zk_rcu_dlist_from_dlist(&list, &dlist));
+	TEST_ASSERT_EQUAL(0, zk_rcu_dlist_size(list));
+	zk_rcu_dlist_free(&list, NULL);
+
+	for (int i = 0; i < 3; i++)
+		TEST_ASSERT_EQUAL(ZK_OK, zk_dlist_push_back(&dlist, &routes[i]));
+	TEST_ASSERT_EQUAL(ZK_OK, zk_rcu_dlist_from_dlist(&list, &dlist));
+	TEST_ASSERT_NULL(dlist);
+	TEST_ASSERT_EQUAL(3, zk_rcu_dlist_size(list));
+
+	struct collect collect = { .count = 0 };
+	zk_rcu_dlist_for_each(list, collect_key, &collect);
+	TEST_ASSERT_EQUAL(3, collect.count);
+	for (int i = 0; i < 3; i++)
+		TEST_ASSERT_EQUAL(i + 1, collect.keys[i]);
+
+	zk_rcu_dlist_free(&list, NULL);
+}
+
+/*--------------- Test Lookup ---------------*/
+void test_zk_rcu_dlist_find(void)
+{
+	zk_rcu_dlist *list = NULL;
+	struct route routes[3] = { { MAGIC, 1, 10 }, { MAGIC, 2, 20 }, { MAGIC, 2, 30 } };
+	struct route const missing = { MAGIC, 7, 0 };
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_rcu_dlist_new(&list));
+	TEST_ASSERT_NULL(zk_rcu_dlist_find(list, &routes[0], compare_key));
+	for (int i = 0; i < 3; i++)
+		zk_rcu_dlist_push_back(list, &routes[i]);
+
+	zk_ebr_enter();
+	TEST_ASSERT_EQUAL_PTR(&routes[1], zk_rcu_dlist_find(list, &routes[2], compare_key));
+	TEST_ASSERT_NULL(zk_rcu_dlist_find(list, &missing, compare_key));
+	TEST_ASSERT_NULL(zk_rcu_dlist_find(list, &missing, NULL));
+	zk_ebr_exit();
+
+	zk_rcu_dlist_free(&list, NULL);
+}
+
+/*--------------- Test Modifiers ---------------*/
+void test_zk_rcu_dlist_push_and_remove(void)
+{
+	zk_rcu_dlist *list = NULL;
+	struct collect collect = { .count = 0 };
+	struct route const keys[5] = { { MAGIC, 0, 0 }, { MAGIC, 1, 0 }, { MAGIC, 2, 0 }, { MAGIC, 3, 0 }, { MAGIC, 9, 0 } };
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_rcu_dlist_new(&list));
+	TEST_ASSERT_EQUAL(ZK_OK, zk_rcu_dlist_push_back(list, new_route(1, 0)));
+	TEST_ASSERT_EQUAL(ZK_OK, zk_rcu_dlist_push_back(list, new_route(2, 0)));
+	TEST_ASSERT_EQUAL(ZK_OK, zk_rcu_dlist_push_front(list, new_route(0, 0)));
+	TEST_ASSERT_EQUAL(ZK_OK, zk_rcu_dlist_push_back(list, new_route(3, 0)));
+	TEST_ASSERT_EQUAL(4, zk_rcu_dlist_size(list));
+
+	// middle, front and back
+	TEST_ASSERT_FALSE(zk_rcu_dlist_remove(list, &keys[4], compare_key, free_route));
+	TEST_ASSERT_TRUE(zk_rcu_dlist_remove(list, &keys[2], compare_key, free_route));
+	TEST_ASSERT_TRUE(zk_rcu_dlist_remove(list, &keys[0], compare_key, free_route));
+	TEST_ASSERT_TRUE(zk_rcu_dlist_remove(list, &keys[3], compare_key, free_route));
+	TEST_ASSERT_EQUAL(1, zk_rcu_dlist_size(list));
+
+	// the tail is updated after removing the back
+	TEST_ASSERT_EQUAL(ZK_OK, zk_rcu_dlist_push_back(list, new_route(3, 0)));
+	TEST_ASSERT_EQUAL(ZK_OK, zk_rcu_dlist_push_front(list, new_route(0, 0)));
+	zk_rcu_dlist_for_each(list, collect_key, &collect);
+	TEST_ASSERT_EQUAL(3, collect.count);
+	TEST_ASSERT_EQUAL(0, collect.keys[0]);
+	TEST_ASSERT_EQUAL(1, collect.keys[1]);
+	TEST_ASSERT_EQUAL(3, collect.keys[2]);
+
+	TEST_ASSERT_TRUE(zk_rcu_dlist_remove(list, &keys[0], compare_key, free_route));
+	TEST_ASSERT_TRUE(zk_rcu_dlist_remove(list, &keys[1], compare_key, free_route));
+	TEST_ASSERT_TRUE(zk_rcu_dlist_remove(list, &keys[3], compare_key, free_route));
+	TEST_ASSERT_EQUAL(0, zk_rcu_dlist_size(list));
+	TEST_ASSERT_EQUAL(ZK_OK, zk_rcu_dlist_push_back(list, new_route(5, 0)));
+	TEST_ASSERT_EQUAL(1, zk_rcu_dlist_size(list));
+
+	// removed routes are freed after a grace period, the last one with the list
+	zk_rcu_dlist_free(&list, free_route);
+	TEST_ASSERT_EQUAL(7, destroyed);
+}
+
+void test_zk_rcu_dlist_replace(void)
+{
+	zk_rcu_dlist *list = NULL;
+	struct route const key = { MAGIC, 2, 0 };
+	struct route const missing = { MAGIC, 7, 0 };
+	struct collect collect = { .count = 0 };
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_rcu_dlist_new(&list));
+	for (int i = 1; i <= 3; i++)
+		zk_rcu_dlist_push_back(list, new_route(i, i * 10));
+
+	struct route *route = new_route(7, 0);
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_rcu_dlist_replace(list, &missing, compare_key, route, free_route));
+	free(route);
+
+	zk_ebr_enter();
+	struct route *old = zk_rcu_dlist_find(list, &key, compare_key);
+	TEST_ASSERT_EQUAL(ZK_OK, zk_rcu_dlist_replace(list, &key, compare_key, new_route(2, 200), free_route));
+	// a reader still holding the old version can use it until it leaves the critical section
+	zk_ebr_barrier();
+	TEST_ASSERT_EQUAL(20, old->value);
+	TEST_ASSERT_EQUAL(200, ((struct route *)zk_rcu_dlist_find(list, &key, compare_key))->value);
+	zk_ebr_exit();
+
+	zk_rcu_dlist_for_each(list, collect_key, &collect);
+	TEST_ASSERT_EQUAL(3, collect.count);
+	TEST_ASSERT_EQUAL(2, collect.keys[1]);
+	TEST_ASSERT_EQUAL(3, zk_rcu_dlist_size(list));
+
+	zk_rcu_dlist_free(&list, free_route);
+	TEST_ASSERT_EQUAL(4, destroyed);
+}
+
+/*
+ * Readers walk a routing table while a writer keeps replacing its routes and removing and appending an extra route.
+ * Every traversal must see the fixed routes once each and in order, with their current value, and never a freed route.
+ */
+struct stress_context {
+	zk_rcu_dlist *list;
+	bool done;
+	bool valid[N_READERS];
+};
+
+struct stress_walk {
+	int next_key;
+	bool valid;
+};
+
+static void stress_visit(void *data, void *user_data)
+{
+	struct route *route = data;
+	struct stress_walk *walk = user_data;
+	if (route->magic != MAGIC || route->value != route->key * 10)
+		walk->valid = false;
+	if (route->key < N_ROUTES) {
+		walk->valid &= route->key == walk->next_key;
+		walk->next_key++;
+	}
+}
+
+struct stress_reader {
+	struct stress_context *ctx;
+	size_t index;
+};
+
+static void *stress_read(void *arg)
+{
+	struct stress_reader *reader = arg;
+	struct stress_context *ctx = reader->ctx;
+	bool valid = true;
+
+	while (!__atomic_load_n(&ctx->done, __ATOMIC_ACQUIRE)) {
+		struct stress_walk walk = { 0, true };
+		zk_rcu_dlist_for_each(ctx->list, stress_visit, &walk);
+		valid &= walk.valid && walk.next_key == N_ROUTES;
+	}
+	ctx->valid[reader->index] = valid;
+	return NULL;
+}
+
+void test_zk_rcu_dlist_concurrent_readers(void)
+{
+	struct stress_context ctx = { .done = false };
+	struct stress_reader readers[N_READERS];
+	pthread_t threads[N_READERS];
+	struct route const extra = { MAGIC, N_ROUTES, 0 };
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_rcu_dlist_new(&ctx.list));
+	for (int i = 0; i < N_ROUTES; i++)
+		zk_rcu_dlist_push_back(ctx.list, new_route(i, i * 10));
+	for (size_t t = 0; t < N_READERS; t++) {
+		readers[t] = (struct stress_reader){ &ctx, t };
+		pthread_create(&threads[t], NULL, stress_read, &readers[t]);
+	}
+
+	for (int i = 0; i < N_UPDATES; i++) {
+		struct route *route = new_route(i % N_ROUTES, i % N_ROUTES * 10);
+		TEST_ASSERT_EQUAL(ZK_OK, zk_rcu_dlist_replace(ctx.list, route, compare_key, route, free_route));
+		if (i % 2 == 0)
+			zk_rcu_dlist_push_back(ctx.list, new_route(N_ROUTES, N_ROUTES * 10));
+		else
+			zk_rcu_dlist_remove(ctx.list, &extra, compare_key, free_route);
+	}
+	__atomic_store_n(&ctx.done, true, __ATOMIC_RELEASE);
+	for (size_t t = 0; t < N_READERS; t++) {
+		pthread_join(threads[t], NULL);
+		TEST_ASSERT_TRUE(ctx.valid[t]);
+	}
+
+	zk_rcu_dlist_free(&ctx.list, free_route);
+	TEST_ASSERT_EQUAL(N_ROUTES + N_UPDATES + N_UPDATES / 2, destroyed);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+
+	/*--------------- Test Constructor ---------------*/
+	RUN_TEST(test_zk_rcu_dlist_new_when_arguments_are_invalid);
+	RUN_TEST(test_zk_rcu_dlist_new_and_free);
+	RUN_TEST(test_zk_rcu_dlist_from_dlist);
+
+	/*--------------- Test Lookup ---------------*/
+	RUN_TEST(test_zk_rcu_dlist_find);
+
+	/*--------------- Test Modifiers ---------------*/
+	RUN_TEST(test_zk_rcu_dlist_push_and_remove);
+	RUN_TEST(test_zk_rcu_dlist_replace);
+	RUN_TEST(test_zk_rcu_dlist_concurrent_readers);
+
+	return UNITY_END();
+}
@@ -0,0 +1,135 @@
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "zk_reclaim/zk_reclaim.h"
+
+void setUp(void)
+{
+	// set stuff up here
+}
+
+void tearDown(void)
+{
+	// clean stuff up here
+}
+
+/*
+ * Test container: an array of data freed by the reclaimer. The first container of the full queue test blocks the
+ * reclaimer until the test opens the gate.
+ */
+struct container {
+	void *data[4];
+	size_t count;
+	bool blocked;
+};
+
+static pthread_mutex_t gate_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t gate_cond = PTHREAD_COND_INITIALIZER;
+static bool gate_open = true;
+static bool gate_reached;
+static size_t freed;
+
+static void set_gate(bool const open)
+{
+	pthread_mutex_lock(&gate_mutex);
+	gate_open = open;
+	pthread_cond_broadcast(&gate_cond);
+	pthread_mutex_unlock(&gate_mutex);
+}
+
+static void free_container(void *container, zk_destructor_t func)
+{
+	struct container *c = container;
+
+	if (c->blocked) {
+		pthread_mutex_lock(&gate_mutex);
+		gate_reached = true;
+		pthread_cond_broadcast(&gate_cond);
+		while (!gate_open)
+			pthread_cond_wait(&gate_cond, &gate_mutex);
+		pthread_mutex_unlock(&gate_mutex);
+	}
+	for (size_t i = 0; func != NULL && i < c->count; i++)
+		func(c->data[i]);
+	free(c);
+	__atomic_fetch_add(&freed, 1, __ATOMIC_RELAXED);
+}
+
+static struct container *new_container(size_t const count, bool const blocked)
+{
+	struct container *c = calloc(1, sizeof(struct container));
+	for (size_t i = 0; i < count; i++)
+		c->data[i] = malloc(16);
+	c->count = count;
+	c->blocked = blocked;
+	return c;
+}
+
+/*--------------- Test Reclamation ---------------*/
+void test_zk_reclaim_submit_when_arguments_are_invalid(void)
+{
+	struct container c = { .count = 0 };
+
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_reclaim_submit(NULL, free_container, NULL));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_reclaim_submit(&c, NULL, NULL));
+	TEST_ASSERT_EQUAL(0, zk_reclaim_pending());
+	zk_reclaim_flush();
+}
+
+void test_zk_reclaim_submit_and_flush(void)
+{
+	freed = 0;
+	for (size_t i = 0; i < 10; i++)
+		TEST_ASSERT_EQUAL(ZK_OK, zk_reclaim_submit(new_container(i % 4, false), free_container, free));
+
+	zk_reclaim_flush();
+	TEST_ASSERT_EQUAL(0, zk_reclaim_pending());
+	TEST_ASSERT_EQUAL(10, __atomic_load_n(&freed, __ATOMIC_RELAXED));
+}
+
+void test_zk_reclaim_submit_when_queue_is_full(void)
+{
+	struct container *rejected = new_container(2, false);
+	struct container *last = NULL;
+
+	freed = 0;
+	set_gate(false);
+	TEST_ASSERT_EQUAL(ZK_OK, zk_reclaim_submit(new_container(1, true), free_container, free));
+	pthread_mutex_lock(&gate_mutex);
+	while (!gate_reached)
+		pthread_cond_wait(&gate_cond, &gate_mutex);
+	pthread_mutex_unlock(&gate_mutex);
+
+	// the blocked container left the queue, which now fills up behind it
+	size_t submitted = 1;
+	while (zk_reclaim_submit(last = new_container(1, false), free_container, free) == ZK_OK)
+		submitted++;
+	TEST_ASSERT_EQUAL(ZK_RECLAIM_QUEUE_SIZE + 1, submitted);
+	TEST_ASSERT_EQUAL(ZK_ERROR_FULL, zk_reclaim_submit(rejected, free_container, free));
+	TEST_ASSERT_EQUAL(submitted, zk_reclaim_pending());
+	TEST_ASSERT_EQUAL(0, __atomic_load_n(&freed, __ATOMIC_RELAXED));
+
+	set_gate(true);
+	zk_reclaim_flush();
+	TEST_ASSERT_EQUAL(0, zk_reclaim_pending());
+	TEST_ASSERT_EQUAL(submitted, __atomic_load_n(&freed, __ATOMIC_RELAXED));
+
+	// rejected containers still belong to the caller
+	TEST_ASSERT_EQUAL(ZK_OK, zk_reclaim_submit(rejected, free_container, free));
+	zk_reclaim_flush();
+	free_container(last, free);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+
+	/*--------------- Test Reclamation ---------------*/
+	RUN_TEST(test_zk_reclaim_submit_when_arguments_are_invalid);
+	RUN_TEST(test_zk_reclaim_submit_and_flush);
+	RUN_TEST(test_zk_reclaim_submit_when_queue_is_full);
+
+	return UNITY_END();
+}
@@ -0,0 +1,214 @@
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "zk_shard_slist/zk_shard_slist.h"
+
+#define N_THREADS    4
+#define N_OPS_THREAD 10000
+
+void setUp(void)
+{
+	// set stuff up here
+}
+
+void tearDown(void)
+{
+	// clean stuff up here
+}
+
+struct item {
+	int key;
+	size_t shard;
+	size_t order;
+};
+
+static int compare_key(const void *const a, const void *const b)
+{
+	int const x = ((const struct item *)a)->key;
+	int const y = ((const struct item *)b)->key;
+	return (x > y) - (x < y);
+}
+
+static int *new_int(int const value)
+{
+	int *data = malloc(sizeof(int));
+	*data = value;
+	return data;
+}
+
+/*--------------- Test Constructor ---------------*/
+void test_zk_shard_slist_new_when_arguments_are_invalid(void)
+{
+	zk_shard_slist *list = NULL;
+	int value = 0;
+
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_shard_slist_new(NULL, 4));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_shard_slist_new(&list, 0));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_shard_slist_new(&list, SIZE_MAX));
+	TEST_ASSERT_NULL(list);
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_shard_slist_push_back(NULL, 0, &value));
+	TEST_ASSERT_NULL(zk_shard_slist_combine(NULL));
+	TEST_ASSERT_NULL(zk_shard_slist_combine_sorted(NULL, compare_key));
+	TEST_ASSERT_EQUAL(0, zk_shard_slist_shards(NULL));
+	TEST_ASSERT_EQUAL(0, zk_shard_slist_size(NULL));
+}
+
+void test_zk_shard_slist_new_and_free(void)
+{
+	zk_shard_slist *list = NULL;
+	int value = 0;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_shard_slist_new(&list, 3));
+	TEST_ASSERT_NOT_NULL(list);
+	TEST_ASSERT_EQUAL(3, zk_shard_slist_shards(list));
+	TEST_ASSERT_EQUAL(0, zk_shard_slist_size(list));
+	TEST_ASSERT_NULL(zk_shard_slist_combine(list));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_shard_slist_push_back(list, 3, &value));
+
+	zk_shard_slist_free(&list, NULL);
+	TEST_ASSERT_NULL(list);
+	zk_shard_slist_free(&list, NULL);
+	zk_shard_slist_free(NULL, NULL);
+}
+
+void test_zk_shard_slist_free_applies_destructor(void)
+{
+	zk_shard_slist *list = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_shard_slist_new(&list, 3));
+	for (int i = 0; i < 10; i++)
+		TEST_ASSERT_EQUAL(ZK_OK, zk_shard_slist_push_back(list, (size_t)i % 2, new_int(i)));
+
+	// leak checkers report the values if the destructor is not applied to every shard
+	zk_shard_slist_free(&list, free);
+}
+
+/*--------------- Test Modifiers ---------------*/
+void test_zk_shard_slist_combine_keeps_shard_then_append_order(void)
+{
+	zk_shard_slist *list = NULL;
+	int values[9];
+	size_t const shards[] = { 2, 0, 2, 0, 3, 2, 0, 3, 3 };
+	int const expected[] = { 1, 3, 6, 0, 2, 5, 4, 7, 8 };
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_shard_slist_new(&list, 4));
+	for (int i = 0; i < 9; i++) {
+		values[i] = i;
+		TEST_ASSERT_EQUAL(ZK_OK, zk_shard_slist_push_back(list, shards[i], &values[i]));
+	}
+	TEST_ASSERT_EQUAL(9, zk_shard_slist_size(list));
+
+	zk_slist *combined = zk_shard_slist_combine(list);
+	TEST_ASSERT_EQUAL(9, zk_slist_size(combined));
+	zk_slist *node = combined;
+	for (size_t i = 0; i < 9; i++, node = node->next)
+		TEST_ASSERT_EQUAL(expected[i], *(int *)node->data);
+	TEST_ASSERT_EQUAL(0, zk_shard_slist_size(list));
+	TEST_ASSERT_NULL(zk_shard_slist_combine(list));
+
+	// shards are reusable once combined
+	TEST_ASSERT_EQUAL(ZK_OK, zk_shard_slist_push_back(list, 1, &values[0]));
+	TEST_ASSERT_EQUAL(1, zk_shard_slist_size(list));
+
+	zk_slist_free(&combined, NULL);
+	zk_shard_slist_free(&list, NULL);
+}
+
+void test_zk_shard_slist_combine_sorted_is_stable(void)
+{
+	zk_shard_slist *list = NULL;
+	struct item items[60];
+	size_t const shards = 5;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_shard_slist_new(&list, shards));
+	for (size_t i = 0; i < 60; i++) {
+		items[i] = (struct item){ .key = (int)((i * 7) % 10), .shard = (i * 3) % shards, .order = i };
+		TEST_ASSERT_EQUAL(ZK_OK, zk_shard_slist_push_back(list, items[i].shard, &items[i]));
+	}
+
+	zk_slist *sorted = zk_shard_slist_combine_sorted(list, compare_key);
+	TEST_ASSERT_EQUAL(60, zk_slist_size(sorted));
+	TEST_ASSERT_EQUAL(0, zk_shard_slist_size(list));
+	for (zk_slist *node = sorted; node->next != NULL; node = node->next) {
+		const struct item *a = node->data;
+		const struct item *b = node->next->data;
+		TEST_ASSERT_TRUE(a->key <= b->key);
+		if (a->key == b->key) {
+			TEST_ASSERT_TRUE(a->shard <= b->shard);
+			if (a->shard == b->shard)
+				TEST_ASSERT_TRUE(a->order < b->order);
+		}
+	}
+
+	zk_slist_free(&sorted, NULL);
+	zk_shard_slist_free(&list, NULL);
+}
+
+/*
+ * Every thread appends to its own shard, then the main thread combines the shards after joining the threads and checks
+ * that every element is there once, in the append order of its thread.
+ */
+struct stress_context {
+	zk_shard_slist *list;
+	size_t thread;
+	bool valid;
+};
+
+static void *stress_append(void *arg)
+{
+	struct stress_context *ctx = arg;
+
+	for (uintptr_t i = 0; i < N_OPS_THREAD; i++) {
+		void *const data = (void *)(ctx->thread * N_OPS_THREAD + i + 1);
+		if (zk_shard_slist_push_back(ctx->list, ctx->thread, data) != ZK_OK)
+			ctx->valid = false;
+	}
+	return NULL;
+}
+
+void test_zk_shard_slist_concurrent_appends(void)
+{
+	zk_shard_slist *list = NULL;
+	pthread_t threads[N_THREADS];
+	struct stress_context ctx[N_THREADS];
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_shard_slist_new(&list, N_THREADS));
+	for (size_t t = 0; t < N_THREADS; t++) {
+		ctx[t] = (struct stress_context){ .list = list, .thread = t, .valid = true };
+		pthread_create(&threads[t], NULL, stress_append, &ctx[t]);
+	}
+	for (size_t t = 0; t < N_THREADS; t++)
+		pthread_join(threads[t], NULL);
+
+	for (size_t t = 0; t < N_THREADS; t++)
+		TEST_ASSERT_TRUE(ctx[t].valid);
+	TEST_ASSERT_EQUAL(N_THREADS * N_OPS_THREAD, zk_shard_slist_size(list));
+
+	zk_slist *combined = zk_shard_slist_combine(list);
+	uintptr_t expected = 1;
+	for (zk_slist *node = combined; node != NULL; node = node->next)
+		TEST_ASSERT_EQUAL(expected++, (uintptr_t)node->data);
+	TEST_ASSERT_EQUAL(N_THREADS * N_OPS_THREAD + 1, expected);
+
+	zk_slist_free(&combined, NULL);
+	zk_shard_slist_free(&list, NULL);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+
+	/*--------------- Test Constructor ---------------*/
+	RUN_TEST(test_zk_shard_slist_new_when_arguments_are_invalid);
+	RUN_TEST(test_zk_shard_slist_new_and_free);
+	RUN_TEST(test_zk_shard_slist_free_applies_destructor);
+
+	/*--------------- Test Modifiers ---------------*/
+	RUN_TEST(test_zk_shard_slist_combine_keeps_shard_then_append_order);
+	RUN_TEST(test_zk_shard_slist_combine_sorted_is_stable);
+	RUN_TEST(test_zk_shard_slist_concurrent_appends);
+
+	return UNITY_END();
+}
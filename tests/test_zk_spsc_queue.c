@@ -0,0 +1,239 @@
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "zk_container/zk_container.h"
+
+#define CAPACITY   8
+#define N_ELEMENTS 200000
+
+void setUp(void)
+{
+	// set stuff up here
+}
+
+void tearDown(void)
+{
+	// clean stuff up here
+}
+
+/*--------------- Test Constructor ---------------*/
+void test_zk_spsc_queue_new_when_arguments_are_invalid(void)
+{
+	zk_spsc_queue *queue = NULL;
+	void *data = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_spsc_queue_new(NULL, CAPACITY));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_spsc_queue_new(&queue, 0));
+	TEST_ASSERT_NULL(queue);
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_spsc_queue_push_back(NULL, &data));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_spsc_queue_pop_front(NULL, NULL));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_spsc_queue_front(NULL, &data));
+	TEST_ASSERT_FALSE(zk_spsc_queue_enqueue(NULL, &data));
+	TEST_ASSERT_FALSE(zk_spsc_queue_dequeue(NULL, &data));
+	TEST_ASSERT_EQUAL(0, zk_spsc_queue_enqueue_batch(NULL, &data, 1));
+	TEST_ASSERT_EQUAL(0, zk_spsc_queue_dequeue_batch(NULL, &data, 1));
+	TEST_ASSERT_EQUAL(0, zk_spsc_queue_size(NULL));
+	TEST_ASSERT_EQUAL(0, zk_spsc_queue_capacity(NULL));
+}
+
+void test_zk_spsc_queue_new_and_free(void)
+{
+	zk_spsc_queue *queue = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_spsc_queue_new(&queue, 5));
+	TEST_ASSERT_NOT_NULL(queue);
+	TEST_ASSERT_EQUAL(8, zk_spsc_queue_capacity(queue));
+	TEST_ASSERT_EQUAL(0, zk_spsc_queue_size(queue));
+
+	zk_spsc_queue_free(&queue, NULL);
+	TEST_ASSERT_NULL(queue);
+	zk_spsc_queue_free(&queue, NULL);
+	zk_spsc_queue_free(NULL, NULL);
+}
+
+/*--------------- Test Element access ---------------*/
+void test_zk_spsc_queue_front(void)
+{
+	zk_spsc_queue *queue = NULL;
+	int values[2] = { 1, 2 };
+	void *data = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_spsc_queue_new(&queue, CAPACITY));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_spsc_queue_front(queue, &data));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_spsc_queue_front(queue, NULL));
+
+	zk_push_back(queue, &values[0]);
+	zk_push_back(queue, &values[1]);
+	TEST_ASSERT_EQUAL(ZK_OK, zk_get_data(queue, &data));
+	TEST_ASSERT_EQUAL_PTR(&values[0], data);
+	TEST_ASSERT_EQUAL(2, zk_spsc_queue_size(queue));
+
+	zk_free(&queue, NULL);
+}
+
+/*--------------- Test Modifiers ---------------*/
+void test_zk_spsc_queue_push_back_and_pop_front(void)
+{
+	zk_spsc_queue *queue = NULL;
+	int values[CAPACITY + 1];
+	void *data = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_spsc_queue_new(&queue, CAPACITY));
+	for (int round = 0; round < 3; round++) {
+		for (int i = 0; i < CAPACITY; i++)
+			TEST_ASSERT_EQUAL(ZK_OK, zk_push_back(queue, &values[i]));
+		TEST_ASSERT_EQUAL(ZK_ERROR_FULL, zk_push_back(queue, &values[CAPACITY]));
+		TEST_ASSERT_EQUAL(CAPACITY, zk_spsc_queue_size(queue));
+
+		for (int i = 0; i < CAPACITY; i++) {
+			TEST_ASSERT_EQUAL(ZK_OK, zk_get_data(queue, &data));
+			TEST_ASSERT_EQUAL_PTR(&values[i], data);
+			TEST_ASSERT_EQUAL(ZK_OK, zk_pop_front(queue, NULL));
+		}
+		TEST_ASSERT_EQUAL(0, zk_spsc_queue_size(queue));
+		TEST_ASSERT_EQUAL(ZK_OK, zk_pop_front(queue, NULL));
+	}
+
+	zk_free(&queue, NULL);
+}
+
+void test_zk_spsc_queue_enqueue_and_dequeue_wrap_around(void)
+{
+	zk_spsc_queue *queue = NULL;
+	void *data = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_spsc_queue_new(&queue, CAPACITY));
+	TEST_ASSERT_FALSE(zk_spsc_queue_dequeue(queue, &data));
+
+	// keep the queue half full so head and tail wrap many times
+	for (uintptr_t i = 1; i <= CAPACITY / 2; i++)
+		TEST_ASSERT_TRUE(zk_spsc_queue_enqueue(queue, (void *)i));
+	for (uintptr_t i = 1; i <= 10 * CAPACITY; i++) {
+		TEST_ASSERT_TRUE(zk_spsc_queue_enqueue(queue, (void *)(i + CAPACITY / 2)));
+		TEST_ASSERT_TRUE(zk_spsc_queue_dequeue(queue, &data));
+		TEST_ASSERT_EQUAL_PTR((void *)i, data);
+	}
+	TEST_ASSERT_EQUAL(CAPACITY / 2, zk_spsc_queue_size(queue));
+
+	zk_free(&queue, NULL);
+}
+
+void test_zk_spsc_queue_batch(void)
+{
+	zk_spsc_queue *queue = NULL;
+	void *in[CAPACITY + 3];
+	void *out[CAPACITY + 3];
+
+	for (uintptr_t i = 0; i < CAPACITY + 3; i++)
+		in[i] = (void *)(i + 1);
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_spsc_queue_new(&queue, CAPACITY));
+	TEST_ASSERT_EQUAL(0, zk_spsc_queue_dequeue_batch(queue, out, CAPACITY));
+	TEST_ASSERT_EQUAL(0, zk_spsc_queue_enqueue_batch(queue, in, 0));
+
+	TEST_ASSERT_EQUAL(3, zk_spsc_queue_enqueue_batch(queue, in, 3));
+	TEST_ASSERT_EQUAL(2, zk_spsc_queue_dequeue_batch(queue, out, 2));
+	for (int i = 0; i < 2; i++)
+		TEST_ASSERT_EQUAL_PTR(in[i], out[i]);
+
+	// only the free slots are filled
+	TEST_ASSERT_EQUAL(CAPACITY - 1, zk_spsc_queue_enqueue_batch(queue, in + 3, CAPACITY + 3 - 3));
+	TEST_ASSERT_EQUAL(0, zk_spsc_queue_enqueue_batch(queue, in, 1));
+
+	TEST_ASSERT_EQUAL(CAPACITY, zk_spsc_queue_dequeue_batch(queue, out, CAPACITY + 3));
+	for (int i = 0; i < CAPACITY; i++)
+		TEST_ASSERT_EQUAL_PTR(in[i + 2], out[i]);
+	TEST_ASSERT_EQUAL(0, zk_spsc_queue_size(queue));
+
+	zk_free(&queue, NULL);
+}
+
+void test_zk_spsc_queue_free_applies_destructor(void)
+{
+	zk_spsc_queue *queue = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_spsc_queue_new(&queue, CAPACITY));
+	// wrap around so the remaining elements straddle the end of the ring
+	for (int i = 0; i < CAPACITY + 2; i++) {
+		int *value = malloc(sizeof(int));
+		*value = i;
+		TEST_ASSERT_EQUAL(ZK_OK, zk_push_back(queue, value));
+		if (i < 2)
+			TEST_ASSERT_EQUAL(ZK_OK, zk_pop_front(queue, free));
+	}
+	TEST_ASSERT_EQUAL(CAPACITY, zk_spsc_queue_size(queue));
+
+	// leak checkers report the values if the destructor is not applied
+	zk_free(&queue, free);
+}
+
+static void *stress_producer(void *arg)
+{
+	zk_spsc_queue *queue = arg;
+	void *batch[5];
+	uintptr_t next = 1;
+
+	while (next <= N_ELEMENTS) {
+		// alternate single and batch pushes of varying size
+		size_t n = next % 5 + 1;
+		if (n > N_ELEMENTS - next + 1)
+			n = N_ELEMENTS - next + 1;
+		for (size_t i = 0; i < n; i++)
+			batch[i] = (void *)(next + i);
+		size_t const pushed = n == 1 ? zk_spsc_queue_enqueue(queue, batch[0]) :
+		                               zk_spsc_queue_enqueue_batch(queue, batch, n);
+		next += pushed;
+		if (pushed < n)
+			sched_yield();
+	}
+	return NULL;
+}
+
+void test_zk_spsc_queue_concurrent_producer_and_consumer(void)
+{
+	zk_spsc_queue *queue = NULL;
+	pthread_t producer;
+	void *batch[7];
+	uintptr_t expected = 1;
+	bool ordered = true;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_spsc_queue_new(&queue, CAPACITY));
+	pthread_create(&producer, NULL, stress_producer, queue);
+	while (expected <= N_ELEMENTS) {
+		size_t const n = zk_spsc_queue_dequeue_batch(queue, batch, expected % 7 + 1);
+		for (size_t i = 0; i < n; i++, expected++)
+			ordered &= batch[i] == (void *)expected;
+		if (n == 0)
+			sched_yield();
+	}
+	pthread_join(producer, NULL);
+
+	TEST_ASSERT_TRUE(ordered);
+	TEST_ASSERT_EQUAL(0, zk_spsc_queue_size(queue));
+
+	zk_free(&queue, NULL);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+
+	/*--------------- Test Constructor ---------------*/
+	RUN_TEST(test_zk_spsc_queue_new_when_arguments_are_invalid);
+	RUN_TEST(test_zk_spsc_queue_new_and_free);
+
+	/*--------------- Test Element access ---------------*/
+	RUN_TEST(test_zk_spsc_queue_front);
+
+	/*--------------- Test Modifiers ---------------*/
+	RUN_TEST(test_zk_spsc_queue_push_back_and_pop_front);
+	RUN_TEST(test_zk_spsc_queue_enqueue_and_dequeue_wrap_around);
+	RUN_TEST(test_zk_spsc_queue_batch);
+	RUN_TEST(test_zk_spsc_queue_free_applies_destructor);
+	RUN_TEST(test_zk_spsc_queue_concurrent_producer_and_consumer);
+
+	return UNITY_END();
+}
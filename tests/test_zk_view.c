@@ -0,0 +1,184 @@
+#include <stdlib.h>
+
+#include "unity.h"
+#include "zk/zklib.h"
+
+#define N_ELEMENTS 10
+
+void setUp(void)
+{
+	// set stuff up here
+}
+
+void tearDown(void)
+{
+	// clean stuff up here
+}
+
+static int data[N_ELEMENTS] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+static size_t predicate_calls;
+
+static bool is_even(const void *const value, void *user_data)
+{
+	ZK_UNUSED(user_data);
+	predicate_calls++;
+	return *(const int *)value % 2 == 0;
+}
+
+// maps an element of `data` to the element `user_data` positions further
+static void *shift(void *value, void *user_data)
+{
+	return (int *)value + *(int *)user_data;
+}
+
+static void collect(void *value, void *user_data)
+{
+	int **out = user_data;
+	**out = *(int *)value;
+	(*out)++;
+}
+
+/*--------------- Test Constructor ---------------*/
+void test_zk_view_of_empty_container(void)
+{
+	zk_slist *list = NULL;
+	zk_view view = zk_view_of(list);
+	void *value = NULL;
+
+	TEST_ASSERT_FALSE(zk_view_next(&view, &value));
+	TEST_ASSERT_EQUAL(0, zk_view_count(&view));
+}
+
+void test_zk_view_without_stages_yields_all_elements(void)
+{
+	zk_c_slist *list = NULL;
+	for (int i = 0; i < N_ELEMENTS; i++)
+		TEST_ASSERT_EQUAL(ZK_OK, zk_c_slist_push_back(&list, &data[i]));
+
+	zk_view view = zk_view_of(list);
+	void *value = NULL;
+	for (int i = 0; i < N_ELEMENTS; i++) {
+		TEST_ASSERT_TRUE(zk_view_next(&view, &value));
+		TEST_ASSERT_EQUAL_PTR(&data[i], value);
+	}
+	TEST_ASSERT_FALSE(zk_view_next(&view, &value));
+
+	zk_c_slist_free(&list, NULL);
+}
+
+/*--------------- Test Stages ---------------*/
+void test_zk_view_filter(void)
+{
+	zk_dlist *list = NULL;
+	for (int i = 0; i < N_ELEMENTS; i++)
+		TEST_ASSERT_EQUAL(ZK_OK, zk_dlist_push_back(&list, &data[i]));
+
+	zk_view view = zk_view_of(list);
+	TEST_ASSERT_EQUAL(5, zk_view_count(zk_view_filter(&view, is_even, NULL)));
+
+	zk_dlist_free(&list, NULL);
+}
+
+void test_zk_view_map(void)
+{
+	zk_c_dlist *list = NULL;
+	for (int i = 0; i < 5; i++)
+		TEST_ASSERT_EQUAL(ZK_OK, zk_c_dlist_push_back(&list, &data[i]));
+
+	int offset = 5;
+	int out[5];
+	int *cursor = out;
+	zk_view view = zk_view_of(list);
+	TEST_ASSERT_EQUAL(ZK_OK, zk_view_for_each(zk_view_map(&view, shift, &offset), collect, &cursor));
+
+	TEST_ASSERT_EQUAL_PTR(out + 5, cursor);
+	for (int i = 0; i < 5; i++)
+		TEST_ASSERT_EQUAL(i + 5, out[i]);
+	// the container is left untouched
+	TEST_ASSERT_EQUAL_PTR(&data[0], list->data);
+
+	zk_c_dlist_free(&list, NULL);
+}
+
+void test_zk_view_skip_and_take(void)
+{
+	zk_slist *list = NULL;
+	for (int i = 0; i < N_ELEMENTS; i++)
+		list = zk_slist_push_back(list, &data[i]);
+
+	int out[N_ELEMENTS];
+	int *cursor = out;
+	zk_view view = zk_view_of(list);
+	zk_view_take(zk_view_skip(&view, 2), 3);
+	TEST_ASSERT_EQUAL(ZK_OK, zk_view_for_each(&view, collect, &cursor));
+
+	TEST_ASSERT_EQUAL_PTR(out + 3, cursor);
+	TEST_ASSERT_EQUAL(2, out[0]);
+	TEST_ASSERT_EQUAL(3, out[1]);
+	TEST_ASSERT_EQUAL(4, out[2]);
+
+	view = zk_view_of(list);
+	TEST_ASSERT_EQUAL(0, zk_view_count(zk_view_take(&view, 0)));
+	view = zk_view_of(list);
+	TEST_ASSERT_EQUAL(0, zk_view_count(zk_view_skip(&view, N_ELEMENTS + 1)));
+
+	zk_slist_free(&list, NULL);
+}
+
+void test_zk_view_pipeline_is_fused_and_stops_early(void)
+{
+	zk_slist *list = NULL;
+	for (int i = 0; i < N_ELEMENTS; i++)
+		list = zk_slist_push_back(list, &data[i]);
+
+	int offset = 1;
+	int out[N_ELEMENTS];
+	int *cursor = out;
+	predicate_calls = 0;
+	zk_view view = zk_view_of(list);
+	zk_view_take(zk_view_map(zk_view_filter(&view, is_even, NULL), shift, &offset), 2);
+	TEST_ASSERT_EQUAL(ZK_OK, zk_view_for_each(&view, collect, &cursor));
+
+	TEST_ASSERT_EQUAL_PTR(out + 2, cursor);
+	TEST_ASSERT_EQUAL(1, out[0]);
+	TEST_ASSERT_EQUAL(3, out[1]);
+	// 0, 1 and 2 are enough to produce two even elements, the rest of the list is never visited
+	TEST_ASSERT_EQUAL(3, predicate_calls);
+
+	zk_slist_free(&list, NULL);
+}
+
+void test_zk_view_when_stages_are_invalid(void)
+{
+	zk_slist *list = NULL;
+	list = zk_slist_push_back(list, &data[0]);
+
+	zk_view view = zk_view_of(list);
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_view_for_each(zk_view_filter(&view, NULL, NULL), collect, NULL));
+
+	view = zk_view_of(list);
+	for (int i = 0; i <= ZK_VIEW_MAX_STAGES; i++)
+		zk_view_skip(&view, 0);
+	TEST_ASSERT_EQUAL(0, zk_view_count(&view));
+	TEST_ASSERT_NULL(zk_view_skip(NULL, 0));
+
+	zk_slist_free(&list, NULL);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+
+	/*--------------- Test Constructor ---------------*/
+	RUN_TEST(test_zk_view_of_empty_container);
+	RUN_TEST(test_zk_view_without_stages_yields_all_elements);
+
+	/*--------------- Test Stages ---------------*/
+	RUN_TEST(test_zk_view_filter);
+	RUN_TEST(test_zk_view_map);
+	RUN_TEST(test_zk_view_skip_and_take);
+	RUN_TEST(test_zk_view_pipeline_is_fused_and_stops_early);
+	RUN_TEST(test_zk_view_when_stages_are_invalid);
+
+	return UNITY_END();
+}
@@ -0,0 +1,220 @@
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "unity.h"
+#include "zk_ws_deque/zk_ws_deque.h"
+
+#define N_THIEVES 3
+#define N_ITEMS   20000
+
+void setUp(void)
+{
+	// set stuff up here
+}
+
+void tearDown(void)
+{
+	// clean stuff up here
+}
+
+static int *new_int(int const value)
+{
+	int *data = malloc(sizeof(int));
+	*data = value;
+	return data;
+}
+
+/*--------------- Test Constructor ---------------*/
+void test_zk_ws_deque_new_when_arguments_are_invalid(void)
+{
+	zk_ws_deque *deque = NULL;
+	void *data = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_ws_deque_new(NULL, 4));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_ws_deque_new(&deque, 0));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_ws_deque_new(&deque, SIZE_MAX));
+	TEST_ASSERT_NULL(deque);
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_ws_deque_push_bottom(NULL, &data));
+	TEST_ASSERT_FALSE(zk_ws_deque_pop_bottom(NULL, &data));
+	TEST_ASSERT_FALSE(zk_ws_deque_steal(NULL, &data));
+	TEST_ASSERT_EQUAL(0, zk_ws_deque_size(NULL));
+}
+
+void test_zk_ws_deque_new_and_free(void)
+{
+	zk_ws_deque *deque = NULL;
+	void *data = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_ws_deque_new(&deque, 3));
+	TEST_ASSERT_NOT_NULL(deque);
+	TEST_ASSERT_EQUAL(0, zk_ws_deque_size(deque));
+	TEST_ASSERT_FALSE(zk_ws_deque_pop_bottom(deque, &data));
+	TEST_ASSERT_FALSE(zk_ws_deque_steal(deque, &data));
+	TEST_ASSERT_FALSE(zk_ws_deque_pop_bottom(deque, NULL));
+
+	zk_ws_deque_free(&deque, NULL);
+	TEST_ASSERT_NULL(deque);
+	zk_ws_deque_free(&deque, NULL);
+	zk_ws_deque_free(NULL, NULL);
+}
+
+/*--------------- Test Modifiers ---------------*/
+void test_zk_ws_deque_pop_bottom_is_lifo_and_steal_is_fifo(void)
+{
+	zk_ws_deque *deque = NULL;
+	int values[] = { 0, 1, 2, 3, 4 };
+	void *data = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_ws_deque_new(&deque, 8));
+	for (size_t i = 0; i < 5; i++)
+		TEST_ASSERT_EQUAL(ZK_OK, zk_ws_deque_push_bottom(deque, &values[i]));
+	TEST_ASSERT_EQUAL(5, zk_ws_deque_size(deque));
+
+	TEST_ASSERT_TRUE(zk_ws_deque_pop_bottom(deque, &data));
+	TEST_ASSERT_EQUAL_PTR(&values[4], data);
+	TEST_ASSERT_TRUE(zk_ws_deque_steal(deque, &data));
+	TEST_ASSERT_EQUAL_PTR(&values[0], data);
+	TEST_ASSERT_TRUE(zk_ws_deque_steal(deque, &data));
+	TEST_ASSERT_EQUAL_PTR(&values[1], data);
+	TEST_ASSERT_TRUE(zk_ws_deque_pop_bottom(deque, &data));
+	TEST_ASSERT_EQUAL_PTR(&values[3], data);
+	TEST_ASSERT_EQUAL(1, zk_ws_deque_size(deque));
+
+	// the last element goes to whoever asks first
+	TEST_ASSERT_TRUE(zk_ws_deque_pop_bottom(deque, &data));
+	TEST_ASSERT_EQUAL_PTR(&values[2], data);
+	TEST_ASSERT_FALSE(zk_ws_deque_pop_bottom(deque, &data));
+	TEST_ASSERT_FALSE(zk_ws_deque_steal(deque, &data));
+	TEST_ASSERT_EQUAL(0, zk_ws_deque_size(deque));
+
+	zk_ws_deque_free(&deque, NULL);
+}
+
+void test_zk_ws_deque_push_bottom_grows(void)
+{
+	zk_ws_deque *deque = NULL;
+	void *data = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_ws_deque_new(&deque, 1));
+	// steals move `top` so the live elements wrap around the buffer before each growth
+	for (uintptr_t i = 0; i < 1000; i++) {
+		TEST_ASSERT_EQUAL(ZK_OK, zk_ws_deque_push_bottom(deque, (void *)(i + 1)));
+		if (i % 3 == 0) {
+			TEST_ASSERT_TRUE(zk_ws_deque_steal(deque, &data));
+			TEST_ASSERT_EQUAL(i / 3 + 1, (uintptr_t)data);
+		}
+	}
+	TEST_ASSERT_EQUAL(666, zk_ws_deque_size(deque));
+
+	for (uintptr_t i = 1000; i > 667; i--) {
+		TEST_ASSERT_TRUE(zk_ws_deque_pop_bottom(deque, &data));
+		TEST_ASSERT_EQUAL(i, (uintptr_t)data);
+	}
+	TEST_ASSERT_EQUAL(333, zk_ws_deque_size(deque));
+
+	zk_ws_deque_free(&deque, NULL);
+}
+
+void test_zk_ws_deque_free_applies_destructor(void)
+{
+	zk_ws_deque *deque = NULL;
+	void *data = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_ws_deque_new(&deque, 2));
+	for (int i = 0; i < 10; i++)
+		zk_ws_deque_push_bottom(deque, new_int(i));
+	TEST_ASSERT_TRUE(zk_ws_deque_steal(deque, &data));
+	free(data);
+	TEST_ASSERT_TRUE(zk_ws_deque_pop_bottom(deque, &data));
+	free(data);
+
+	// leak checkers report the values left in the deque if the destructor is not applied
+	zk_ws_deque_free(&deque, free);
+}
+
+/*
+ * The owner pushes every item once, popping some back as it goes, while thieves steal until all items are taken. Each
+ * item must be taken exactly once, whether by the owner or by a thief.
+ */
+struct stress_context {
+	zk_ws_deque *deque;
+	unsigned char *taken;
+	size_t *remaining;
+	bool valid;
+};
+
+static void stress_take(struct stress_context *ctx, void *const data)
+{
+	uintptr_t const i = (uintptr_t)data - 1;
+	if (i >= N_ITEMS || __atomic_fetch_add(&ctx->taken[i], 1, __ATOMIC_RELAXED) != 0)
+		ctx->valid = false;
+	__atomic_fetch_sub(ctx->remaining, 1, __ATOMIC_RELEASE);
+}
+
+static void *stress_thief(void *arg)
+{
+	struct stress_context *ctx = arg;
+	void *data = NULL;
+
+	while (__atomic_load_n(ctx->remaining, __ATOMIC_ACQUIRE) > 0) {
+		if (zk_ws_deque_steal(ctx->deque, &data))
+			stress_take(ctx, data);
+	}
+	return NULL;
+}
+
+void test_zk_ws_deque_concurrent_owner_and_thieves(void)
+{
+	zk_ws_deque *deque = NULL;
+	pthread_t threads[N_THIEVES];
+	struct stress_context thieves[N_THIEVES];
+	unsigned char *taken = calloc(N_ITEMS, 1);
+	size_t remaining = N_ITEMS;
+	void *data = NULL;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_ws_deque_new(&deque, 2));
+	struct stress_context owner = { deque, taken, &remaining, true };
+	for (size_t t = 0; t < N_THIEVES; t++) {
+		thieves[t] = owner;
+		pthread_create(&threads[t], NULL, stress_thief, &thieves[t]);
+	}
+
+	for (uintptr_t i = 0; i < N_ITEMS; i++) {
+		TEST_ASSERT_EQUAL(ZK_OK, zk_ws_deque_push_bottom(deque, (void *)(i + 1)));
+		if (i % 4 == 0 && zk_ws_deque_pop_bottom(deque, &data))
+			stress_take(&owner, data);
+	}
+	while (zk_ws_deque_pop_bottom(deque, &data))
+		stress_take(&owner, data);
+	for (size_t t = 0; t < N_THIEVES; t++)
+		pthread_join(threads[t], NULL);
+
+	TEST_ASSERT_TRUE(owner.valid);
+	for (size_t t = 0; t < N_THIEVES; t++)
+		TEST_ASSERT_TRUE(thieves[t].valid);
+	TEST_ASSERT_EQUAL(0, remaining);
+	for (size_t i = 0; i < N_ITEMS; i++)
+		TEST_ASSERT_EQUAL(1, taken[i]);
+	TEST_ASSERT_EQUAL(0, zk_ws_deque_size(deque));
+
+	zk_ws_deque_free(&deque, NULL);
+	free(taken);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+
+	/*--------------- Test Constructor ---------------*/
+	RUN_TEST(test_zk_ws_deque_new_when_arguments_are_invalid);
+	RUN_TEST(test_zk_ws_deque_new_and_free);
+
+	/*--------------- Test Modifiers ---------------*/
+	RUN_TEST(test_zk_ws_deque_pop_bottom_is_lifo_and_steal_is_fifo);
+	RUN_TEST(test_zk_ws_deque_push_bottom_grows);
+	RUN_TEST(test_zk_ws_deque_free_applies_destructor);
+	RUN_TEST(test_zk_ws_deque_concurrent_owner_and_thieves);
+
+	return UNITY_END();
+}
@@ -0,0 +1,50 @@
+#include "unity.h"
+#include "zk/zklib.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+static bool is_even(const void *const data, void *user_data)
+{
+	ZK_UNUSED(user_data);
+	return *(const int *)data % 2 == 0;
+}
+
+void test_zk_slist_count_if_when_list_is_null(void)
+{
+	TEST_ASSERT_EQUAL(0, zk_slist_count_if(NULL, is_even, NULL));
+}
+
+void test_zk_slist_count_if_when_function_pointer_is_null(void)
+{
+	zk_slist *list = NULL;
+	int data = 2;
+
+	list = zk_slist_push_back(list, &data);
+	TEST_ASSERT_EQUAL(0, zk_slist_count_if(list, NULL, NULL));
+
+	zk_slist_free(&list, NULL);
+}
+
+void test_zk_slist_count_if_when_list_has_n_elements(void)
+{
+	zk_slist *list = NULL;
+	int data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+
+	for (int i = 0; i < 11; i++)
+		list = zk_slist_push_front(list, &data[i]);
+
+	TEST_ASSERT_EQUAL(6, zk_count_if(list, is_even, NULL));
+
+	zk_slist_free(&list, NULL);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_zk_slist_count_if_when_list_is_null);
+	RUN_TEST(test_zk_slist_count_if_when_function_pointer_is_null);
+	RUN_TEST(test_zk_slist_count_if_when_list_has_n_elements);
+	return UNITY_END();
+}
@@ -0,0 +1,92 @@
+#include <stdlib.h>
+
+#include "unity.h"
+#include "zk/zklib.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+static bool is_multiple_of(const void *const data, void *user_data)
+{
+	return *(const int *)data % *(int *)user_data == 0;
+}
+
+void test_zk_slist_find_all_when_arguments_are_invalid(void)
+{
+	zk_slist **nodes = NULL;
+	size_t capacity = 0, count = 0;
+	int divisor = 2;
+
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_slist_find_all(NULL, NULL, &divisor, &nodes, &capacity, &count));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_slist_find_all(NULL, is_multiple_of, &divisor, NULL, &capacity, &count));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_slist_find_all(NULL, is_multiple_of, &divisor, &nodes, NULL, &count));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_slist_find_all(NULL, is_multiple_of, &divisor, &nodes, &capacity, NULL));
+}
+
+void test_zk_slist_find_all_when_list_is_null(void)
+{
+	zk_slist **nodes = NULL;
+	size_t capacity = 0, count = 1;
+	int divisor = 2;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_slist_find_all(NULL, is_multiple_of, &divisor, &nodes, &capacity, &count));
+	TEST_ASSERT_EQUAL(0, count);
+	TEST_ASSERT_NULL(nodes);
+}
+
+void test_zk_slist_find_all_grows_array(void)
+{
+	zk_slist *list = NULL;
+	zk_slist **nodes = NULL;
+	size_t capacity = 0, count = 0;
+	int data[100];
+
+	for (int i = 0; i < 100; i++) {
+		data[i] = i;
+		list = zk_slist_push_back(list, &data[i]);
+	}
+
+	int divisor = 3;
+	TEST_ASSERT_EQUAL(ZK_OK, zk_find_all(list, is_multiple_of, &divisor, &nodes, &capacity, &count));
+	TEST_ASSERT_EQUAL(34, count);
+	TEST_ASSERT(capacity >= count);
+	for (size_t i = 0; i < count; i++)
+		TEST_ASSERT_EQUAL_PTR(&data[i * 3], nodes[i]->data);
+
+	free(nodes);
+	zk_slist_free(&list, NULL);
+}
+
+void test_zk_slist_find_all_reuses_caller_array(void)
+{
+	zk_slist *list = NULL;
+	size_t capacity = 16, count = 0;
+	zk_slist **nodes = malloc(capacity * sizeof(zk_slist *));
+	zk_slist **original = nodes;
+	int data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+	for (int i = 0; i < 10; i++)
+		list = zk_slist_push_back(list, &data[i]);
+
+	int divisor = 2;
+	TEST_ASSERT_EQUAL(ZK_OK, zk_slist_find_all(list, is_multiple_of, &divisor, &nodes, &capacity, &count));
+	TEST_ASSERT_EQUAL(5, count);
+	TEST_ASSERT_EQUAL(16, capacity);
+	TEST_ASSERT_EQUAL_PTR(original, nodes);
+	for (size_t i = 0; i < count; i++)
+		TEST_ASSERT_EQUAL_PTR(&data[i * 2], nodes[i]->data);
+
+	free(nodes);
+	zk_slist_free(&list, NULL);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_zk_slist_find_all_when_arguments_are_invalid);
+	RUN_TEST(test_zk_slist_find_all_when_list_is_null);
+	RUN_TEST(test_zk_slist_find_all_grows_array);
+	RUN_TEST(test_zk_slist_find_all_reuses_caller_array);
+	return UNITY_END();
+}
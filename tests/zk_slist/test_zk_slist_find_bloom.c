@@ -0,0 +1,129 @@
+#include <stdlib.h>
+
+#include "unity.h"
+#include "zk/zklib.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+static int compare_int(const void *a, const void *b)
+{
+	return *(int *)a - *(int *)b;
+}
+
+static size_t hash_int(const void *const data)
+{
+	return (size_t)*(const int *)data * 2654435761u;
+}
+
+static int compare_calls = 0;
+
+static int counting_compare_int(const void *a, const void *b)
+{
+	compare_calls++;
+	return compare_int(a, b);
+}
+
+void test_zk_slist_find_bloom_when_bloom_is_null(void)
+{
+	zk_slist *list = NULL;
+	int data[] = { 0, 1, 2, 3, 4 };
+
+	for (int i = 0; i < 5; i++)
+		list = zk_slist_push_back_bloom(list, &data[i], NULL);
+
+	for (int i = 0; i < 5; i++) {
+		zk_slist *found = zk_slist_find_bloom(list, &i, compare_int, NULL);
+		TEST_ASSERT_NOT_NULL(found);
+		TEST_ASSERT_EQUAL_PTR(&data[i], found->data);
+	}
+
+	int not_found = 5;
+	TEST_ASSERT_NULL(zk_slist_find_bloom(list, &not_found, compare_int, NULL));
+
+	zk_slist_free(&list, NULL);
+}
+
+void test_zk_slist_find_bloom_when_list_has_n_elements(void)
+{
+	zk_slist *list = NULL;
+	zk_bloom *bloom = NULL;
+	int data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_bloom_new(&bloom, 10, 0.001, hash_int));
+	for (int i = 0; i < 5; i++)
+		list = zk_slist_push_back_bloom(list, &data[i], bloom);
+	for (int i = 5; i < 10; i++)
+		list = zk_slist_push_front_bloom(list, &data[i], bloom);
+
+	for (int i = 0; i < 10; i++) {
+		zk_slist *found = zk_slist_find_bloom(list, &i, compare_int, bloom);
+		TEST_ASSERT_NOT_NULL(found);
+		TEST_ASSERT_EQUAL_PTR(&data[i], found->data);
+	}
+
+	zk_slist_free(&list, NULL);
+	zk_bloom_free(&bloom);
+}
+
+void test_zk_slist_find_bloom_misses_skip_the_list(void)
+{
+	zk_slist *list = NULL;
+	zk_bloom *bloom = NULL;
+	int data[100];
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_bloom_new(&bloom, 100, 0.001, hash_int));
+	for (int i = 0; i < 100; i++) {
+		data[i] = i;
+		list = zk_slist_push_front_bloom(list, &data[i], bloom);
+	}
+
+	compare_calls = 0;
+	int misses = 0;
+	for (int i = 100; i < 1100; i++)
+		misses += zk_slist_find_bloom(list, &i, counting_compare_int, bloom) == NULL;
+
+	TEST_ASSERT_EQUAL(1000, misses);
+	// without the filter every miss would compare against all 100 elements
+	TEST_ASSERT(compare_calls < 100 * 100);
+
+	zk_slist_free(&list, NULL);
+	zk_bloom_free(&bloom);
+}
+
+void test_zk_slist_rebuild_bloom_after_removal(void)
+{
+	zk_slist *list = NULL;
+	zk_bloom *bloom = NULL;
+	zk_bloom_stats stats;
+	int data[] = { 0, 1, 2, 3, 4 };
+
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_slist_rebuild_bloom(list, NULL));
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_bloom_new(&bloom, 5, 0.001, hash_int));
+	for (int i = 0; i < 5; i++)
+		list = zk_slist_push_front_bloom(list, &data[i], bloom);
+
+	list = zk_slist_pop_front(list, NULL);
+	TEST_ASSERT_EQUAL(ZK_OK, zk_slist_rebuild_bloom(list, bloom));
+	TEST_ASSERT_EQUAL(ZK_OK, zk_bloom_get_stats(bloom, &stats));
+	TEST_ASSERT_EQUAL(4, stats.count);
+
+	TEST_ASSERT_NULL(zk_slist_find_bloom(list, &data[4], compare_int, bloom));
+	for (int i = 0; i < 4; i++)
+		TEST_ASSERT_NOT_NULL(zk_slist_find_bloom(list, &data[i], compare_int, bloom));
+
+	zk_slist_free(&list, NULL);
+	zk_bloom_free(&bloom);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_zk_slist_find_bloom_when_bloom_is_null);
+	RUN_TEST(test_zk_slist_find_bloom_when_list_has_n_elements);
+	RUN_TEST(test_zk_slist_find_bloom_misses_skip_the_list);
+	RUN_TEST(test_zk_slist_rebuild_bloom_after_removal);
+	return UNITY_END();
+}
@@ -0,0 +1,77 @@
+#include <stdlib.h>
+
+#include "unity.h"
+#include "zk/zklib.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+static int predicate_calls = 0;
+
+static bool is_greater_than(const void *const data, void *user_data)
+{
+	predicate_calls++;
+	return *(const int *)data > *(int *)user_data;
+}
+
+void test_zk_slist_find_if_when_list_is_null(void)
+{
+	int threshold = 0;
+	TEST_ASSERT_NULL(zk_slist_find_if(NULL, is_greater_than, &threshold));
+}
+
+void test_zk_slist_find_if_when_function_pointer_is_null(void)
+{
+	zk_slist *list = NULL;
+	int data = 1;
+
+	list = zk_slist_push_back(list, &data);
+	TEST_ASSERT_NULL(zk_slist_find_if(list, NULL, NULL));
+
+	zk_slist_free(&list, NULL);
+}
+
+void test_zk_slist_find_if_stops_at_first_match(void)
+{
+	zk_slist *list = NULL;
+	int data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+	for (int i = 0; i < 10; i++)
+		list = zk_slist_push_back(list, &data[i]);
+
+	int threshold = 2;
+	predicate_calls = 0;
+	zk_slist *found = zk_find_if(list, is_greater_than, &threshold);
+	TEST_ASSERT_NOT_NULL(found);
+	TEST_ASSERT_EQUAL_PTR(&data[3], found->data);
+	TEST_ASSERT_EQUAL(4, predicate_calls);
+
+	zk_slist_free(&list, NULL);
+}
+
+void test_zk_slist_find_if_when_no_element_matches(void)
+{
+	zk_slist *list = NULL;
+	int data[] = { 0, 1, 2, 3, 4 };
+
+	for (int i = 0; i < 5; i++)
+		list = zk_slist_push_back(list, &data[i]);
+
+	int threshold = 4;
+	predicate_calls = 0;
+	TEST_ASSERT_NULL(zk_slist_find_if(list, is_greater_than, &threshold));
+	TEST_ASSERT_EQUAL(5, predicate_calls);
+
+	zk_slist_free(&list, NULL);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_zk_slist_find_if_when_list_is_null);
+	RUN_TEST(test_zk_slist_find_if_when_function_pointer_is_null);
+	RUN_TEST(test_zk_slist_find_if_stops_at_first_match);
+	RUN_TEST(test_zk_slist_find_if_when_no_element_matches);
+	return UNITY_END();
+}
@@ -79,11 +79,83 @@ void test_zk_slist_for_each_when_func_is_not_null(void)
 	zk_slist_free(&list, NULL);
 }
 
+// test ZK_SLIST_FOREACH and ZK_FOREACH
+void test_zk_slist_foreach_macro_when_list_is_null(void)
+{
+	zk_slist *list = NULL;
+	zk_slist *node = NULL;
+	int visited = 0;
+
+	ZK_SLIST_FOREACH(node, list)
+	{
+		visited++;
+	}
+	ZK_FOREACH(node, list)
+	{
+		visited++;
+	}
+
+	TEST_ASSERT_EQUAL(0, visited);
+}
+
+void test_zk_slist_foreach_macro_visits_elements_in_order(void)
+{
+	zk_slist *list = NULL;
+	zk_slist *node = NULL;
+	int data[] = { 1, 2, 3, 4, 5 };
+
+	for (int i = 0; i < 5; i++)
+		list = zk_slist_push_back(list, &data[i]);
+
+	int i = 0;
+	ZK_SLIST_FOREACH(node, list)
+	{
+		TEST_ASSERT_EQUAL_PTR(&data[i], node->data);
+		i++;
+	}
+	TEST_ASSERT_EQUAL(5, i);
+
+	int sum = 0;
+	ZK_FOREACH(node, list)
+	{
+		sum += *(int *)node->data;
+	}
+	TEST_ASSERT_EQUAL(15, sum);
+
+	zk_slist_free(&list, NULL);
+}
+
+void test_zk_slist_foreach_safe_macro_frees_nodes(void)
+{
+	zk_slist *list = NULL;
+	zk_slist *node = NULL;
+	zk_slist *tmp = NULL;
+
+	for (int i = 0; i < 5; i++) {
+		struct dummy_node_data *node_data = malloc(sizeof(struct dummy_node_data));
+		node_data->value = i;
+		node_data->string = strdup("node");
+		list = zk_slist_push_back(list, node_data);
+	}
+
+	int freed = 0;
+	ZK_FOREACH_SAFE(node, tmp, list)
+	{
+		dummy_node_data_free(node->data);
+		free(node);
+		freed++;
+	}
+	TEST_ASSERT_EQUAL(5, freed);
+}
+
 int main(void)
 {
 	UNITY_BEGIN();
 	RUN_TEST(test_zk_slist_for_each_when_func_is_null);
 	RUN_TEST(test_zk_slist_for_each_when_list_is_null);
 	RUN_TEST(test_zk_slist_for_each_when_func_is_not_null);
+	RUN_TEST(test_zk_slist_foreach_macro_when_list_is_null);
+	RUN_TEST(test_zk_slist_foreach_macro_visits_elements_in_order);
+	RUN_TEST(test_zk_slist_foreach_safe_macro_frees_nodes);
 	return UNITY_END();
 }
@@ -0,0 +1,121 @@
+#include "unity.h"
+#include "zk/zklib.h"
+
+#define N_ELEMENTS (2 * ZK_BATCH_SIZE + 3)
+
+struct batch_stats {
+	size_t calls;
+	size_t elements;
+	size_t largest;
+	long sum;
+	int next;
+	bool in_order;
+};
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+static void sum_batch(void **data, size_t const count, void *user_data)
+{
+	struct batch_stats *stats = user_data;
+	stats->calls++;
+	stats->elements += count;
+	if (count > stats->largest)
+		stats->largest = count;
+	for (size_t i = 0; i < count; i++) {
+		int const value = *(int *)data[i];
+		stats->in_order = stats->in_order && value == stats->next;
+		stats->next++;
+		stats->sum += value;
+	}
+}
+
+void test_zk_slist_for_each_batch_when_list_is_null(void)
+{
+	struct batch_stats stats = { .in_order = true };
+
+	zk_slist_for_each_batch(NULL, NULL, sum_batch, &stats);
+
+	TEST_ASSERT_EQUAL(0, stats.calls);
+}
+
+void test_zk_slist_for_each_batch_when_func_is_null(void)
+{
+	zk_slist *list = NULL;
+	int data = 1;
+
+	list = zk_slist_push_back(list, &data);
+	zk_slist_for_each_batch(list, NULL, NULL, NULL);
+
+	zk_slist_free(&list, NULL);
+}
+
+void test_zk_slist_for_each_batch_when_list_has_one_element(void)
+{
+	zk_slist *list = NULL;
+	struct batch_stats stats = { .in_order = true };
+	int data = 0;
+
+	list = zk_slist_push_back(list, &data);
+	zk_for_each_batch(list, sum_batch, &stats);
+
+	TEST_ASSERT_EQUAL(1, stats.calls);
+	TEST_ASSERT_EQUAL(1, stats.elements);
+	TEST_ASSERT_TRUE(stats.in_order);
+
+	zk_slist_free(&list, NULL);
+}
+
+void test_zk_slist_for_each_batch_when_list_has_n_elements(void)
+{
+	zk_slist *list = NULL;
+	struct batch_stats stats = { .in_order = true };
+	int data[N_ELEMENTS];
+	long expected = 0;
+
+	for (int i = 0; i < N_ELEMENTS; i++) {
+		data[i] = i;
+		expected += i;
+		list = zk_slist_push_back(list, &data[i]);
+	}
+
+	zk_for_each_batch(list, sum_batch, &stats);
+
+	TEST_ASSERT_EQUAL(3, stats.calls);
+	TEST_ASSERT_EQUAL(N_ELEMENTS, stats.elements);
+	TEST_ASSERT_EQUAL(ZK_BATCH_SIZE, stats.largest);
+	TEST_ASSERT_EQUAL(expected, stats.sum);
+	TEST_ASSERT_TRUE(stats.in_order);
+
+	zk_slist_free(&list, NULL);
+}
+
+void test_zk_slist_for_each_batch_when_range_is_partial(void)
+{
+	zk_slist *list = NULL;
+	struct batch_stats stats = { .in_order = true };
+	int data[] = { 0, 1, 2, 3, 4 };
+
+	for (int i = 0; i < 5; i++)
+		list = zk_slist_push_back(list, &data[i]);
+
+	zk_slist_for_each_batch(list, list->next->next->next, sum_batch, &stats);
+
+	TEST_ASSERT_EQUAL(1, stats.calls);
+	TEST_ASSERT_EQUAL(3, stats.elements);
+	TEST_ASSERT_EQUAL(3, stats.sum);
+
+	zk_slist_free(&list, NULL);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_zk_slist_for_each_batch_when_list_is_null);
+	RUN_TEST(test_zk_slist_for_each_batch_when_func_is_null);
+	RUN_TEST(test_zk_slist_for_each_batch_when_list_has_one_element);
+	RUN_TEST(test_zk_slist_for_each_batch_when_list_has_n_elements);
+	RUN_TEST(test_zk_slist_for_each_batch_when_range_is_partial);
+	return UNITY_END();
+}
@@ -0,0 +1,130 @@
+#include "unity.h"
+#include "zk/zklib.h"
+#include "zk_parallel/zk_parallel.h"
+
+#define N_ELEMENTS 1000
+#define N_THREADS  4
+
+struct slot {
+	long sum;
+	size_t count;
+};
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+static void sum_values(void *data, void *user_data)
+{
+	struct slot *slot = user_data;
+	slot->sum += *(int *)data;
+	slot->count++;
+}
+
+static void increment(void *data, void *user_data)
+{
+	ZK_UNUSED(user_data);
+	(*(int *)data)++;
+}
+
+void test_zk_slist_for_each_parallel_when_arguments_are_invalid(void)
+{
+	zk_slist *list = NULL;
+	int data = 0;
+
+	list = zk_slist_push_back(list, &data);
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_slist_for_each_parallel(list, NULL, NULL, NULL, N_THREADS));
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_slist_for_each_parallel(list, NULL, increment, NULL, 0));
+	TEST_ASSERT_EQUAL(0, data);
+
+	zk_slist_free(&list, NULL);
+}
+
+void test_zk_slist_for_each_parallel_when_list_is_null(void)
+{
+	struct slot slots[N_THREADS] = { 0 };
+	void *user_data[N_THREADS] = { &slots[0], &slots[1], &slots[2], &slots[3] };
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_slist_for_each_parallel(NULL, NULL, sum_values, user_data, N_THREADS));
+
+	for (size_t i = 0; i < N_THREADS; i++)
+		TEST_ASSERT_EQUAL(0, slots[i].count);
+}
+
+void test_zk_slist_for_each_parallel_when_list_is_shorter_than_threads(void)
+{
+	zk_slist *list = NULL;
+	int data[] = { 1, 2 };
+	struct slot slots[N_THREADS] = { 0 };
+	void *user_data[N_THREADS] = { &slots[0], &slots[1], &slots[2], &slots[3] };
+
+	list = zk_slist_push_back(list, &data[0]);
+	list = zk_slist_push_back(list, &data[1]);
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_for_each_parallel(list, sum_values, user_data, N_THREADS));
+
+	TEST_ASSERT_EQUAL(1, slots[0].count);
+	TEST_ASSERT_EQUAL(1, slots[0].sum);
+	TEST_ASSERT_EQUAL(1, slots[1].count);
+	TEST_ASSERT_EQUAL(2, slots[1].sum);
+	TEST_ASSERT_EQUAL(0, slots[2].count);
+	TEST_ASSERT_EQUAL(0, slots[3].count);
+
+	zk_slist_free(&list, NULL);
+}
+
+void test_zk_slist_for_each_parallel_when_list_has_n_elements(void)
+{
+	zk_slist *list = NULL;
+	int data[N_ELEMENTS];
+	struct slot slots[N_THREADS] = { 0 };
+	void *user_data[N_THREADS] = { &slots[0], &slots[1], &slots[2], &slots[3] };
+	long expected = 0;
+
+	for (int i = 0; i < N_ELEMENTS; i++) {
+		data[i] = i;
+		expected += i;
+		list = zk_slist_push_front(list, &data[i]);
+	}
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_for_each_parallel(list, sum_values, user_data, N_THREADS));
+
+	// chunks are cut in a single walk, each is within one stride of the average length
+	size_t const tolerance = N_ELEMENTS / (ZK_PARALLEL_SPLIT_MARKS / 2 * N_THREADS - 1);
+	long sum = 0;
+	for (size_t i = 0; i < N_THREADS; i++) {
+		TEST_ASSERT(slots[i].count + tolerance >= N_ELEMENTS / N_THREADS);
+		TEST_ASSERT(slots[i].count <= N_ELEMENTS / N_THREADS + tolerance);
+		sum += slots[i].sum;
+	}
+	TEST_ASSERT_EQUAL(expected, sum);
+
+	zk_slist_free(&list, NULL);
+}
+
+void test_zk_slist_for_each_parallel_visits_each_element_once(void)
+{
+	zk_slist *list = NULL;
+	int data[N_ELEMENTS + 3] = { 0 };
+
+	for (int i = 0; i < N_ELEMENTS + 3; i++)
+		list = zk_slist_push_front(list, &data[i]);
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_for_each_parallel(list, increment, NULL, N_THREADS));
+
+	for (int i = 0; i < N_ELEMENTS + 3; i++)
+		TEST_ASSERT_EQUAL(1, data[i]);
+
+	zk_slist_free(&list, NULL);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_zk_slist_for_each_parallel_when_arguments_are_invalid);
+	RUN_TEST(test_zk_slist_for_each_parallel_when_list_is_null);
+	RUN_TEST(test_zk_slist_for_each_parallel_when_list_is_shorter_than_threads);
+	RUN_TEST(test_zk_slist_for_each_parallel_when_list_has_n_elements);
+	RUN_TEST(test_zk_slist_for_each_parallel_visits_each_element_once);
+	return UNITY_END();
+}
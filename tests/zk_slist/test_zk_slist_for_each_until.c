@@ -0,0 +1,97 @@
+#include "unity.h"
+#include "zk/zklib.h"
+
+struct search {
+	int target;
+	size_t visited;
+};
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+static zk_iteration stop_at_target(void *data, void *user_data)
+{
+	struct search *search = user_data;
+	search->visited++;
+	return *(int *)data == search->target ? ZK_STOP : ZK_CONTINUE;
+}
+
+void test_zk_slist_for_each_until_when_list_is_null(void)
+{
+	struct search search = { .target = 0 };
+
+	TEST_ASSERT_NULL(zk_slist_for_each_until(NULL, NULL, stop_at_target, &search));
+	TEST_ASSERT_EQUAL(0, search.visited);
+}
+
+void test_zk_slist_for_each_until_when_func_is_null(void)
+{
+	zk_slist *list = NULL;
+	int data = 0;
+
+	list = zk_slist_push_back(list, &data);
+	TEST_ASSERT_NULL(zk_slist_for_each_until(list, NULL, NULL, NULL));
+
+	zk_slist_free(&list, NULL);
+}
+
+void test_zk_slist_for_each_until_stops_early(void)
+{
+	zk_slist *list = NULL;
+	int data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	struct search search = { .target = 3 };
+
+	for (int i = 0; i < 10; i++)
+		list = zk_slist_push_back(list, &data[i]);
+
+	zk_slist *node = zk_for_each_until(list, stop_at_target, &search);
+
+	TEST_ASSERT_NOT_NULL(node);
+	TEST_ASSERT_EQUAL_PTR(&data[3], node->data);
+	TEST_ASSERT_EQUAL(4, search.visited);
+
+	zk_slist_free(&list, NULL);
+}
+
+void test_zk_slist_for_each_until_visits_all_when_never_stopped(void)
+{
+	zk_slist *list = NULL;
+	int data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	struct search search = { .target = -1 };
+
+	for (int i = 0; i < 10; i++)
+		list = zk_slist_push_back(list, &data[i]);
+
+	TEST_ASSERT_NULL(zk_for_each_until(list, stop_at_target, &search));
+	TEST_ASSERT_EQUAL(10, search.visited);
+
+	zk_slist_free(&list, NULL);
+}
+
+void test_zk_slist_for_each_until_respects_end(void)
+{
+	zk_slist *list = NULL;
+	int data[] = { 0, 1, 2, 3, 4 };
+	struct search search = { .target = 3 };
+
+	for (int i = 0; i < 5; i++)
+		list = zk_slist_push_back(list, &data[i]);
+
+	// the target lies at end, which is not part of the range
+	TEST_ASSERT_NULL(zk_slist_for_each_until(list, list->next->next->next, stop_at_target, &search));
+	TEST_ASSERT_EQUAL(3, search.visited);
+
+	zk_slist_free(&list, NULL);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_zk_slist_for_each_until_when_list_is_null);
+	RUN_TEST(test_zk_slist_for_each_until_when_func_is_null);
+	RUN_TEST(test_zk_slist_for_each_until_stops_early);
+	RUN_TEST(test_zk_slist_for_each_until_visits_all_when_never_stopped);
+	RUN_TEST(test_zk_slist_for_each_until_respects_end);
+	return UNITY_END();
+}
@@ -0,0 +1,104 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "unity.h"
+#include "zk/zklib.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_zk_slist_free_arena_when_reference_is_null(void)
+{
+	zk_arena *arena = NULL;
+	TEST_ASSERT_EQUAL(ZK_OK, zk_arena_new(&arena, 1024));
+
+	zk_slist_free_arena(NULL, NULL, NULL);
+	zk_slist_free_arena(NULL, free, &arena);
+	TEST_ASSERT_NULL(arena);
+}
+
+void test_zk_slist_free_arena_without_arena_behaves_as_free(void)
+{
+	zk_slist *list = NULL;
+	zk_arena *arena = NULL;
+
+	for (int i = 0; i < 10; i++)
+		list = zk_slist_push_front(list, malloc(sizeof(int)));
+
+	zk_slist_free_arena(&list, free, &arena);
+	TEST_ASSERT_NULL(list);
+}
+
+void test_zk_slist_arena_nodes_are_adjacent(void)
+{
+	int nodes_data[10];
+	zk_slist *list = NULL;
+	zk_arena *arena = NULL;
+	TEST_ASSERT_EQUAL(ZK_OK, zk_arena_new(&arena, 10 * sizeof(zk_slist)));
+
+	for (int i = 0; i < 10; i++) {
+		nodes_data[i] = i;
+		list = zk_slist_push_back_arena(list, &nodes_data[i], arena);
+		TEST_ASSERT_NOT_NULL(list);
+	}
+
+	TEST_ASSERT_EQUAL(10, zk_slist_size(list));
+	int i = 0;
+	for (zk_slist *node = list; node; node = node->next, i++) {
+		TEST_ASSERT_EQUAL_PTR(&nodes_data[i], node->data);
+		TEST_ASSERT_TRUE(zk_arena_contains(arena, node));
+		if (node->next)
+			TEST_ASSERT_EQUAL_PTR(node + 1, node->next);
+	}
+
+	zk_slist_free_arena(&list, NULL, &arena);
+	TEST_ASSERT_NULL(list);
+	TEST_ASSERT_NULL(arena);
+}
+
+void test_zk_slist_arena_push_fails_when_arena_is_null(void)
+{
+	int data = 0;
+
+	TEST_ASSERT_NULL(zk_slist_new_node_arena(&data, NULL));
+	TEST_ASSERT_NULL(zk_slist_push_front_arena(NULL, &data, NULL));
+	TEST_ASSERT_NULL(zk_slist_push_back_arena(NULL, &data, NULL));
+}
+
+void test_zk_slist_free_arena_for_list_of_strings(void)
+{
+	int number_of_nodes = 1000;
+	zk_slist *list = NULL;
+	zk_arena *arena = NULL;
+	TEST_ASSERT_EQUAL(ZK_OK, zk_arena_new(&arena, (size_t)number_of_nodes * sizeof(zk_slist)));
+
+	for (int i = 0; i < number_of_nodes; i++) {
+		char *data = malloc(16);
+		strcpy(data, "test");
+		zk_slist *head = zk_slist_push_front_arena(list, data, arena);
+		TEST_ASSERT_NOT_NULL(head);
+		list = head;
+	}
+
+	// the list can still be reordered in place
+	list = zk_slist_reverse(list);
+	TEST_ASSERT_EQUAL(number_of_nodes, zk_slist_size(list));
+
+	zk_slist_free_arena(&list, free, &arena);
+	TEST_ASSERT_NULL(list);
+	TEST_ASSERT_NULL(arena);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+
+	RUN_TEST(test_zk_slist_free_arena_when_reference_is_null);
+	RUN_TEST(test_zk_slist_free_arena_without_arena_behaves_as_free);
+	RUN_TEST(test_zk_slist_arena_nodes_are_adjacent);
+	RUN_TEST(test_zk_slist_arena_push_fails_when_arena_is_null);
+	RUN_TEST(test_zk_slist_free_arena_for_list_of_strings);
+
+	return UNITY_END();
+}
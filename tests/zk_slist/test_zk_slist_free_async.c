@@ -0,0 +1,56 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "unity.h"
+#include "zk/zklib.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+static size_t destroyed;
+
+static void count_destroyed(void *data)
+{
+	__atomic_fetch_add(&destroyed, 1, __ATOMIC_RELAXED);
+	free(data);
+}
+
+void test_zk_slist_free_async_when_reference_is_null(void)
+{
+	TEST_ASSERT_EQUAL(ZK_INVALID_ARGUMENT, zk_slist_free_async(NULL, NULL));
+}
+
+void test_zk_slist_free_async_a_null_list_should_just_return(void)
+{
+	zk_slist *list = NULL;
+	TEST_ASSERT_EQUAL(ZK_OK, zk_slist_free_async(&list, free));
+	TEST_ASSERT_NULL(list);
+	TEST_ASSERT_EQUAL(0, zk_reclaim_pending());
+}
+
+void test_zk_slist_free_async_for_list_of_strings(void)
+{
+	int number_of_nodes = 1000;
+	zk_slist *list = NULL;
+
+	for (int i = 0; i < number_of_nodes; i++) {
+		list = zk_slist_push_front(list, strdup("a"));
+		TEST_ASSERT_NOT_NULL(list);
+	}
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_slist_free_async(&list, count_destroyed));
+	TEST_ASSERT_NULL(list);
+
+	zk_reclaim_flush();
+	TEST_ASSERT_EQUAL(number_of_nodes, __atomic_load_n(&destroyed, __ATOMIC_RELAXED));
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_zk_slist_free_async_when_reference_is_null);
+	RUN_TEST(test_zk_slist_free_async_a_null_list_should_just_return);
+	RUN_TEST(test_zk_slist_free_async_for_list_of_strings);
+	return UNITY_END();
+}
@@ -0,0 +1,70 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "unity.h"
+#include "zk/zklib.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_zk_slist_free_budget_when_reference_is_null(void)
+{
+	TEST_ASSERT_TRUE(zk_slist_free_budget(NULL, NULL, (zk_budget){ .nodes = 1 }));
+}
+
+void test_zk_slist_free_budget_a_null_list_should_just_return(void)
+{
+	zk_slist *list = NULL;
+	TEST_ASSERT_TRUE(zk_slist_free_budget(&list, free, (zk_budget){ .nodes = 1 }));
+	TEST_ASSERT_NULL(list);
+}
+
+void test_zk_slist_free_budget_frees_from_the_front(void)
+{
+	int nodes_data[10];
+	zk_slist *list = NULL;
+
+	for (int i = 0; i < 10; i++) {
+		nodes_data[i] = i;
+		list = zk_slist_push_back(list, &nodes_data[i]);
+	}
+
+	TEST_ASSERT_FALSE(zk_slist_free_budget(&list, NULL, (zk_budget){ .nodes = 4 }));
+	TEST_ASSERT_EQUAL(6, zk_slist_size(list));
+	TEST_ASSERT_EQUAL_PTR(&nodes_data[4], list->data);
+
+	TEST_ASSERT_FALSE(zk_slist_free_budget(&list, NULL, (zk_budget){ .nodes = 4 }));
+	TEST_ASSERT_EQUAL(2, zk_slist_size(list));
+	TEST_ASSERT_EQUAL_PTR(&nodes_data[8], list->data);
+
+	TEST_ASSERT_TRUE(zk_slist_free_budget(&list, NULL, (zk_budget){ .nodes = 4 }));
+	TEST_ASSERT_NULL(list);
+}
+
+void test_zk_slist_free_budget_for_list_of_strings(void)
+{
+	int number_of_nodes = 1000;
+	zk_slist *list = NULL;
+
+	for (int i = 0; i < number_of_nodes; i++) {
+		list = zk_slist_push_front(list, strdup("a"));
+		TEST_ASSERT_NOT_NULL(list);
+	}
+
+	int calls = 1;
+	while (!zk_slist_free_budget(&list, free, (zk_budget){ .nodes = 100, .ns = UINT64_C(1000000000) }))
+		calls++;
+	TEST_ASSERT_EQUAL(10, calls);
+	TEST_ASSERT_NULL(list);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_zk_slist_free_budget_when_reference_is_null);
+	RUN_TEST(test_zk_slist_free_budget_a_null_list_should_just_return);
+	RUN_TEST(test_zk_slist_free_budget_frees_from_the_front);
+	RUN_TEST(test_zk_slist_free_budget_for_list_of_strings);
+	return UNITY_END();
+}
@@ -0,0 +1,60 @@
+#include <stdlib.h>
+
+#include "unity.h"
+#include "zk/zklib.h"
+#include "zk_node_cache/zk_node_cache.h"
+
+void setUp(void) {}
+
+void tearDown(void)
+{
+	zk_node_cache_trim();
+}
+
+void test_zk_slist_reserve_serves_the_next_pushes(void)
+{
+	int nodes_data[100];
+	zk_slist *list = NULL;
+
+	zk_node_cache_trim();
+	TEST_ASSERT_EQUAL(ZK_OK, zk_slist_reserve(100));
+	TEST_ASSERT_EQUAL(100, zk_node_cache_reserved(sizeof(zk_slist)));
+
+	for (int i = 0; i < 100; i++) {
+		nodes_data[i] = i;
+		list = zk_slist_push_front(list, &nodes_data[i]);
+		TEST_ASSERT_NOT_NULL(list);
+		TEST_ASSERT_EQUAL(99 - i, zk_node_cache_reserved(sizeof(zk_slist)));
+	}
+	TEST_ASSERT_EQUAL(100, zk_slist_size(list));
+
+	zk_slist_free(&list, NULL);
+}
+
+void test_zk_slist_reserve_tops_up_the_reserve(void)
+{
+	int data = 0;
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_slist_reserve(10));
+	TEST_ASSERT_EQUAL(ZK_OK, zk_slist_reserve(4));
+	TEST_ASSERT_EQUAL(10, zk_node_cache_reserved(sizeof(zk_slist)));
+
+	zk_slist *list = zk_slist_push_back(NULL, &data);
+	TEST_ASSERT_EQUAL(ZK_OK, zk_slist_reserve(10));
+	TEST_ASSERT_EQUAL(10, zk_node_cache_reserved(sizeof(zk_slist)));
+
+	TEST_ASSERT_EQUAL(ZK_OK, zk_slist_reserve(0));
+	TEST_ASSERT_EQUAL(10, zk_node_cache_reserved(sizeof(zk_slist)));
+
+	zk_slist_free(&list, NULL);
+}
+
+int main(void)
+{
+	UNITY_BEGIN();
+
+	RUN_TEST(test_zk_slist_reserve_serves_the_next_pushes);
+	RUN_TEST(test_zk_slist_reserve_tops_up_the_reserve);
+
+	return UNITY_END();
+}